@@ -5,7 +5,9 @@
 #define _asynchronous_fifo_h__
 
 #include <stdint.h>
+#ifdef __xcore__
 #include <xccompat.h>
+#endif
 
 #define FREQUENCY_RATIO_EXPONENT     (32)
 
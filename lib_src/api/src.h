@@ -4,12 +4,16 @@
 #define _SRC_H_
 #include "src_mrhf_ssrc.h"
 #include "src_mrhf_asrc.h"
+#if !defined(__xcore__)
+#include "src_mrhf_ssrc_f32.h"
+#include "src_mrhf_asrc_f32.h"
+#endif // !__xcore__
 #include "src_ff3_ds3.h"
 #include "src_ff3_os3.h"
 #include "src_ff3v_fir.h"
-#if (defined(__XS3A__)) // Only available for XS3 with VPU
+#if (defined(__XS3A__) || !defined(__xcore__)) // Only available for XS3 with VPU, or on the host
 #include "src_poly.h"
-#endif // __XS3A__
+#endif // __XS3A__ || !__xcore__
 #include <stdint.h>
 
 #if defined(__cplusplus) || defined(__XC__)
@@ -32,6 +36,18 @@ typedef enum dither_flag_t {
     ON = 1
 } dither_flag_t;
 
+/** Phase response of the filters of an SRC instance, see ssrc_init_filter_phase() and asrc_init_filter_phase() */
+typedef enum src_filter_phase_t {
+    SRC_LINEAR_PHASE = 0,       ///< Linear phase filters, the default
+    SRC_MINIMUM_PHASE = 1       ///< Minimum phase filters with the same magnitude responses and less delay
+} src_filter_phase_t;
+
+/** Quality tier of an ASRC instance, see asrc_init_quality() (host only) */
+typedef enum asrc_quality_t {
+    ASRC_LOW_QUALITY = 0,       ///< Short F1/F2 filters and fewer F3 phases, for voice
+    ASRC_STANDARD_QUALITY = 1   ///< The filters of asrc_init(), the default
+} asrc_quality_t;
+
 /**
  * \addtogroup src_ssrc src_ssrc
  *
@@ -51,6 +67,51 @@ void ssrc_init(const fs_code_t sr_in, const fs_code_t sr_out, ssrc_ctrl_t ssrc_c
                const unsigned n_channels_per_instance, const unsigned n_in_samples,
                const dither_flag_t dither_on_off);
 
+/** Get the size of the arena that ssrc_init_arena() needs.
+ *
+ *  The arena holds the stack and the delay lines of the filters of the rate pair for each
+ *  channel, rather than an ssrc_state_t and a stack of SSRC_STACK_LENGTH_MULT * n_in_samples
+ *  words, which are sized for the longest filters and the most channels.
+ *
+ *  \param   sr_in                    Nominal sample rate code of input stream
+ *  \param   sr_out                   Nominal sample rate code of output stream
+ *  \param   n_channels_per_instance  Number of channels handled by this instance of SSRC
+ *  \param   n_in_samples             Number of input samples per SSRC call
+ *  \returns The arena size in bytes
+ */
+unsigned ssrc_get_memory_requirements(const fs_code_t sr_in, const fs_code_t sr_out,
+                                      const unsigned n_channels_per_instance, const unsigned n_in_samples);
+
+/** initializes synchronous sample rate conversion instance with all its memory in one arena.
+ *
+ *  As ssrc_init(), with the stack and delay lines of each channel carved from the arena, so psState
+ *  and piStack of the control structures need not be set.
+ *
+ *  \param   sr_in                    Nominal sample rate code of input stream
+ *  \param   sr_out                   Nominal sample rate code of output stream
+ *  \param   ssrc_ctrl                Reference to array of SSRC control stuctures
+ *  \param   n_channels_per_instance  Number of channels handled by this instance of SSRC
+ *  \param   n_in_samples             Number of input samples per SSRC call
+ *  \param   dither_on_off            Dither to 24b on/off
+ *  \param   arena                    ssrc_get_memory_requirements() bytes
+ */
+void ssrc_init_arena(const fs_code_t sr_in, const fs_code_t sr_out, ssrc_ctrl_t ssrc_ctrl[],
+                     const unsigned n_channels_per_instance, const unsigned n_in_samples,
+                     const dither_flag_t dither_on_off, uint64_t arena[]);
+
+/** Select the phase response of the filters of an initialized SSRC instance.
+ *
+ *  The minimum phase filters have the same numbers of taps and the same magnitude responses as
+ *  the linear phase ones, so the cost and the audio performance are unchanged, but they delay
+ *  the signal less. The delay of each rate pair is listed in the programming guide. Call after
+ *  ssrc_init() or ssrc_init_arena(), which select the linear phase filters, and before the first
+ *  call to ssrc_process().
+ *
+ *  \param   ssrc_ctrl        Reference to array of SSRC control stuctures
+ *  \param   filter_phase     Linear or minimum phase filters
+ */
+void ssrc_init_filter_phase(ssrc_ctrl_t ssrc_ctrl[], const src_filter_phase_t filter_phase);
+
 /** Perform synchronous sample rate conversion processing on block of input samples using previously initialized settings.
  *
  *  \param   in_buff          Reference to input sample buffer array
@@ -60,6 +121,65 @@ void ssrc_init(const fs_code_t sr_in, const fs_code_t sr_out, ssrc_ctrl_t ssrc_c
  */
 unsigned ssrc_process(int in_buff[], int out_buff[], ssrc_ctrl_t ssrc_ctrl[]);
 
+#if !defined(__xcore__)
+/** Perform synchronous sample rate conversion processing on block of planar input samples (host only).
+ *
+ *  As ssrc_process(), with a buffer per channel that is read and written with a step of one
+ *  sample. An instance may be called with planar and interleaved buffers in turn.
+ *
+ *  \param   in_buff          Input sample buffer of each channel
+ *  \param   out_buff         Output sample buffer of each channel
+ *  \param   ssrc_ctrl        Reference to array of SSRC control stuctures
+ *  \returns The number of output samples per channel produced by the SRC operation
+ */
+unsigned ssrc_process_planar(int *in_buff[], int *out_buff[], ssrc_ctrl_t ssrc_ctrl[]);
+
+/** Move the delay lines of an initialized SSRC instance to mirrored ring buffers (host only).
+ *
+ *  The pages of each ring are mapped twice, back to back, so each input sample is written to the
+ *  delay line once rather than twice and the filters still read their taps linearly. The output
+ *  is unchanged and the current state is carried over. Rings are a whole number of pages, so this
+ *  saves stores rather than memory. ssrc_exit_mirrored_delays() moves them back; initializing the
+ *  instance again unmaps the rings and starts over with the delay lines of the state structures.
+ *
+ *  \param   ssrc_ctrl        Reference to array of SSRC control structures
+ *  \returns 1 if the delay lines are mirrored, 0 if mirrored mappings are not available on this
+ *           host, in which case the instance keeps its double write delay lines
+ */
+int ssrc_init_mirrored_delays(ssrc_ctrl_t ssrc_ctrl[]);
+
+/** Move the delay lines of an SSRC instance back from mirrored ring buffers to its state
+ *  structures, carrying the state over, and unmap the rings (host only).
+ *
+ *  \param   ssrc_ctrl        Reference to array of SSRC control structures
+ */
+void ssrc_exit_mirrored_delays(ssrc_ctrl_t ssrc_ctrl[]);
+
+/** initializes a float32 synchronous sample rate conversion instance (host only).
+ *
+ *  The filters are those of ssrc_init(), with float32 coefficients. Samples are float32 with 1.0
+ *  as full scale, and there is no dither. Set psState to an ssrc_f32_state_t and pfStack to
+ *  SSRC_STACK_LENGTH_MULT * n_in_samples floats in each control structure first.
+ *
+ *  \param   sr_in                    Nominal sample rate code of input stream
+ *  \param   sr_out                   Nominal sample rate code of output stream
+ *  \param   ssrc_ctrl                Reference to array of float32 SSRC control stuctures
+ *  \param   n_channels_per_instance  Number of channels handled by this instance of SSRC
+ *  \param   n_in_samples             Number of input samples per SSRC call
+ */
+void ssrc_f32_init(const fs_code_t sr_in, const fs_code_t sr_out, ssrc_f32_ctrl_t ssrc_ctrl[],
+                   const unsigned n_channels_per_instance, const unsigned n_in_samples);
+
+/** Perform float32 synchronous sample rate conversion processing on block of input samples (host only).
+ *
+ *  \param   in_buff          Reference to input sample buffer array
+ *  \param   out_buff         Reference to output sample buffer array
+ *  \param   ssrc_ctrl        Reference to array of float32 SSRC control stuctures
+ *  \returns The number of output samples produced by the SRC operation
+ */
+unsigned ssrc_f32_process(float in_buff[], float out_buff[], ssrc_f32_ctrl_t ssrc_ctrl[]);
+#endif
+
 /**@}*/ // END: addtogroup src_ssrc
 
 /**
@@ -83,6 +203,138 @@ uint64_t asrc_init(const fs_code_t sr_in, const fs_code_t sr_out,
                    asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
                    const unsigned n_in_samples, const dither_flag_t dither_on_off);
 
+/** initializes asynchronous sample rate conversion instance for any pair of rates given in Hz.
+ *
+ *  Rates of the sample rate codes give the same instance as asrc_init(). Other rates up to an
+ *  Fsin/Fsout ratio of 1, or at the ratio of a rate code pair, take the F1/F2 filters of that pair,
+ *  which are specified relative to the rates. On hosts the F1/F2 filters of other pairs are
+ *  designed for the rates, with a passband up to 0.45 Fsout and an F0 filter halving the rate
+ *  before F1 above a ratio of 7.84, for which n_in_samples must be a multiple of 8. Those pairs
+ *  need the memory of asrc_init_rates_arena(), which designs the filters once for the instance;
+ *  asrc_init_rates() stops with error 13 for them, as for unsupported rates. Ratios up to
+ *  15.68 are supported on hosts, and up to 192/44.1 on xcore, where the filters are those of the
+ *  rate code pair with the next ratio up, see asrc_rates_supported(). As the output may have up
+ *  to Fsout/Fsin samples per input sample, size the output buffer for that.
+ *
+ *  \param   fs_in           Nominal sample rate of input stream in Hz
+ *  \param   fs_out          Nominal sample rate of output stream in Hz
+ *  \param   asrc_ctrl       Reference to array of ASRC control structures
+ *  \param   n_channels_per_instance  Number of channels handled by this instance of SSRC
+ *  \param   n_in_samples             Number of input samples per SSRC call
+ *  \param   dither_on_off            Dither to 24b on/off
+ *  \returns The nominal sample rate ratio of in to out in Q4.60 format, exactly fs_in / fs_out
+ *           for rates other than those of the codes
+ */
+uint64_t asrc_init_rates(const unsigned fs_in, const unsigned fs_out,
+                         asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+                         const unsigned n_in_samples, const dither_flag_t dither_on_off);
+
+/** Get the size of the arena that asrc_init_arena() needs.
+ *
+ *  The arena holds the adaptive filter coefficients of the instance, and the stack and the delay
+ *  lines of the filters of the rate pair for each channel, rather than an asrc_state_t and a stack
+ *  of ASRC_STACK_LENGTH_MULT * n_in_samples words, which are sized for the longest filters and the
+ *  most channels.
+ *
+ *  \param   sr_in                    Nominal sample rate code of input stream
+ *  \param   sr_out                   Nominal sample rate code of output stream
+ *  \param   n_channels_per_instance  Number of channels handled by this instance of ASRC
+ *  \param   n_in_samples             Number of input samples per ASRC call
+ *  \returns The arena size in bytes
+ */
+unsigned asrc_get_memory_requirements(const fs_code_t sr_in, const fs_code_t sr_out,
+                                      const unsigned n_channels_per_instance, const unsigned n_in_samples);
+
+/** initializes asynchronous sample rate conversion instance with all its memory in one arena.
+ *
+ *  As asrc_init(), with the adaptive filter coefficients, and the stack and delay lines of each
+ *  channel carved from the arena, so psState, piStack and piADCoefs of the control structures need
+ *  not be set.
+ *
+ *  \param   sr_in                    Nominal sample rate code of input stream
+ *  \param   sr_out                   Nominal sample rate code of output stream
+ *  \param   asrc_ctrl                Reference to array of ASRC control structures
+ *  \param   n_channels_per_instance  Number of channels handled by this instance of ASRC
+ *  \param   n_in_samples             Number of input samples per ASRC call
+ *  \param   dither_on_off            Dither to 24b on/off
+ *  \param   arena                    asrc_get_memory_requirements() bytes
+ *  \returns The nominal sample rate ratio of in to out in Q4.60 format
+ */
+uint64_t asrc_init_arena(const fs_code_t sr_in, const fs_code_t sr_out,
+                         asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+                         const unsigned n_in_samples, const dither_flag_t dither_on_off, uint64_t arena[]);
+
+/** Get the size of the arena that asrc_init_rates_arena() needs.
+ *
+ *  As asrc_get_memory_requirements(). On hosts the arena also holds the coefficients of the
+ *  filters designed for the rates, once for the instance, and their delay lines for each channel.
+ *
+ *  \param   fs_in                    Nominal sample rate of input stream in Hz
+ *  \param   fs_out                   Nominal sample rate of output stream in Hz
+ *  \param   n_channels_per_instance  Number of channels handled by this instance of ASRC
+ *  \param   n_in_samples             Number of input samples per ASRC call
+ *  \returns The arena size in bytes
+ */
+unsigned asrc_get_memory_requirements_rates(const unsigned fs_in, const unsigned fs_out,
+                                            const unsigned n_channels_per_instance, const unsigned n_in_samples);
+
+/** initializes asynchronous sample rate conversion instance for any pair of rates given in Hz
+ *  with all its memory in one arena.
+ *
+ *  As asrc_init_rates() and asrc_init_arena(). Every pair that asrc_rates_supported() accepts
+ *  is supported, including those whose filters are designed for the rates.
+ *
+ *  \param   fs_in                    Nominal sample rate of input stream in Hz
+ *  \param   fs_out                   Nominal sample rate of output stream in Hz
+ *  \param   asrc_ctrl                Reference to array of ASRC control structures
+ *  \param   n_channels_per_instance  Number of channels handled by this instance of ASRC
+ *  \param   n_in_samples             Number of input samples per ASRC call
+ *  \param   dither_on_off            Dither to 24b on/off
+ *  \param   arena                    asrc_get_memory_requirements_rates() bytes
+ *  \returns The nominal sample rate ratio of in to out in Q4.60 format
+ */
+uint64_t asrc_init_rates_arena(const unsigned fs_in, const unsigned fs_out,
+                               asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+                               const unsigned n_in_samples, const dither_flag_t dither_on_off, uint64_t arena[]);
+
+/** Check whether asrc_init_rates_arena() supports a pair of rates.
+ *
+ *  \param   fs_in           Nominal sample rate of input stream in Hz
+ *  \param   fs_out          Nominal sample rate of output stream in Hz
+ *  \returns 1 if the rates are supported, 0 if not
+ */
+int asrc_rates_supported(const unsigned fs_in, const unsigned fs_out);
+
+/** Select the phase response of the filters of an initialized ASRC instance.
+ *
+ *  As ssrc_init_filter_phase(). On hosts the phases of the adaptive F3 filter are those of a
+ *  minimum phase prototype too; on xcore the F3 filter stays linear phase. Call after asrc_init(),
+ *  asrc_init_rates(), asrc_init_arena() or asrc_init_rates_arena() and before the first call to
+ *  asrc_process().
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \param   filter_phase     Linear or minimum phase filters
+ */
+void asrc_init_filter_phase(asrc_ctrl_t asrc_ctrl[], const src_filter_phase_t filter_phase);
+
+#if !defined(__xcore__)
+/** Select the quality tier of an initialized ASRC instance (host only).
+ *
+ *  The tiers trade the cost of the F1/F2 filters and of the adaptive F3 filter for THD+N, see the
+ *  programming guide. ASRC_LOW_QUALITY has F1/F2 filters of 48 to 64 taps with 84% of the
+ *  passband and 100dB of stopband attenuation, and 64 F3 phases. ASRC_STANDARD_QUALITY is that of
+ *  asrc_init(), whose THD+N is set by its fixed point arithmetic rather than by its filters. The
+ *  F3 phases have 16 taps in both tiers. The instance is synced, and keeps the phase response set
+ *  by asrc_init_filter_phase(). Call after asrc_init(), asrc_init_rates(), asrc_init_arena() or
+ *  asrc_init_rates_arena() and before asrc_init_mirrored_delays() and the first call to
+ *  asrc_process().
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \param   quality          Quality tier
+ */
+void asrc_init_quality(asrc_ctrl_t asrc_ctrl[], const asrc_quality_t quality);
+#endif
+
 /** Perform asynchronous sample rate conversion processing on block of input samples using previously initialized settings.
  *
  *  \param   in_buff          Reference to input sample buffer array
@@ -94,6 +346,246 @@ uint64_t asrc_init(const fs_code_t sr_in, const fs_code_t sr_out,
 unsigned asrc_process(int in_buff[], int out_buff[], uint64_t fs_ratio,
                       asrc_ctrl_t asrc_ctrl[]);
 
+/** Perform asynchronous sample rate conversion processing on block of input samples with the
+ *  sample rate ratio ramped over the block.
+ *
+ *  As asrc_process(), with the F3 time step ramped linearly from that of fs_ratio_start, for the
+ *  first input sample of the block, towards that of fs_ratio_end, by input sample of F3. Passing
+ *  the fs_ratio_end of a block as the fs_ratio_start of the next one makes the ratio piecewise
+ *  linear, so a ratio that is updated once per block does not step, whatever the block size.
+ *  Each ratio out of bounds is replaced by the nominal one, as by asrc_process().
+ *
+ *  \param   in_buff          Reference to input sample buffer array
+ *  \param   out_buff         Reference to output sample buffer array
+ *  \param   fs_ratio_start   Fixed point ratio of in/out sample rates in Q4.60 format at the start of the block
+ *  \param   fs_ratio_end     Fixed point ratio of in/out sample rates in Q4.60 format at the end of the block
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \returns The number of output samples produced by the SRC operation.
+ */
+unsigned asrc_process_ramp(int in_buff[], int out_buff[], uint64_t fs_ratio_start,
+                           uint64_t fs_ratio_end, asrc_ctrl_t asrc_ctrl[]);
+
+#if !defined(__xcore__)
+/** Perform asynchronous sample rate conversion processing on block of planar input samples (host only).
+ *
+ *  As asrc_process(), with a buffer per channel that is read and written with a step of one
+ *  sample. An instance may be called with planar and interleaved buffers in turn.
+ *
+ *  \param   in_buff          Input sample buffer of each channel
+ *  \param   out_buff         Output sample buffer of each channel
+ *  \param   fs_ratio         Fixed point ratio of in/out sample rates in Q4.60 format
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \returns The number of output samples per channel produced by the SRC operation.
+ */
+unsigned asrc_process_planar(int *in_buff[], int *out_buff[], uint64_t fs_ratio,
+                             asrc_ctrl_t asrc_ctrl[]);
+
+/** Switch the F3 stage of an initialized ASRC instance to delay lines interleaved tap by tap (host only).
+ *
+ *  One load then gives the same tap of every channel, and the shared adaptive coefficients are
+ *  broadcast against it, which speeds up instances with many channels. The output is unchanged.
+ *  The current F3 state is carried over, so this may be called at any time after asrc_init().
+ *  asrc_init() switches back to one delay line per channel.
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \param   delay            Interleaved delay lines, ASRC_F3_INTERLEAVED_DELAY_LENGTH(n_channels_per_instance) words.
+ *                            Preferably 64 byte aligned
+ */
+void asrc_init_f3_interleaved(asrc_ctrl_t asrc_ctrl[], int delay[]);
+
+/** Move the delay lines of an initialized ASRC instance to mirrored ring buffers (host only).
+ *
+ *  As ssrc_init_mirrored_delays(). F3 delay lines that have been interleaved by
+ *  asrc_init_f3_interleaved() stay as they are. Initializing the instance again unmaps the rings.
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \returns 1 if the delay lines are mirrored, 0 if mirrored mappings are not available on this
+ *           host, in which case the instance keeps its double write delay lines
+ */
+int asrc_init_mirrored_delays(asrc_ctrl_t asrc_ctrl[]);
+
+/** Move the delay lines of an ASRC instance back from mirrored ring buffers to its state
+ *  structures, carrying the state over, and unmap the rings (host only).
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ */
+void asrc_exit_mirrored_delays(asrc_ctrl_t asrc_ctrl[]);
+
+/** Input callback of asrc_process_pull() (host only).
+ *
+ *  \param   context          The context passed to asrc_process_pull()
+ *  \returns The next n_in_samples input samples of each channel, interleaved. They are to stay
+ *           valid until the callback is called again
+ */
+typedef int *(*asrc_pull_input_t)(void *context);
+
+/** Get the length of the buffer that asrc_init_pull() needs for an initialized ASRC instance (host only).
+ *
+ *  This is the most output samples of one block, at the lowest Fs ratio allowed for the rates,
+ *  times the number of channels.
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \returns The buffer length in words
+ */
+unsigned asrc_pull_buffer_length(asrc_ctrl_t asrc_ctrl[]);
+
+/** Let an initialized ASRC instance be called with asrc_process_pull() (host only).
+ *
+ *  Any output held over from earlier calls to asrc_process_pull() is dropped. asrc_init() detaches
+ *  the buffer.
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \param   buffer           Output held over between calls, asrc_pull_buffer_length() words
+ */
+void asrc_init_pull(asrc_ctrl_t asrc_ctrl[], int buffer[]);
+
+/** Perform asynchronous sample rate conversion producing a fixed number of output samples (host only).
+ *
+ *  Input blocks of n_in_samples are taken from the callback as they are needed to produce exactly
+ *  n_out output samples per channel, and processed as by asrc_process(). The output of the last
+ *  block that is not needed yet is held over to the next call, so a device with a fixed period can
+ *  be fed without a buffer of its own. Blocks whose output all fits are written straight to
+ *  out_buff. Set up the instance with asrc_init_pull() first. asrc_process() may be called in
+ *  between only when no output is held over.
+ *
+ *  \param   out_buff         Output sample buffer, n_out interleaved samples of each channel
+ *  \param   n_out            Number of output samples per channel to produce
+ *  \param   fs_ratio         Fixed point ratio of in/out sample rates in Q4.60 format
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \param   input            Input callback, called once per input block
+ *  \param   context          Passed to the input callback
+ *  \returns The number of input samples per channel taken by this call
+ */
+unsigned asrc_process_pull(int out_buff[], unsigned n_out, uint64_t fs_ratio, asrc_ctrl_t asrc_ctrl[],
+                           asrc_pull_input_t input, void *context);
+
+/** Get the length of the buffer that asrc_init_passthrough() needs for an initialized ASRC instance (host only).
+ *
+ *  This holds the input history that refills the filters, one block, and the output of the
+ *  refill, for all the channels.
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \returns The buffer length in words
+ */
+unsigned asrc_passthrough_buffer_length(asrc_ctrl_t asrc_ctrl[]);
+
+/** Let an ASRC instance between equal rates copy its input while the Fs ratio is nominal (host only).
+ *
+ *  Once asrc_process(), asrc_process_planar() or asrc_process_pull() have been called window blocks
+ *  in a row with an Fs ratio whose F3 time step is that of the nominal ratio, so that the F3 phase
+ *  does not drift, the output is crossfaded over ASRC_PASS_FADE_LENGTH samples to a copy of the
+ *  input, delayed by that of the filters rounded to a sample, and the filters are no longer run. In
+ *  the first block with another ratio, or of asrc_process_ramp(), the filters are run on an input
+ *  history to fill their delay lines and the output is crossfaded back to theirs. Dither is applied
+ *  to the copy as to the filter output.
+ *
+ *  Only for equal input and output rates with the linear phase filters, so call it after
+ *  asrc_init_filter_phase() and asrc_init_quality(). Not for asrc_mt_init(). A null buffer turns
+ *  the fast path off, and asrc_init() detaches the buffer.
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \param   window           Blocks at the nominal ratio before the copy is faded in, at least 1
+ *  \param   buffer           Input history and refill output, asrc_passthrough_buffer_length() words
+ */
+void asrc_init_passthrough(asrc_ctrl_t asrc_ctrl[], unsigned window, int buffer[]);
+
+/** Check whether the output of an ASRC instance is the passthrough copy only (host only).
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \returns 1 when the filters are not run, 0 otherwise
+ */
+int asrc_passthrough_active(asrc_ctrl_t asrc_ctrl[]);
+
+/** Get the length of the buffer that asrc_mt_init() needs for an initialized ASRC instance (host only).
+ *
+ *  This holds the F3 schedule of a block: the adaptive coefficients and the synchronous sample of
+ *  each output sample, for the most output samples of one block.
+ *
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \returns The buffer length in words
+ */
+unsigned asrc_mt_buffer_length(asrc_ctrl_t asrc_ctrl[]);
+
+/** Start a pool of threads to run an initialized ASRC instance with asrc_mt_process() (host only).
+ *
+ *  The channels are shared out between n_threads threads, the one calling asrc_mt_process()
+ *  included, so n_threads - 1 worker threads are started. There are no more threads than
+ *  channels. Not for F3 delay lines interleaved by asrc_init_f3_interleaved() or the passthrough
+ *  fast path of asrc_init_passthrough(). Stop the pool with
+ *  asrc_mt_exit() before the instance is initialized again.
+ *
+ *  \param   mt               Thread pool state
+ *  \param   asrc_ctrl        Reference to array of ASRC control structures
+ *  \param   n_threads        Number of threads, 1 to ASRC_MT_MAX_THREADS
+ *  \param   buffer           F3 schedule, asrc_mt_buffer_length() words
+ */
+void asrc_mt_init(asrc_mt_t *mt, asrc_ctrl_t asrc_ctrl[], unsigned n_threads, int buffer[]);
+
+/** Perform asynchronous sample rate conversion on a pool of threads (host only).
+ *
+ *  As asrc_process(), with each thread processing its shard of the channels. The threads run the
+ *  block in lock step: the output instants of the F3 stage and their adaptive coefficients are
+ *  worked out once, by the calling thread, and shared by all. The output is exactly that of
+ *  asrc_process(). Returns when the whole block is done.
+ *
+ *  \param   in_buff          Input buffer pointer, n_in_samples interleaved samples of each channel
+ *  \param   out_buff         Output buffer pointer, interleaved
+ *  \param   fs_ratio         Fixed point ratio of in/out sample rates in Q4.60 format
+ *  \param   mt               Thread pool state
+ *  \returns The number of output samples produced per channel
+ */
+unsigned asrc_mt_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_mt_t *mt);
+
+/** Stop the threads of a pool started by asrc_mt_init() (host only).
+ *
+ *  \param   mt               Thread pool state
+ */
+void asrc_mt_exit(asrc_mt_t *mt);
+
+/** initializes a float32 asynchronous sample rate conversion instance (host only).
+ *
+ *  The filters and the F3 time and ratio handling are those of asrc_init(), with float32
+ *  coefficients. Samples are float32 with 1.0 as full scale, and there is no dither. Set psState
+ *  to an asrc_f32_state_t and pfStack to ASRC_STACK_LENGTH_MULT * n_in_samples floats in each
+ *  control structure first.
+ *
+ *  \param   sr_in           Nominal sample rate code of input stream
+ *  \param   sr_out          Nominal sample rate code of output stream
+ *  \param   asrc_ctrl       Reference to array of float32 ASRC control structures
+ *  \param   n_channels_per_instance  Number of channels handled by this instance of ASRC
+ *  \param   n_in_samples             Number of input samples per ASRC call
+ *  \returns The nominal sample rate ratio of in to out in Q4.60 format
+ */
+uint64_t asrc_f32_init(const fs_code_t sr_in, const fs_code_t sr_out,
+                       asrc_f32_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+                       const unsigned n_in_samples);
+
+/** initializes a float32 asynchronous sample rate conversion instance for any pair of rates given
+ *  in Hz (host only). As asrc_init_rates() and asrc_f32_init().
+ *
+ *  \param   fs_in           Nominal sample rate of input stream in Hz
+ *  \param   fs_out          Nominal sample rate of output stream in Hz
+ *  \param   asrc_ctrl       Reference to array of float32 ASRC control structures
+ *  \param   n_channels_per_instance  Number of channels handled by this instance of ASRC
+ *  \param   n_in_samples             Number of input samples per ASRC call
+ *  \returns The nominal sample rate ratio of in to out in Q4.60 format
+ */
+uint64_t asrc_f32_init_rates(const unsigned fs_in, const unsigned fs_out,
+                             asrc_f32_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+                             const unsigned n_in_samples);
+
+/** Perform float32 asynchronous sample rate conversion processing on block of input samples (host only).
+ *
+ *  \param   in_buff          Reference to input sample buffer array
+ *  \param   out_buff         Reference to output sample buffer array
+ *  \param   fs_ratio         Fixed point ratio of in/out sample rates in Q4.60 format
+ *  \param   asrc_ctrl        Reference to array of float32 ASRC control structures
+ *  \returns The number of output samples produced by the SRC operation.
+ */
+unsigned asrc_f32_process(float in_buff[], float out_buff[], uint64_t fs_ratio,
+                          asrc_f32_ctrl_t asrc_ctrl[]);
+#endif
+
 /**@}*/ // END: addtogroup src_asrc
 
 
@@ -124,6 +616,10 @@ typedef struct src_ds3_ctrl_t
     unsigned int inner_loops;  //!< Number of inner loop iterations
     unsigned int num_coeffs;   //!< Number of coefficients
     int*         coeffs;       //!< Pointer to coefficients
+#if !defined(__xcore__)
+    void         (*inner_loop[2])(int *, int *, int [], int); //!< Host inner loops by delay line alignment parity, set by init
+    int*         delay_unmirrored; //!< Delay line base before src_ds3_init_mirrored_delay(), 0 if the delay line is not mirrored
+#endif
 } src_ds3_ctrl_t;
 
 /** This function initializes the decimate by 3 function for a given instance
@@ -148,6 +644,27 @@ src_ff3_return_code_t src_ds3_sync(src_ds3_ctrl_t* src_ds3_ctrl);
  */
 src_ff3_return_code_t src_ds3_proc(src_ds3_ctrl_t* src_ds3_ctrl);
 
+#if !defined(__xcore__)
+/** This function moves the decimate by 3 delay line of an initialized instance to a mirrored ring
+ *  buffer, so each input sample is written to it once rather than twice (host only).
+ *  The output is unchanged and the current state is carried over.
+ *  src_ds3_init() unmaps the ring, and goes back to the delay line it replaced if delay_base was
+ *  left at the ring.
+ *
+ *  \param      src_ds3_ctrl   DS3 control structure
+ *  \returns    SRC_FF3_NO_ERROR on success, SRC_FF3_ERROR if mirrored mappings are not
+ *              available on this host, the delay line is then unchanged
+ */
+src_ff3_return_code_t src_ds3_init_mirrored_delay(src_ds3_ctrl_t* src_ds3_ctrl);
+
+/** This function moves the decimate by 3 delay line back from its mirrored ring buffer to delay_base,
+ *  carrying the state over, and unmaps the ring (host only)
+ *
+ *  \param      src_ds3_ctrl   DS3 control structure
+ */
+void src_ds3_exit_mirrored_delay(src_ds3_ctrl_t* src_ds3_ctrl);
+#endif
+
 /** Oversample by 3 control structure */
 typedef struct src_os3_ctrl_t
 {
@@ -162,6 +679,10 @@ typedef struct src_os3_ctrl_t
     unsigned int inner_loops;  //!< Number of inner loop iterations
     unsigned int num_coeffs;   //!< Number of coefficients
     int*         coeffs;       //!< Pointer to coefficients
+#if !defined(__xcore__)
+    void         (*inner_loop[2])(int *, int *, int [], int); //!< Host inner loops by delay line alignment parity, set by init
+    int*         delay_unmirrored; //!< Delay line base before src_os3_init_mirrored_delay(), 0 if the delay line is not mirrored
+#endif
 } src_os3_ctrl_t;
 
 /** This function initializes the oversample by 3 function for a given instance
@@ -194,6 +715,27 @@ src_ff3_return_code_t src_os3_input(src_os3_ctrl_t* src_os3_ctrl);
  */
 src_ff3_return_code_t src_os3_proc(src_os3_ctrl_t* src_os3_ctrl);
 
+#if !defined(__xcore__)
+/** This function moves the oversample by 3 delay line of an initialized instance to a mirrored ring
+ *  buffer, so each input sample is written to it once rather than twice (host only).
+ *  The output is unchanged and the current state is carried over.
+ *  src_os3_init() unmaps the ring, and goes back to the delay line it replaced if delay_base was
+ *  left at the ring.
+ *
+ *  \param      src_os3_ctrl   OS3 control structure
+ *  \returns    SRC_FF3_NO_ERROR on success, SRC_FF3_ERROR if mirrored mappings are not
+ *              available on this host, the delay line is then unchanged
+ */
+src_ff3_return_code_t src_os3_init_mirrored_delay(src_os3_ctrl_t* src_os3_ctrl);
+
+/** This function moves the oversample by 3 delay line back from its mirrored ring buffer to delay_base,
+ *  carrying the state over, and unmaps the ring (host only)
+ *
+ *  \param      src_os3_ctrl   OS3 control structure
+ */
+void src_os3_exit_mirrored_delay(src_os3_ctrl_t* src_os3_ctrl);
+#endif
+
 #endif // INCLUDE_FROM_ASM
 
 #if defined(__cplusplus) || defined(__XC__)
@@ -4,16 +4,36 @@
 #include <string.h>
 #include "asynchronous_fifo.h"
 
+#ifdef __xcore__
 #include <xcore/chanend.h>
 #include <platform.h>
 #include <xs1.h>
 #include <print.h>
+#include <xscope.h>
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <xscope.h>
 #include "src.h"
 
+/*
+ * The producer and consumer normally run on different threads. On xcore
+ * plain loads and stores are ordered, on other targets the fields that hand
+ * over ownership (write_ptr, read_ptr and reset) are accessed with the
+ * acquire/release __atomic builtins, which work on the plain int fields of
+ * the state. A release store of write_ptr publishes the samples
+ * before it, a release store of read_ptr the timestamp before it, and the
+ * release store that clears reset the whole re-initialised producing side.
+ * Neither side ever waits for the other.
+ */
+#ifdef __xcore__
+#define FIFO_LOAD_ACQUIRE(p)        (*(p))
+#define FIFO_STORE_RELEASE(p, v)    (*(p) = (v))
+#else
+#define FIFO_LOAD_ACQUIRE(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define FIFO_STORE_RELEASE(p, v)    __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
 
 // TODO: Make fifo offset from N/2 a very small component in PID,
 
@@ -24,7 +44,8 @@
  */
 static void asynchronous_fifo_init_producing_side(asynchronous_fifo_t *state) {
     state->skip_ctr = state->max_fifo_depth / 2 + 2;
-    state->write_ptr = (state->read_ptr + state->max_fifo_depth/2) % state->max_fifo_depth;
+    FIFO_STORE_RELEASE(&state->write_ptr,
+                       (FIFO_LOAD_ACQUIRE(&state->read_ptr) + state->max_fifo_depth/2) % state->max_fifo_depth);
     state->last_phase_error = 0;
     state->frequency_ratio = 0;   // Assume perfect match
     state->stop_producing = 0;
@@ -36,7 +57,7 @@ static void asynchronous_fifo_init_producing_side(asynchronous_fifo_t *state) {
  * is needed.
  */
 static void asynchronous_fifo_reset_consumer_flags(asynchronous_fifo_t *state) {
-    state->reset = 0;        // This has to be the last one
+    FIFO_STORE_RELEASE(&state->reset, 0);        // This has to be the last one
 }
 
 #define K_SHIFT 16
@@ -105,45 +126,54 @@ void asynchronous_fifo_reset_producer(asynchronous_fifo_t *state) {
 }
 
 void asynchronous_fifo_reset_consumer(asynchronous_fifo_t *state) {
-    state->reset = 1;
+    FIFO_STORE_RELEASE(&state->reset, 1);
 }
 
 int32_t asynchronous_fifo_producer_put(asynchronous_fifo_t *state, int32_t *samples,
                                   int n,
                                   int32_t timestamp,
                                   int xscope_used) {
-    int read_ptr = state->read_ptr;
+    int read_ptr = FIFO_LOAD_ACQUIRE(&state->read_ptr);
     int write_ptr = state->write_ptr;
     int max_fifo_depth = state->max_fifo_depth;
     int channel_count = state->channel_count;
     int copy_mask = state->copy_mask;
     int len = (write_ptr - read_ptr + max_fifo_depth) % max_fifo_depth;
-    if (state->reset) {
+    if (FIFO_LOAD_ACQUIRE(&state->reset)) {
         async_resets++;
         asynchronous_fifo_init_producing_side(state);    // uses read_ptr
         asynchronous_fifo_reset_consumer_flags(state);   // Last step - clears reset
     } else if (len >= max_fifo_depth - 2 - n) {
         state->stop_producing = 1;
     } else if (!state->stop_producing && n) {
+#ifdef __XS3A__
         for(int j = 0; j < n; j++) {
-
-#ifdef __XS2A__
-            memcpy(state->buffer + write_ptr * channel_count, samples, channel_count * sizeof(int));
-            (void)copy_mask; // Remove unused var warning
-#else
             register int32_t *ptr asm("r11") = samples;
             asm("vldr %0[0]" :: "r" (ptr));
             asm("vstrpv %0[0], %1" :: "r" (state->buffer + write_ptr * channel_count), "r" (copy_mask));
-#endif
             samples += channel_count;
             write_ptr = (write_ptr + 1);
             if (write_ptr >= max_fifo_depth) {
                 write_ptr = 0;
             }
         }
+#else
+        // Frames are contiguous in the buffer, so copy them in at most two runs
+        int run = max_fifo_depth - write_ptr;
+        if (run > n) {
+            run = n;
+        }
+        memcpy(state->buffer + write_ptr * channel_count, samples, run * channel_count * sizeof(int));
+        memcpy(state->buffer, samples + run * channel_count, (n - run) * channel_count * sizeof(int));
+        write_ptr += n;
+        if (write_ptr >= max_fifo_depth) {
+            write_ptr -= max_fifo_depth;
+        }
+        (void)copy_mask; // Remove unused var warning
+#endif
 
         /* Difference between timestamp recorded by consumer and current timestamp */
-        state->write_ptr = write_ptr;
+        FIFO_STORE_RELEASE(&state->write_ptr, write_ptr);
         int32_t phase_error = state->timestamps[write_ptr] - timestamp;
 
         /* Ideal phase error is the middle of the fifo measured in ticks */
@@ -189,29 +219,30 @@ int32_t asynchronous_fifo_producer_put(asynchronous_fifo_t *state, int32_t *samp
  * the producer fails. The producer side is reset exactly once on reset.
  */
 void asynchronous_fifo_consumer_get(asynchronous_fifo_t *state, int32_t *samples, int32_t timestamp) {
+    int reset = FIFO_LOAD_ACQUIRE(&state->reset);
     int read_ptr = state->read_ptr;
-    int write_ptr = state->write_ptr;
+    int write_ptr = FIFO_LOAD_ACQUIRE(&state->write_ptr);
     int max_fifo_depth = state->max_fifo_depth;
     int channel_count = state->channel_count;
     int copy_mask = state->copy_mask;
     int len = (write_ptr - read_ptr + max_fifo_depth) % max_fifo_depth;
-#ifdef __XS2A__
-    memcpy(samples, state->buffer + read_ptr * channel_count, channel_count * sizeof(int));
-    (void)copy_mask; // Remove unused var warning
-#else
+#ifdef __XS3A__
     register int32_t *ptr asm("r11") = state->buffer + read_ptr * channel_count;
     asm("vldr %0[0]" :: "r" (ptr));
     asm("vstrpv %0[0], %1" :: "r" (samples), "r" (copy_mask));
+#else
+    memcpy(samples, state->buffer + read_ptr * channel_count, channel_count * sizeof(int));
+    (void)copy_mask; // Remove unused var warning
 #endif
-    if (state->reset) {
+    if (reset) {
         return;
     }
     if (len > 2) {
         // TODO: use IF not %
         read_ptr = (read_ptr + 1) % state->max_fifo_depth;
-        state->read_ptr = read_ptr;
         state->timestamps[read_ptr] = timestamp;
+        FIFO_STORE_RELEASE(&state->read_ptr, read_ptr);
     } else {
-        state->reset = 1;                // The rest must happen in the other thread
+        FIFO_STORE_RELEASE(&state->reset, 1);    // The rest must happen in the other thread
     }
 }
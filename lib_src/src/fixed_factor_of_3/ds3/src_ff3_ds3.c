@@ -22,6 +22,10 @@
 #include "src.h"
 #include "src_ff3_ds3.h"
 #include "src_ff3_fir_inner_loop_asm.h"
+#if !defined(__xcore__)
+#include "src_mrhf_isa.h"
+#include "src_mrhf_mirror.h"
+#endif
 
 
 // ===========================================================================
@@ -34,6 +38,13 @@
 // State init value
 #define        SRC_FF3_DS3_STATE_INIT                    0
 
+// (on host) A mirrored delay line only takes the second of the two writes, see src_mrhf_mirror.h
+#if !defined(__xcore__)
+#define        SRC_FF3_DS3_DELAY_MIRRORED(ctrl)          ((ctrl)->delay_unmirrored != 0)
+#else
+#define        SRC_FF3_DS3_DELAY_MIRRORED(ctrl)          0
+#endif
+
 
 
 
@@ -63,6 +74,18 @@ int src_ds3_coeffs[SRC_FF3_DS3_N_COEFS] = {
 
 src_ff3_return_code_t src_ds3_init(src_ds3_ctrl_t* src_ds3_ctrl)
 {
+#if !defined(__xcore__)
+    // Unmap a ring left by src_ds3_init_mirrored_delay(), and go back to the delay line it replaced
+    // if the base is still the ring. The wrap of a mirrored ring is at its end
+    if (src_ds3_ctrl->delay_unmirrored != 0) {
+        int*    ring = (int*)((uintptr_t)src_ds3_ctrl->delay_wrap - (uintptr_t)src_ds3_ctrl->delay_len * sizeof(int));
+
+        if (src_mirror_release(ring) && (src_ds3_ctrl->delay_base == ring)) {
+            src_ds3_ctrl->delay_base  = src_ds3_ctrl->delay_unmirrored;
+        }
+    }
+#endif
+
     // Check that delay line base has been set
     if (src_ds3_ctrl->delay_base == 0) {
         return SRC_FF3_ERROR;
@@ -75,6 +98,10 @@ src_ff3_return_code_t src_ds3_init(src_ds3_ctrl_t* src_ds3_ctrl)
     src_ds3_ctrl->inner_loops     = (SRC_FF3_DS3_N_COEFS>>1) / SRC_FF3_N_LOOPS_PER_ASM;        // Right shift to 2 x 32bits read for coefs per inner loop
     src_ds3_ctrl->num_coeffs      = SRC_FF3_DS3_N_COEFS;
     src_ds3_ctrl->coeffs          = src_ds3_coeffs;
+#if !defined(__xcore__)
+    src_isa_get_kernels(SRC_KERNEL_FF3, src_ds3_ctrl->inner_loop);
+    src_ds3_ctrl->delay_unmirrored  = 0;
+#endif
 
     // Sync the FIRDS3
     if (src_ds3_sync(src_ds3_ctrl) != SRC_FF3_NO_ERROR) {
@@ -102,41 +129,89 @@ src_ff3_return_code_t src_ds3_proc(src_ds3_ctrl_t* src_ds3_ctrl)
     int*            data;
     int*            coeffs;
     int             data0;
-    __int64_t       accumulator;
 
-    // Get three new data samples to delay line (double write for circular buffer simulation)
-    data0                    = *src_ds3_ctrl->in_data;
-    *src_ds3_ctrl->delay_pos                                       = data0;
-    *(src_ds3_ctrl->delay_pos + src_ds3_ctrl->delay_offset)        = data0;
+    // Get three new data samples to delay line (double write for circular buffer simulation,
+    // only the second one if the delay line is mirrored)
+    if (SRC_FF3_DS3_DELAY_MIRRORED(src_ds3_ctrl)) {
+        *(src_ds3_ctrl->delay_pos + src_ds3_ctrl->delay_offset)        = *src_ds3_ctrl->in_data;
+        *(src_ds3_ctrl->delay_pos + src_ds3_ctrl->delay_offset + 1)    = *(src_ds3_ctrl->in_data + 1);
+        *(src_ds3_ctrl->delay_pos + src_ds3_ctrl->delay_offset + 2)    = *(src_ds3_ctrl->in_data + 2);
+    } else {
+        data0                    = *src_ds3_ctrl->in_data;
+        *src_ds3_ctrl->delay_pos                                       = data0;
+        *(src_ds3_ctrl->delay_pos + src_ds3_ctrl->delay_offset)        = data0;
 
-    data0                    = *(src_ds3_ctrl->in_data + 1);
-    *(src_ds3_ctrl->delay_pos + 1)                                 = data0;
-    *(src_ds3_ctrl->delay_pos + src_ds3_ctrl->delay_offset + 1)    = data0;
+        data0                    = *(src_ds3_ctrl->in_data + 1);
+        *(src_ds3_ctrl->delay_pos + 1)                                 = data0;
+        *(src_ds3_ctrl->delay_pos + src_ds3_ctrl->delay_offset + 1)    = data0;
 
-    data0                    = *(src_ds3_ctrl->in_data + 2);
-    *(src_ds3_ctrl->delay_pos + 2)                                 = data0;
-    *(src_ds3_ctrl->delay_pos + src_ds3_ctrl->delay_offset + 2)    = data0;
+        data0                    = *(src_ds3_ctrl->in_data + 2);
+        *(src_ds3_ctrl->delay_pos + 2)                                 = data0;
+        *(src_ds3_ctrl->delay_pos + src_ds3_ctrl->delay_offset + 2)    = data0;
+    }
 
     // Step delay with circular simulation (will also rewrite to control structure for next round)
     // Note as delay line length is a multiple of 3 (because filter coefficients length is a multiple of 3)
-    // we only have to do the wrap around check after having written 3 input samples
+    // we only have to do the wrap around check after having written 3 input samples. A mirrored ring
+    // is a whole number of pages, which is not, so the wrap keeps the remainder
     src_ds3_ctrl->delay_pos += 3;
     if (src_ds3_ctrl->delay_pos >= src_ds3_ctrl->delay_wrap) {
-        src_ds3_ctrl->delay_pos = src_ds3_ctrl->delay_base;
+        src_ds3_ctrl->delay_pos -= src_ds3_ctrl->delay_wrap - src_ds3_ctrl->delay_base;
     }
 
-    // Clear accumulator and set access pointers
+    // Set access pointers
     data                    = src_ds3_ctrl->delay_pos;
     coeffs                  = src_ds3_ctrl->coeffs;
-    accumulator             = 0;
-    if ((unsigned)data & 0b0100) {
+#if !defined(__xcore__)
+    src_ds3_ctrl->inner_loop[SRC_ISA_PARITY(data)](data, coeffs, &data0, src_ds3_ctrl->inner_loops);
+#else
+    if ((uintptr_t)data & 0b0100) {
         src_ff3_fir_inner_loop_asm_odd(data, coeffs, &data0, src_ds3_ctrl->inner_loops);
     } else {
         src_ff3_fir_inner_loop_asm(data, coeffs, &data0, src_ds3_ctrl->inner_loops);
     }
+#endif
 
     *src_ds3_ctrl->out_data = data0;
 
     return SRC_FF3_NO_ERROR;
 }
 
+#if !defined(__xcore__)
+src_ff3_return_code_t src_ds3_init_mirrored_delay(src_ds3_ctrl_t* src_ds3_ctrl)
+{
+    unsigned int    length;
+    int*            ring;
+
+    if (src_ds3_ctrl->delay_unmirrored != 0) {
+        return SRC_FF3_NO_ERROR;
+    }
+    ring = src_mirror_delay_line(src_ds3_ctrl->delay_pos, src_ds3_ctrl->delay_offset, &length);
+    if (ring == 0) {
+        return SRC_FF3_ERROR;
+    }
+
+    src_ds3_ctrl->delay_unmirrored  = src_ds3_ctrl->delay_base;
+    src_ds3_ctrl->delay_base        = ring;
+    src_ds3_ctrl->delay_len         = length;
+    src_ds3_ctrl->delay_pos         = ring;
+    src_ds3_ctrl->delay_wrap        = ring + length;
+
+    return SRC_FF3_NO_ERROR;
+}
+
+void src_ds3_exit_mirrored_delay(src_ds3_ctrl_t* src_ds3_ctrl)
+{
+    if (src_ds3_ctrl->delay_unmirrored == 0) {
+        return;
+    }
+    src_unmirror_delay_line(src_ds3_ctrl->delay_base, src_ds3_ctrl->delay_len, src_ds3_ctrl->delay_pos,
+                            src_ds3_ctrl->delay_offset, src_ds3_ctrl->delay_unmirrored);
+
+    src_ds3_ctrl->delay_base        = src_ds3_ctrl->delay_unmirrored;
+    src_ds3_ctrl->delay_len         = src_ds3_ctrl->delay_offset<<1;
+    src_ds3_ctrl->delay_pos         = src_ds3_ctrl->delay_base;
+    src_ds3_ctrl->delay_wrap        = src_ds3_ctrl->delay_base + src_ds3_ctrl->delay_offset;
+    src_ds3_ctrl->delay_unmirrored  = 0;
+}
+#endif
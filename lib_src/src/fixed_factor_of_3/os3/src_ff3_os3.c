@@ -22,6 +22,10 @@
 #include "src.h"
 #include "src_ff3_os3.h"
 #include "src_ff3_fir_inner_loop_asm.h"
+#if !defined(__xcore__)
+#include "src_mrhf_isa.h"
+#include "src_mrhf_mirror.h"
+#endif
 
 // ===========================================================================
 //
@@ -32,6 +36,13 @@
 // State init value
 #define        SRC_OS3_STATE_INIT                        0
 
+// (on host) A mirrored delay line only takes the second of the two writes, see src_mrhf_mirror.h
+#if !defined(__xcore__)
+#define        SRC_OS3_DELAY_MIRRORED(ctrl)              ((ctrl)->delay_unmirrored != 0)
+#else
+#define        SRC_OS3_DELAY_MIRRORED(ctrl)              0
+#endif
+
 // ===========================================================================
 //
 // Variables
@@ -50,6 +61,18 @@ int                    src_os3_coeffs[SRC_FF3_OS3_N_COEFS]     = {
 
 src_ff3_return_code_t src_os3_init(src_os3_ctrl_t* src_os3_ctrl)
 {
+#if !defined(__xcore__)
+    // Unmap a ring left by src_os3_init_mirrored_delay(), and go back to the delay line it replaced
+    // if the base is still the ring. The wrap of a mirrored ring is at its end
+    if (src_os3_ctrl->delay_unmirrored != 0) {
+        int*    ring = (int*)((uintptr_t)src_os3_ctrl->delay_wrap - (uintptr_t)src_os3_ctrl->delay_len * sizeof(int));
+
+        if (src_mirror_release(ring) && (src_os3_ctrl->delay_base == ring)) {
+            src_os3_ctrl->delay_base  = src_os3_ctrl->delay_unmirrored;
+        }
+    }
+#endif
+
     // Check that delay line base has been set
     if (src_os3_ctrl->delay_base == 0) {
         return SRC_FF3_ERROR;
@@ -62,6 +85,10 @@ src_ff3_return_code_t src_os3_init(src_os3_ctrl_t* src_os3_ctrl)
     src_os3_ctrl->inner_loops       = ((SRC_FF3_OS3_N_COEFS/SRC_FF3_OS3_N_PHASES)>>1) / SRC_FF3_N_LOOPS_PER_ASM;    // Right shift due to 2 x 32bits read for coefs per inner loop and x3 over-sampler, so only 1/3rd of coefs length needed
     src_os3_ctrl->num_coeffs        = SRC_FF3_OS3_N_COEFS;
     src_os3_ctrl->coeffs            = src_os3_coeffs;
+#if !defined(__xcore__)
+    src_isa_get_kernels(SRC_KERNEL_FF3, src_os3_ctrl->inner_loop);
+    src_os3_ctrl->delay_unmirrored  = 0;
+#endif
 
     // Sync the FIROS3
     if (src_os3_sync(src_os3_ctrl) != SRC_FF3_NO_ERROR) {
@@ -90,8 +117,10 @@ src_ff3_return_code_t src_os3_sync(src_os3_ctrl_t* src_os3_ctrl)
 src_ff3_return_code_t src_os3_input(src_os3_ctrl_t* src_os3_ctrl)
 {
     // Write new input sample from control structure to delay line
-    // at both positions for circular buffer simulation
-    *src_os3_ctrl->delay_pos                                     = src_os3_ctrl->in_data;
+    // at both positions for circular buffer simulation (only the second one if the delay line is mirrored)
+    if (!SRC_OS3_DELAY_MIRRORED(src_os3_ctrl)) {
+        *src_os3_ctrl->delay_pos                                 = src_os3_ctrl->in_data;
+    }
     *(src_os3_ctrl->delay_pos + src_os3_ctrl->delay_offset)      = src_os3_ctrl->in_data;
 
     // Step delay index with circular buffer simulation
@@ -108,18 +137,20 @@ src_ff3_return_code_t                src_os3_proc(src_os3_ctrl_t* src_os3_ctrl)
     int*          data;
     int*          coeffs;
     int           data0;
-    __int64_t     accumulator;
 
-    // Clear accumulator and set data/coefs access pointers
+    // Set data/coefs access pointers
     data            = src_os3_ctrl->delay_pos;
     coeffs          = src_os3_ctrl->coeffs + src_os3_ctrl->phase;
-    accumulator     = 0;
 
-    if ((unsigned)data & 0b0100) {
+#if !defined(__xcore__)
+    src_os3_ctrl->inner_loop[SRC_ISA_PARITY(data)](data, coeffs, &data0, src_os3_ctrl->inner_loops);
+#else
+    if ((uintptr_t)data & 0b0100) {
         src_ff3_fir_inner_loop_asm_odd(data, coeffs, &data0, src_os3_ctrl->inner_loops);
     } else {
         src_ff3_fir_inner_loop_asm(data, coeffs, &data0, src_os3_ctrl->inner_loops);
     }
+#endif
 
     // Write output
     src_os3_ctrl->out_data = data0;
@@ -133,3 +164,41 @@ src_ff3_return_code_t                src_os3_proc(src_os3_ctrl_t* src_os3_ctrl)
     return SRC_FF3_NO_ERROR;
 }
 
+#if !defined(__xcore__)
+src_ff3_return_code_t src_os3_init_mirrored_delay(src_os3_ctrl_t* src_os3_ctrl)
+{
+    unsigned int    length;
+    int*            ring;
+
+    if (src_os3_ctrl->delay_unmirrored != 0) {
+        return SRC_FF3_NO_ERROR;
+    }
+    ring = src_mirror_delay_line(src_os3_ctrl->delay_pos, src_os3_ctrl->delay_offset, &length);
+    if (ring == 0) {
+        return SRC_FF3_ERROR;
+    }
+
+    src_os3_ctrl->delay_unmirrored  = src_os3_ctrl->delay_base;
+    src_os3_ctrl->delay_base        = ring;
+    src_os3_ctrl->delay_len         = length;
+    src_os3_ctrl->delay_pos         = ring;
+    src_os3_ctrl->delay_wrap        = ring + length;
+
+    return SRC_FF3_NO_ERROR;
+}
+
+void src_os3_exit_mirrored_delay(src_os3_ctrl_t* src_os3_ctrl)
+{
+    if (src_os3_ctrl->delay_unmirrored == 0) {
+        return;
+    }
+    src_unmirror_delay_line(src_os3_ctrl->delay_base, src_os3_ctrl->delay_len, src_os3_ctrl->delay_pos,
+                            src_os3_ctrl->delay_offset, src_os3_ctrl->delay_unmirrored);
+
+    src_os3_ctrl->delay_base        = src_os3_ctrl->delay_unmirrored;
+    src_os3_ctrl->delay_len         = src_os3_ctrl->delay_offset<<1;
+    src_os3_ctrl->delay_pos         = src_os3_ctrl->delay_base;
+    src_os3_ctrl->delay_wrap        = src_os3_ctrl->delay_base + src_os3_ctrl->delay_offset;
+    src_os3_ctrl->delay_unmirrored  = 0;
+}
+#endif
@@ -0,0 +1,60 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Fixed factor of 3 FIR inner loop C implementation for non-xcore (host)
+// targets. Bit-exact with src_ff3_fir_inner_loop_asm.S: 32x32->64 MACCS
+// accumulation followed by LSATS/LEXTRACT at bit 31.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+#include <stdint.h>
+
+#include "src_ff3_fir_inner_loop_asm.h"
+
+#define     SRC_FF3_MAX_VAL64_30    ((long long)0x3FFFFFFFFFFFFFFF)
+#define     SRC_FF3_MIN_VAL64_30    ((long long)0xC000000000000000)
+
+// ==================================================================== //
+// Function:        src_ff3_fir_inner_loop_asm                          //
+// Arguments:       int *piData: Pointer to delay line                  //
+//                  int *piCoefs: Pointer to coefficients               //
+//                  int iData[]: Result (iData[0])                      //
+//                  int count: Number of 24-tap loops                   //
+// Return values:   None                                                //
+// Description:     Computes one FF3 FIR output sample                  //
+// ==================================================================== //
+void src_ff3_fir_inner_loop_asm(int *piData, int *piCoefs, int iData[], int count)
+{
+    // Wrapping 64 bit accumulation, as MACCS does not saturate
+    uint64_t        u64Acc      = 0;
+    int             iNTaps      = count * (SRC_FF3_N_LOOPS_PER_ASM << 1);
+    long long       i64Acc;
+    int             i;
+
+    for(i = 0; i < iNTaps; i++)
+        u64Acc += (uint64_t)((long long)piData[i] * (long long)piCoefs[i]);
+
+    i64Acc = (long long)u64Acc;
+    if(i64Acc > SRC_FF3_MAX_VAL64_30)
+        i64Acc = SRC_FF3_MAX_VAL64_30;
+    if(i64Acc < SRC_FF3_MIN_VAL64_30)
+        i64Acc = SRC_FF3_MIN_VAL64_30;
+    iData[0]        = (int)(i64Acc >> 31);
+}
+
+// ==================================================================== //
+// Function:        src_ff3_fir_inner_loop_asm_odd                      //
+// Description:     As src_ff3_fir_inner_loop_asm. The even/odd split   //
+//                  only matters for xcore double-word loads            //
+// ==================================================================== //
+void src_ff3_fir_inner_loop_asm_odd(int *piData, int *piCoefs, int iData[], int count)
+{
+    src_ff3_fir_inner_loop_asm(piData, piCoefs, iData, count);
+}
+
+#endif // !__xcore__
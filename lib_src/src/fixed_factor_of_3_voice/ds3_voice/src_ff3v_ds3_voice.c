@@ -0,0 +1,25 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// Host (non-xcore) implementation of src_ff3v_ds3_voice.S
+#if !defined(__xcore__)
+
+#include <stdint.h>
+
+#include "src.h"
+#include "src_ff3v_fir_impl.h"
+
+int64_t src_ds3_voice_add_sample(int64_t sum, int32_t data[],
+                                 const int32_t coefs[], int32_t sample)
+{
+    return src_ff3v_fir_impl(sum, data, coefs, sample);
+}
+
+int64_t src_ds3_voice_add_final_sample(int64_t sum, int32_t data[],
+                                       const int32_t coefs[], int32_t sample)
+{
+    sum = src_ff3v_fir_impl(sum, data, coefs, sample);
+    // The assembler clears r1, so the result is not sign extended
+    return (int64_t)(uint32_t)src_ff3v_fir_comp(sum, src_ff3v_fir_comp_ds, src_ff3v_fir_comp_q_ds);
+}
+
+#endif // !__xcore__
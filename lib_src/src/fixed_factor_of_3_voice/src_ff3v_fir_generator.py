@@ -71,6 +71,29 @@ extern const int32_t (*src_ff3v_fir_coefs_c)[SRC_FF3V_FIR_TAPS_PER_PHASE];
         header_file.writelines(header_template % {'taps_per_phase':num_taps_per_phase,
                                                   'phases':num_phases})
 
+def format_coefs(taps):
+    coefs_debug = ''
+    i = 1
+    for c in taps:
+        coefs_debug += (' ' + str(int(c*(2**31 - 1))).rjust(12) + ',')
+        if ((i % 6) == 0):
+            coefs_debug += '\n'
+        i+=1
+
+    coefs = ''
+
+    for step in range(num_phases-1, -1, -1):
+        i = 1
+        coefs += '    {\n    '
+        for j in range(step, len(taps), num_phases):
+            coefs += ' ' + str(int(taps[j]*(2**31 - 1))).rjust(12)  + ','
+            if ((i % 6) == 0):
+                coefs += '\n    '
+            i+=1
+        coefs += '},\n'
+
+    return coefs_debug, coefs
+
 def generate_xc_file(q_ds, q_us, comp_ds, comp_us, taps):
     xc_template = """\
 // Copyright (c) 2016-2021, XMOS Ltd, All rights reserved
@@ -111,25 +134,7 @@ unsafe {
 const int32_t (*src_ff3v_fir_coefs_xc)[SRC_FF3V_FIR_TAPS_PER_PHASE] = src_ff3v_fir_coefs_i;
 """
 
-    coefs_debug = ''
-    i = 1
-    for c in taps:
-        coefs_debug += (' ' + str(int(c*(2**31 - 1))).rjust(12) + ',')
-        if ((i % 6) == 0):
-            coefs_debug += '\n'
-        i+=1
-
-    coefs = ''
-
-    for step in range(num_phases-1, -1, -1):
-        i = 1
-        coefs += '    {\n    '
-        for j in range(step, len(taps), num_phases):
-            coefs += ' ' + str(int(taps[j]*(2**31 - 1))).rjust(12)  + ','
-            if ((i % 6) == 0):
-                coefs += '\n    '
-            i+=1
-        coefs += '},\n'
+    coefs_debug, coefs = format_coefs(taps)
 
     xc_path = os.path.join(os.path.dirname(os.path.realpath(__file__)),
                                'src_ff3v_fir.xc')
@@ -142,6 +147,60 @@ const int32_t (*src_ff3v_fir_coefs_xc)[SRC_FF3V_FIR_TAPS_PER_PHASE] = src_ff3v_f
                                           'coefs_debug':coefs_debug,
                                           'coefs':coefs})
 
+def generate_c_file(q_ds, q_us, comp_ds, comp_us, taps):
+    c_template = """\
+// Copyright (c) 2016-2024, XMOS Ltd, All rights reserved
+//
+// This file is generated using src_ff3v_fir_generator.py
+//
+// Do not modify it directly, changes may be overwritten!
+//
+
+// Host (non-xcore) copy of the tables in src_ff3v_fir.xc
+#if !defined(__xcore__)
+
+#include "src_ff3v_fir.h"
+#include <stdint.h>
+
+/** Used for FIR compensation for decimation*/
+const unsigned src_ff3v_fir_comp_q_ds = %(comp_q_ds)s;
+
+/** Used for FIR compensation for decimation*/
+const int32_t src_ff3v_fir_comp_ds = %(comp_ds)s;
+
+/** Used for FIR compensation for upsampling*/
+const unsigned src_ff3v_fir_comp_q_us = %(comp_q_us)s;
+
+/** Used for FIR compensation for upsampling*/
+const int32_t src_ff3v_fir_comp_us = %(comp_us)s;
+
+/** Used for self testing src_ds3_voice and src_us3_voice functionality */
+int32_t src_ff3v_fir_coefs_debug[SRC_FF3V_FIR_NUM_PHASES * SRC_FF3V_FIR_TAPS_PER_PHASE] = {
+%(coefs_debug)s
+};
+
+/** Coefficients for use with src_ds3_voice and src_us3_voice functions */
+static const int32_t src_ff3v_fir_coefs_i[SRC_FF3V_FIR_NUM_PHASES][SRC_FF3V_FIR_TAPS_PER_PHASE] __attribute__((aligned(8))) = {
+%(coefs)s};
+
+const int32_t (*src_ff3v_fir_coefs_c)[SRC_FF3V_FIR_TAPS_PER_PHASE] = src_ff3v_fir_coefs_i;
+
+#endif // !__xcore__
+"""
+
+    coefs_debug, coefs = format_coefs(taps)
+
+    c_path = os.path.join(os.path.dirname(os.path.realpath(__file__)),
+                               'src_ff3v_fir.c')
+    with open(c_path, "w") as c_file:
+
+        c_file.writelines(c_template % {'comp_q_ds':str(q_ds),
+                                        'comp_ds':str(comp_ds),
+                                        'comp_q_us':str(q_us),
+                                        'comp_us':str(comp_us),
+                                        'coefs_debug':coefs_debug,
+                                        'coefs':coefs})
+
 # Low-pass filter design parameters
 fs = 48000.0        # Sample rate, Hz
 num_phases = 3
@@ -165,4 +224,5 @@ if __name__ == "__main__":
     # plot_response_passband(fs, w, h, "Low-pass Filter")
     generate_header_file(num_taps_per_phase, num_phases)
     generate_xc_file(q_ds, q_us, comp_ds, comp_us, taps)
+    generate_c_file(q_ds, q_us, comp_ds, comp_us, taps)
 
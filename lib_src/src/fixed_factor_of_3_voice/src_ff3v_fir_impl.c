@@ -0,0 +1,93 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Host (non-xcore) implementation of src_ff3v_fir.S. The assembler shifts
+// the new sample into the 24 sample delay line two taps at a time and
+// accumulates coefs[i] * data[i] over the updated delay line with MACCS.
+// The 64 bit sum wraps, so the order of the products does not matter and
+// the AVX2 version gives the same result.
+//
+// The AVX2 version is used if the CPU supports it and src_isa_force() does
+// not rule it out, looked up at each call as there is no init function.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+#include <stdint.h>
+#include <string.h>
+
+#include "src_ff3v_fir.h"
+#include "src_ff3v_fir_impl.h"
+#include "src_mrhf_isa.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+int64_t src_ff3v_fir_dot_c(int64_t sum, const int32_t data[], const int32_t coefs[])
+{
+    uint64_t acc = (uint64_t)sum;
+
+    for (unsigned i = 0; i < SRC_FF3V_FIR_TAPS_PER_PHASE; i++) {
+        acc += (uint64_t)((int64_t)coefs[i] * data[i]);
+    }
+    return (int64_t)acc;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2")))
+int64_t src_ff3v_fir_dot_avx2(int64_t sum, const int32_t data[], const int32_t coefs[])
+{
+    __m256i acc = _mm256_setzero_si256();
+    uint64_t lanes[4];
+
+    // _mm256_mul_epi32 takes the low word of each 64 bit lane, so logical shifts pick the odd taps
+    for (unsigned i = 0; i < SRC_FF3V_FIR_TAPS_PER_PHASE; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)&data[i]);
+        __m256i c = _mm256_loadu_si256((const __m256i *)&coefs[i]);
+
+        acc = _mm256_add_epi64(acc, _mm256_mul_epi32(d, c));
+        acc = _mm256_add_epi64(acc, _mm256_mul_epi32(_mm256_srli_epi64(d, 32), _mm256_srli_epi64(c, 32)));
+    }
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    return (int64_t)((uint64_t)sum + lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+#endif
+
+static inline int64_t src_ff3v_fir_dot(int64_t sum, const int32_t data[], const int32_t coefs[])
+{
+    return src_isa_get_kernels_voice()->pfFF3VDot(sum, data, coefs);
+}
+
+int64_t src_ff3v_fir_impl(int64_t sum, int32_t data[], const int32_t coefs[], int32_t sample)
+{
+    memmove(&data[1], &data[0], (SRC_FF3V_FIR_TAPS_PER_PHASE - 1) * sizeof(int32_t));
+    data[0] = sample;
+    return src_ff3v_fir_dot(sum, data, coefs);
+}
+
+int64_t src_ff3v_fir_taps(int64_t sum, const int32_t data[], const int32_t coefs[])
+{
+    return src_ff3v_fir_dot(sum, data, coefs);
+}
+
+int32_t src_ff3v_fir_comp(int64_t sum, int32_t comp, unsigned q)
+{
+    // lextract at bit 31, maccs into a cleared accumulator
+    int64_t acc = (int64_t)(int32_t)(uint32_t)((uint64_t)sum >> 31) * comp;
+    int64_t max = (int64_t)((1ULL << (q + 31)) - 1);
+
+    // lsats, lextract at bit q
+    if (acc > max) {
+        acc = max;
+    } else if (acc < -max - 1) {
+        acc = -max - 1;
+    }
+    return (int32_t)(acc >> q);
+}
+
+#endif // !__xcore__
@@ -0,0 +1,56 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+#ifndef _SRC_FF3V_FIR_IMPL_H_
+#define _SRC_FF3V_FIR_IMPL_H_
+
+#if !defined(__xcore__)
+
+#include <stdint.h>
+
+/** Host (non-xcore) equivalents of src_ff3v_fir.S and the tail of the voice
+ *  functions in ds3_voice/ and us3_voice/. All arithmetic follows the MACCS,
+ *  LSATS and LEXTRACT sequences of the assembler, so results are bit-exact.
+ */
+
+/** Adds the dot product of one phase of coefficients and the delay line to
+ *  a 64 bit accumulator, wrapping on overflow as MACCS does.
+ *
+ *  \param      sum      Accumulator
+ *  \param      data     Delay line, SRC_FF3V_FIR_TAPS_PER_PHASE samples
+ *  \param      coefs    One phase of FIR filter coefficients
+ *  \returns    The updated accumulator
+ *
+ *  \note src_ff3v_fir_dot_avx2() may only be called if the CPU supports AVX2
+ */
+int64_t src_ff3v_fir_dot_c(int64_t sum, const int32_t data[], const int32_t coefs[]);
+#if defined(__x86_64__) || defined(__i386__)
+int64_t src_ff3v_fir_dot_avx2(int64_t sum, const int32_t data[], const int32_t coefs[]);
+#endif
+
+/** Shifts sample into the delay line, then accumulates as src_ff3v_fir_dot_c(),
+ *  using the dot product src_isa_get_kernels_voice() gives.
+ *
+ *  \param      sum      Accumulator
+ *  \param      data     Delay line
+ *  \param      coefs    One phase of FIR filter coefficients
+ *  \param      sample   The newest sample
+ *  \returns    The updated accumulator
+ */
+int64_t src_ff3v_fir_impl(int64_t sum, int32_t data[], const int32_t coefs[], int32_t sample);
+
+/** As src_ff3v_fir_impl(), without updating the delay line */
+int64_t src_ff3v_fir_taps(int64_t sum, const int32_t data[], const int32_t coefs[]);
+
+/** Extracts bits 31..62 of the accumulator and applies the compensation
+ *  factor with saturation, as the epilogue of the voice functions does.
+ *
+ *  \param      sum      Accumulator
+ *  \param      comp     Compensation factor, src_ff3v_fir_comp_ds or src_ff3v_fir_comp_us
+ *  \param      q        Q format of comp, src_ff3v_fir_comp_q_ds or src_ff3v_fir_comp_q_us
+ *  \returns    The output sample
+ */
+int32_t src_ff3v_fir_comp(int64_t sum, int32_t comp, unsigned q);
+
+#endif // !__xcore__
+
+#endif // _SRC_FF3V_FIR_IMPL_H_
@@ -0,0 +1,24 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// Host (non-xcore) implementation of src_ff3v_us3_voice.S
+#if !defined(__xcore__)
+
+#include <stdint.h>
+
+#include "src.h"
+#include "src_ff3v_fir_impl.h"
+
+int32_t src_us3_voice_input_sample(int32_t data[], const int32_t coefs[],
+                                   int32_t sample)
+{
+    int64_t sum = src_ff3v_fir_impl(0, data, coefs, sample);
+    return src_ff3v_fir_comp(sum, src_ff3v_fir_comp_us, src_ff3v_fir_comp_q_us);
+}
+
+int32_t src_us3_voice_get_next_sample(int32_t data[], const int32_t coefs[])
+{
+    int64_t sum = src_ff3v_fir_taps(0, data, coefs);
+    return src_ff3v_fir_comp(sum, src_ff3v_fir_comp_us, src_ff3v_fir_comp_q_us);
+}
+
+#endif // !__xcore__
@@ -0,0 +1,109 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Host (non-xcore) implementation of the VPU voice primitives in asm/.
+// Bit-exact with the XS3 VPU in 32 bit mode, where each VLMACCR adds
+//   sum_k (coef[k] * samples[k] + 2^29) >> 30
+// over 8 taps into a 40 bit accumulator, and the result is the wrapping
+// 32 bit sum of the low words of the accumulators. 8 rounded products can
+// not overflow 40 bits, so only the low 32 bits of each term matter.
+//
+// The AVX2 version is used if the CPU supports it and src_isa_force() does
+// not rule it out, looked up at each call as there is no init function.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+#include <stdint.h>
+#include <string.h>
+
+#include "src_low_level.h"
+#include "src_mrhf_isa.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+int32_t conv_s32_nt_c(const int32_t * samples, const int32_t * coef, unsigned n_taps)
+{
+    uint32_t acc = 0;
+
+    for (unsigned i = 0; i < n_taps; i++) {
+        acc += (uint32_t)(((int64_t)samples[i] * coef[i] + (1 << 29)) >> 30);
+    }
+    return (int32_t)acc;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2")))
+int32_t conv_s32_nt_avx2(const int32_t * samples, const int32_t * coef, unsigned n_taps)
+{
+    const __m256i round = _mm256_set1_epi64x(1 << 29);
+    __m256i acc = _mm256_setzero_si256();
+    uint64_t lanes[4];
+
+    // Logical shifts are fine, only the low 32 bits of each rounded product are kept
+    for (unsigned i = 0; i < n_taps; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)&samples[i]);
+        __m256i c = _mm256_loadu_si256((const __m256i *)&coef[i]);
+        __m256i even = _mm256_mul_epi32(s, c);
+        __m256i odd  = _mm256_mul_epi32(_mm256_srli_epi64(s, 32), _mm256_srli_epi64(c, 32));
+
+        acc = _mm256_add_epi64(acc, _mm256_srli_epi64(_mm256_add_epi64(even, round), 30));
+        acc = _mm256_add_epi64(acc, _mm256_srli_epi64(_mm256_add_epi64(odd, round), 30));
+    }
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    return (int32_t)(uint32_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+#endif
+
+static inline int32_t conv_s32_nt(const int32_t * samples, const int32_t * coef, unsigned n_taps)
+{
+    return src_isa_get_kernels_voice()->pfConvS32(samples, coef, n_taps);
+}
+
+// Shift the state up by one sample, as the vldr/vstr sequence in the assembler does
+static inline void push_s32(int32_t * state, int32_t new_samp, unsigned n_taps)
+{
+    memmove(&state[1], &state[0], (n_taps - 1) * sizeof(int32_t));
+    state[0] = new_samp;
+}
+
+int32_t conv_s32_24t(const int32_t * samples, const int32_t * coef)
+{
+    return conv_s32_nt(samples, coef, 24);
+}
+
+int32_t fir_s32_24t(int32_t * state, const int32_t * coef, int32_t new_samp)
+{
+    push_s32(state, new_samp, 24);
+    return conv_s32_nt(state, coef, 24);
+}
+
+int32_t conv_s32_32t(const int32_t * samples, const int32_t * coef)
+{
+    return conv_s32_nt(samples, coef, 32);
+}
+
+int32_t fir_s32_32t(int32_t * state, const int32_t * coef, int32_t new_samp)
+{
+    push_s32(state, new_samp, 32);
+    return conv_s32_nt(state, coef, 32);
+}
+
+void push_s32_48t(int32_t * state, int32_t new_samp)
+{
+    push_s32(state, new_samp, 48);
+}
+
+int32_t fir_s32_48t(int32_t * state, const int32_t * coef, int32_t new_samp)
+{
+    push_s32(state, new_samp, 48);
+    return conv_s32_nt(state, coef, 48);
+}
+
+#endif // !__xcore__
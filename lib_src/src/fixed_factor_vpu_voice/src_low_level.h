@@ -4,6 +4,8 @@
 #ifndef _SRC_LOW_LEVEL_H_
 #define _SRC_LOW_LEVEL_H_
 
+#include <stdint.h>
+
 /**
  * @brief Perfoms VPU-optimised convolution for s32 type integers
  * 
@@ -67,4 +69,19 @@ void push_s32_48t(int32_t * state, int32_t new_samp);
  */
 int32_t fir_s32_48t(int32_t * state, const int32_t * coef, int32_t new_samp);
 
+#if !defined(__xcore__)
+/**
+ * @brief Host only: convolution with the VPU rounding, used by all the functions above
+ *
+ * @param samples   Samples array
+ * @param coef      FIR coefficients array
+ * @param n_taps    Number of taps, a multiple of 8
+ * @note conv_s32_nt_avx2() may only be called if the CPU supports AVX2
+ */
+int32_t conv_s32_nt_c(const int32_t * samples, const int32_t * coef, unsigned n_taps);
+#if defined(__x86_64__) || defined(__i386__)
+int32_t conv_s32_nt_avx2(const int32_t * samples, const int32_t * coef, unsigned n_taps);
+#endif
+#endif
+
 #endif // _SRC_LOW_LEVEL_H_
@@ -127,8 +127,8 @@
 
 #define        ASRC_FS_RATIO_MIN_FACTOR                (0.99)
 #define        ASRC_FS_RATIO_MAX_FACTOR                (1.01)
-
-#define        ASRC_ADFIR_INITIAL_PHASE                32
+#define        ASRC_FS_RATIO_MIN_PERCENT               99                        // As above, for planned rates
+#define        ASRC_FS_RATIO_MAX_PERCENT               101
 
 // Time ratio shift values
 #define        ASRC_FS_RATIO_PHASE_N_BITS                7
@@ -136,6 +136,18 @@
 #define        ASRC_FS_RATIO_SHIFT_M1                    (ASRC_FS_RATIO_BASE_SHIFT + 1)
 #define        ASRC_FS_RATIO_SHIFT_0                    (ASRC_FS_RATIO_BASE_SHIFT)
 #define        ASRC_FS_RATIO_SHIFT_P1                    (ASRC_FS_RATIO_BASE_SHIFT - 1)
+#define        ASRC_FS_RATIO_SHIFT_M2                    (ASRC_FS_RATIO_BASE_SHIFT + 2)            // F0 and F1 both halve the rate (host only)
+
+// Filters designed by ASRC_plan_rates (host only), with edges relative to Fsout. Anything above the
+// stopband edge would alias above the passband edge, which is that of the filters of the tables. The
+// synchronous rate is kept between ASRC_PLAN_MIN_SYNC_RATIO and twice that times Fsout: F3 is flat to
+// 0.01dB up to 0.23 times its input rate, and at twice that the low-pass filter is ASRC_PLAN_MAX_TAPS long
+#define        ASRC_PLAN_PASSBAND                        0.45
+#define        ASRC_PLAN_STOPBAND                        0.55
+#define        ASRC_PLAN_ATTENUATION_DB                  105.0
+#define        ASRC_PLAN_MIN_SYNC_RATIO                  1.96
+#define        ASRC_PLAN_TAPS_MULTIPLE                   16                        // As the host FIR inner loops need
+#define        ASRC_PLAN_MAX_HALVINGS                    2                         // By F1, then F0 too
 
 
 // Random number generator / dithering
@@ -269,6 +281,40 @@ ASRCFsRatioConfigs_t		sFsRatioConfigs[ASRC_N_FS][ASRC_N_FS] =				// Fs ratio con
 		{ASRC_FS_RATIO_192_192,	ASRC_FS_RATIO_192_192_LO,		(unsigned int)(ASRC_FS_RATIO_192_192 * ASRC_FS_RATIO_MIN_FACTOR),		(unsigned int)(ASRC_FS_RATIO_192_192 * ASRC_FS_RATIO_MAX_FACTOR),		ASRC_FS_RATIO_SHIFT_P1}			// Fsout = 192kHz
 	}
 };
+// Rates of the Fs codes in Hz
+static const unsigned int   uiASRCFsHz[ASRC_N_FS] = {44100, 48000, 88200, 96000, 176400, 192000};
+
+// Template rate pairs for ASRC_plan_rates, by increasing Fs ratio (Fsin / Fsout). The filters of each
+// are specified relative to the rates, so they give any pair with an Fs ratio up to that of the
+// template the same alias rejection, and the same passband relative to Fsin. Where the tables use
+// shorter filters that rely on the audio band being well below Nyquist (Fsin = 176.4/192kHz), the
+// template is the pair that uses the full band filter
+#define     ASRC_N_PLAN_TEMPLATES           8
+static const ASRCFs_t       eASRCPlanTemplates[ASRC_N_PLAN_TEMPLATES][2] =
+{
+    // Fsin         Fsout
+    {ASRC_FS_44,    ASRC_FS_44},        // Up to 1:         F1 = UP
+    {ASRC_FS_48,    ASRC_FS_44},        // Up to 1.088:     F1 = UP4844
+    {ASRC_FS_88,    ASRC_FS_48},        // Up to 1.8375:    F1 = BL8848
+    {ASRC_FS_88,    ASRC_FS_44},        // Up to 2:         F1 = BL
+    {ASRC_FS_96,    ASRC_FS_44},        // Up to 2.177:     F1 = BL9644
+    {ASRC_FS_176,   ASRC_FS_48},        // Up to 3.675:     F1 = DS, F2 = BL8848
+    {ASRC_FS_176,   ASRC_FS_44},        // Up to 4:         F1 = DS, F2 = BL
+    {ASRC_FS_192,   ASRC_FS_44}         // Up to 4.354:     F1 = DS, F2 = BL9644
+};
+
+#ifndef __xcore__
+// Quality tiers, set by ASRC_set_quality. The F3 phases keep FILTER_DEFS_ADFIR_PHASE_N_TAPS taps, as the
+// spline and macc loops are written for them, and the number of phases sets the F3 time resolution.
+// There is no higher tier: 256 phases and longer F1/F2 filters measured no better, see the programming guide
+static const ASRCQualityConfigs_t   sASRCQualityConfigs[ASRC_N_QUALITIES] =
+{
+    // F1/F2 descriptors                                      F3 phases                                                       Number of phases                    Shift
+    {{sASRCFirLowDescriptor,    sASRCFirLowMPDescriptor},   {(const int*)iADFirLowCoefs,    (const int*)iADFirLowMPCoefs},  FILTER_DEFS_ADFIR_LOW_N_PHASES,     -1},     // ASRC_QUALITY_LOW
+    {{sASRCFirDescriptor,       sASRCFirMPDescriptor},      {(const int*)iADFirCoefs,       (const int*)iADFirMPCoefs},     FILTER_DEFS_ADFIR_N_PHASES,         0}       // ASRC_QUALITY_STANDARD
+};
+#endif
+
 
 // ===========================================================================
 //
@@ -276,6 +322,13 @@ ASRCFsRatioConfigs_t		sFsRatioConfigs[ASRC_N_FS][ASRC_N_FS] =				// Fs ratio con
 //
 // ===========================================================================
 
+static FIRDescriptor_t*         ASRC_fir_descriptor(asrc_ctrl_t* pasrc_ctrl, ASRCFiltersIDs_t* psFiltersID, FIRDescriptor_t* psFIRDescriptors,
+                                                    unsigned int uiIndex, FIRDescriptor_t* psPlannedDescriptor);
+#ifndef __xcore__
+static double                   ASRC_bessel_i0(double dX);
+static unsigned int             ASRC_design_fir(int* piCoefs, unsigned int uiMaxTaps, double dPassband, double dStopband);
+static ASRCReturnCodes_t        ASRC_plan_filters(asrc_ctrl_t* pasrc_ctrl, unsigned int uiFsIn, unsigned int uiFsOut);
+#endif
 
 
 // ===========================================================================
@@ -284,48 +337,6 @@ ASRCFsRatioConfigs_t		sFsRatioConfigs[ASRC_N_FS][ASRC_N_FS] =				// Fs ratio con
 //
 // ===========================================================================
 
-#if SRC_USE_VPU
-#define xs3_index_shuffle(a,b) [(b)^7][a]
-#else
-#define xs3_index_shuffle(a,b) [a][b]
-#endif
-
-// ==================================================================== //
-// Function:        ASRC_prepare_coefs                                    //
-// Arguments:        asrc_ctrl_t     *pasrc_ctrl: Ctrl strct.                //
-// Return values:    ASRC_NO_ERROR on success                            //
-//                    ASRC_ERROR on failure                                //
-// Description:        Prepares the ASRC coefficients from the prototype    //
-//                    Needs to be called only once                        //
-// ==================================================================== //
-ASRCReturnCodes_t                ASRC_prepare_coefs(void)
-{
-    unsigned int        ui, uj;
-    int*                piPrototypeCoefs = iADFirPrototypeCoefs + FILTER_DEFS_ADFIR_PROTOTYPE_N_TAPS - FILTER_DEFS_ADFIR_N_PHASES;
-
-    // First fill in the phases which start normally
-    for(ui = 0; ui < FILTER_DEFS_ADFIR_N_PHASES; ui++)
-    {
-        // Copy phase information
-        for(uj = 0; uj < FILTER_DEFS_ADFIR_PHASE_N_TAPS - 1; uj++)
-            iADFirCoefs xs3_index_shuffle(ui, uj) = *(piPrototypeCoefs + ui - uj * FILTER_DEFS_ADFIR_N_PHASES);
-        // Zero fill last coefficient
-        iADFirCoefs xs3_index_shuffle(ui, FILTER_DEFS_ADFIR_PHASE_N_TAPS - 1)    = 0;
-    }
-
-    // Then fill in the two phases which start delayed
-    for(ui = 0; ui < 2; ui++)
-    {
-        // Zero fill first coefficient
-        iADFirCoefs xs3_index_shuffle(FILTER_DEFS_ADFIR_N_PHASES + ui, 0)    = 0;
-        // Copy phase informaiton
-        for(uj = 0; uj < FILTER_DEFS_ADFIR_PHASE_N_TAPS - 1; uj++)
-            iADFirCoefs xs3_index_shuffle(FILTER_DEFS_ADFIR_N_PHASES + ui,uj + 1) = *(piPrototypeCoefs + ui - uj * FILTER_DEFS_ADFIR_N_PHASES);
-    }
-
-    return ASRC_NO_ERROR;
-}
-
 // ==================================================================== //
 // Function:        ASRC_init                                            //
 // Arguments:        asrc_ctrl_t     *pasrc_ctrl: Ctrl strct.                //
@@ -337,26 +348,42 @@ ASRCReturnCodes_t                ASRC_init(asrc_ctrl_t* pasrc_ctrl)
 {
     ASRCFiltersIDs_t*            psFiltersID;
     FIRDescriptor_t*            psFIRDescriptor;
+    FIRDescriptor_t*            psF1Descriptor;
     ADFIRDescriptor_t*            psADFIRDescriptor;
+    FIRDescriptor_t             sPlannedDescriptor[ASRC_N_PLANNED_F];
+    int*                        piDelays            = pasrc_ctrl->piDelays;
+    unsigned int                uiNF1InSamples      = pasrc_ctrl->uiNInSamples;
+    unsigned int                uiF1InStep          = pasrc_ctrl->uiNchannels;
 
 
-    // Check if state is allocated
-    if(pasrc_ctrl->psState == 0)
+    // Check if state is allocated, unless the delay lines come from an arena
+    if((pasrc_ctrl->psState == 0) && (pasrc_ctrl->piDelays == 0))
         return ASRC_ERROR;
 
     // Check if stack is allocated
     if(pasrc_ctrl->piStack == 0)
         return ASRC_ERROR;
 
-    // Check if valid Fsin and Fsout have been provided
-    if( (pasrc_ctrl->eInFs < ASRC_FS_MIN) || (pasrc_ctrl->eInFs > ASRC_FS_MAX))
-        return ASRC_ERROR;
-    if( (pasrc_ctrl->eOutFs < ASRC_FS_MIN) || (pasrc_ctrl->eOutFs > ASRC_FS_MAX))
-        return ASRC_ERROR;
+    // Rates planned by ASRC_plan_rates come with their filters IDs and fs ratio configuration
+    if( (pasrc_ctrl->eInFs != ASRC_FS_PLANNED) || (pasrc_ctrl->eOutFs != ASRC_FS_PLANNED) )
+    {
+        // Check if valid Fsin and Fsout have been provided
+        if( (pasrc_ctrl->eInFs < ASRC_FS_MIN) || (pasrc_ctrl->eInFs > ASRC_FS_MAX))
+            return ASRC_ERROR;
+        if( (pasrc_ctrl->eOutFs < ASRC_FS_MIN) || (pasrc_ctrl->eOutFs > ASRC_FS_MAX))
+            return ASRC_ERROR;
+
+        pasrc_ctrl->sFiltersIDs     = sASRCFiltersIDs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs];
+        pasrc_ctrl->sFsRatioConfig  = sFsRatioConfigs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs];
+#ifndef __xcore__
+        // No designed filters
+        pasrc_ctrl->psPlanned       = 0;
+#endif
+    }
 
     // Set nominal fs ratio
-    pasrc_ctrl->uiFsRatio    = sFsRatioConfigs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs].uiNominalFsRatio;
-    pasrc_ctrl->uiFsRatio_lo = sFsRatioConfigs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs].uiNominalFsRatio_lo;
+    pasrc_ctrl->uiFsRatio    = pasrc_ctrl->sFsRatioConfig.uiNominalFsRatio;
+    pasrc_ctrl->uiFsRatio_lo = pasrc_ctrl->sFsRatioConfig.uiNominalFsRatio_lo;
 
     // Check that number of input samples is allocated and is a multiple of 4
     if(pasrc_ctrl->uiNInSamples == 0)
@@ -365,19 +392,52 @@ ASRCReturnCodes_t                ASRC_init(asrc_ctrl_t* pasrc_ctrl)
         return ASRC_ERROR;
 
     // Load filters ID and number of samples
-    psFiltersID        = &sASRCFiltersIDs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs];
+    psFiltersID        = &pasrc_ctrl->sFiltersIDs;
 
 
     // Configure filters F1 and F2 from filters ID and number of samples
 
+#ifndef __xcore__
+    // Designed filters need their coefficients, and delay lines from an arena (the state structure has
+    // only those of the tables)
+    if( (psFiltersID->uiFID[ASRC_F1_INDEX] == ASRC_FIR_PLANNED_ID) || (psFiltersID->uiFID[ASRC_F2_INDEX] == ASRC_FIR_PLANNED_ID) )
+    {
+        if( (pasrc_ctrl->psPlanned == 0) || (pasrc_ctrl->psPlanned->piCoefs == 0) || (piDelays == 0) )
+            return ASRC_ERROR;
+    }
+
+    // Filter F0
+    // ---------
+    // Only designed for planned pairs, where F1 and F2 cannot bring the rate down far enough on their own
+    psFIRDescriptor                            = ASRC_planned_descriptor(pasrc_ctrl->psPlanned, ASRC_F0_INDEX, &sPlannedDescriptor[ASRC_F0_INDEX]);
+    pasrc_ctrl->sFIRF0Ctrl.uiNInSamples        = pasrc_ctrl->uiNInSamples;
+    pasrc_ctrl->sFIRF0Ctrl.uiInStep            = pasrc_ctrl->uiNchannels;
+    pasrc_ctrl->sFIRF0Ctrl.piDelayB            = piDelays;
+    pasrc_ctrl->sFIRF0Ctrl.uiOutStep           = 1;
+    pasrc_ctrl->sFIRF0Ctrl.piOut               = pasrc_ctrl->piStack;
+    if(FIR_init_from_desc(&pasrc_ctrl->sFIRF0Ctrl, psFIRDescriptor) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+    if(pasrc_ctrl->sFIRF0Ctrl.eEnable == FIR_ON)
+    {
+        // F1 then runs in place on the stack
+        uiNF1InSamples                          = pasrc_ctrl->sFIRF0Ctrl.uiNOutSamples;
+        uiF1InStep                              = 1;
+        pasrc_ctrl->sFIRF1Ctrl.piIn             = pasrc_ctrl->piStack;
+        piDelays                               += FIR_delay_length(psFIRDescriptor);
+    }
+#endif
+
     // Filter F1
     // ---------
-    psFIRDescriptor                            = &sASRCFirDescriptor[psFiltersID->uiFID[ASRC_F1_INDEX]];
+    psFIRDescriptor                            = ASRC_fir_descriptor(pasrc_ctrl, psFiltersID, sASRCFirDescriptor, ASRC_F1_INDEX, &sPlannedDescriptor[ASRC_F1_INDEX]);
+    psF1Descriptor                             = psFIRDescriptor;
     // Set number of input samples and input samples step
-    pasrc_ctrl->sFIRF1Ctrl.uiNInSamples        = pasrc_ctrl->uiNInSamples;
-    pasrc_ctrl->sFIRF1Ctrl.uiInStep            = pasrc_ctrl->uiNchannels;
+    pasrc_ctrl->sFIRF1Ctrl.uiNInSamples        = uiNF1InSamples;
+    pasrc_ctrl->sFIRF1Ctrl.uiInStep            = uiF1InStep;
     // Set delay line base pointer
-    if( psFiltersID->uiFID[ASRC_F1_INDEX] == FILTER_DEFS_ASRC_FIR_DS_ID )
+    if( piDelays != 0 )
+        pasrc_ctrl->sFIRF1Ctrl.piDelayB            = piDelays;
+    else if( psFiltersID->uiFID[ASRC_F1_INDEX] == FILTER_DEFS_ASRC_FIR_DS_ID )
         pasrc_ctrl->sFIRF1Ctrl.piDelayB            = pasrc_ctrl->psState->iDelayFIRShort;
     else
         pasrc_ctrl->sFIRF1Ctrl.piDelayB            = pasrc_ctrl->psState->iDelayFIRLong;
@@ -395,12 +455,15 @@ ASRCReturnCodes_t                ASRC_init(asrc_ctrl_t* pasrc_ctrl)
 
     // Filter F2
     // ---------
-    psFIRDescriptor                            = &sASRCFirDescriptor[psFiltersID->uiFID[ASRC_F2_INDEX]];
+    psFIRDescriptor                            = ASRC_fir_descriptor(pasrc_ctrl, psFiltersID, sASRCFirDescriptor, ASRC_F2_INDEX, &sPlannedDescriptor[ASRC_F2_INDEX]);
     // Set number of input samples and input samples step
     pasrc_ctrl->sFIRF2Ctrl.uiNInSamples        = pasrc_ctrl->sFIRF1Ctrl.uiNOutSamples;
     pasrc_ctrl->sFIRF2Ctrl.uiInStep            = pasrc_ctrl->sFIRF1Ctrl.uiOutStep;
     // Set delay line base pointer (second filter is always long with ASRC)
-    pasrc_ctrl->sFIRF2Ctrl.piDelayB            = pasrc_ctrl->psState->iDelayFIRLong;
+    if( piDelays != 0 )
+        pasrc_ctrl->sFIRF2Ctrl.piDelayB            = pasrc_ctrl->sFIRF1Ctrl.piDelayB + FIR_delay_length(psF1Descriptor);
+    else
+        pasrc_ctrl->sFIRF2Ctrl.piDelayB            = pasrc_ctrl->psState->iDelayFIRLong;
     // Set output buffer step
     pasrc_ctrl->sFIRF2Ctrl.uiOutStep        = 1;//ASRC_N_CHANNELS; //TODO confirm this. Looks like 1 = channel per instance
 
@@ -416,7 +479,7 @@ ASRCReturnCodes_t                ASRC_init(asrc_ctrl_t* pasrc_ctrl)
     // Setup fixed input/output buffers for F1 and F2
     // ----------------------------------------------
     // We set all fixed items (to stack base)
-    // F1 input is never from stack, so don't set it
+    // F1 input is only from stack after F0, set above
     pasrc_ctrl->sFIRF2Ctrl.piIn                = pasrc_ctrl->piStack;
     pasrc_ctrl->sFIRF1Ctrl.piOut            = pasrc_ctrl->piStack;
     pasrc_ctrl->sFIRF2Ctrl.piOut            = pasrc_ctrl->piStack;
@@ -427,8 +490,17 @@ ASRCReturnCodes_t                ASRC_init(asrc_ctrl_t* pasrc_ctrl)
     // ---------
     psADFIRDescriptor                        = &sADFirDescriptor;
 
-    // Set delay line base pointer
-    pasrc_ctrl->sADFIRF3Ctrl.piDelayB        = pasrc_ctrl->psState->iDelayADFIR;
+    // Set delay line base pointer, the dither seed follows the delay lines of an arena
+    if( pasrc_ctrl->piDelays != 0 )
+    {
+        pasrc_ctrl->sADFIRF3Ctrl.piDelayB        = pasrc_ctrl->sFIRF2Ctrl.piDelayB + FIR_delay_length(psFIRDescriptor);
+        pasrc_ctrl->puiRndSeed                   = (unsigned int*)(pasrc_ctrl->sADFIRF3Ctrl.piDelayB + ADFIR_delay_length(psADFIRDescriptor));
+    }
+    else
+    {
+        pasrc_ctrl->sADFIRF3Ctrl.piDelayB        = pasrc_ctrl->psState->iDelayADFIR;
+        pasrc_ctrl->puiRndSeed                   = &pasrc_ctrl->psState->uiRndSeed;
+    }
     // Set AD coefficients pointer
     pasrc_ctrl->sADFIRF3Ctrl.piADCoefs        = pasrc_ctrl->piADCoefs;
 
@@ -436,6 +508,28 @@ ASRCReturnCodes_t                ASRC_init(asrc_ctrl_t* pasrc_ctrl)
     if(ADFIR_init_from_desc(&pasrc_ctrl->sADFIRF3Ctrl, psADFIRDescriptor) != FIR_NO_ERROR)
         return ASRC_ERROR;
 
+#ifndef __xcore__
+    // Select the spline coefficient generation kernel
+    {
+        SRCInnerLoop_t      pfSpline[2];
+
+        src_isa_get_kernels(SRC_KERNEL_SPLINE, pfSpline);
+        pasrc_ctrl->pvSplineCoeffGen        = pfSpline[0];
+    }
+
+    // Standard quality tier, linear phase
+    pasrc_ctrl->uiQuality                   = ASRC_QUALITY_STANDARD;
+    pasrc_ctrl->uiMinPhase                  = 0;
+    pasrc_ctrl->piADFirPhases               = sASRCQualityConfigs[ASRC_QUALITY_STANDARD].piADFirPhases[0];
+    pasrc_ctrl->uiADFirNPhases              = sASRCQualityConfigs[ASRC_QUALITY_STANDARD].uiADFirNPhases;
+    pasrc_ctrl->iADFirPhasesShift           = sASRCQualityConfigs[ASRC_QUALITY_STANDARD].iADFirPhasesShift;
+#endif
+
+#ifndef __xcore__
+    // Interleaved input and output buffers
+    pasrc_ctrl->uiIOStep                    = pasrc_ctrl->uiNchannels;
+#endif
+
     // Call sync function
     if(ASRC_sync(pasrc_ctrl) != ASRC_NO_ERROR)
         return ASRC_ERROR;
@@ -443,6 +537,485 @@ ASRCReturnCodes_t                ASRC_init(asrc_ctrl_t* pasrc_ctrl)
 }
 
 
+#ifndef __xcore__
+// ==================================================================== //
+// Function:        ASRC_set_io_step                                    //
+// Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+//                  unsigned int uiIOStep: Sample step in the input and //
+//                               output buffers                         //
+// Return values:   None                                                //
+// Description:     Sets the input and output sample step of the ASRC   //
+// ==================================================================== //
+void                            ASRC_set_io_step(asrc_ctrl_t* pasrc_ctrl, unsigned int uiIOStep)
+{
+    // F1 output and F2 are on the stack, F3 output is written by the wrapper with this step
+    pasrc_ctrl->uiIOStep                    = uiIOStep;
+    if(pasrc_ctrl->sFIRF0Ctrl.eEnable == FIR_ON)
+        pasrc_ctrl->sFIRF0Ctrl.uiInStep     = uiIOStep;
+    else
+        pasrc_ctrl->sFIRF1Ctrl.uiInStep     = uiIOStep;
+}
+#endif
+
+
+// ==================================================================== //
+// Function:        ASRC_plan_rates                                     //
+// Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+//                  unsigned int uiFsIn: Input rate in Hz               //
+//                  unsigned int uiFsOut: Output rate in Hz             //
+// Return values:   ASRC_NO_ERROR on success                            //
+//                  ASRC_ERROR if no filter chain fits the rates        //
+// Description:     Sets the rates of the ASRC before ASRC_init         //
+// ==================================================================== //
+ASRCReturnCodes_t                ASRC_plan_rates(asrc_ctrl_t* pasrc_ctrl, unsigned int uiFsIn, unsigned int uiFsOut)
+{
+    unsigned int                uiInCode    = ASRC_N_FS;
+    unsigned int                uiOutCode   = ASRC_N_FS;
+    unsigned int                ui;
+    const ASRCFs_t*             peTemplate  = 0;
+    ASRCFsRatioConfigs_t*       psConfig    = &pasrc_ctrl->sFsRatioConfig;
+    unsigned long long          u64Ratio;
+
+    if( (uiFsIn == 0) || (uiFsOut == 0) )
+        return ASRC_ERROR;
+
+    // Rates of the Fs codes keep the tables
+    for(ui = 0; ui < ASRC_N_FS; ui++)
+    {
+        if(uiASRCFsHz[ui] == uiFsIn)
+            uiInCode    = ui;
+        if(uiASRCFsHz[ui] == uiFsOut)
+            uiOutCode   = ui;
+    }
+    if( (uiInCode < ASRC_N_FS) && (uiOutCode < ASRC_N_FS) )
+    {
+        pasrc_ctrl->eInFs       = (ASRCFs_t)uiInCode;
+        pasrc_ctrl->eOutFs      = (ASRCFs_t)uiOutCode;
+#ifndef __xcore__
+        pasrc_ctrl->psPlanned   = 0;
+#endif
+        return ASRC_NO_ERROR;
+    }
+
+    // Other rates take the template with the lowest Fs ratio that is not below theirs
+    for(ui = 0; ui < ASRC_N_PLAN_TEMPLATES; ui++)
+        if( (unsigned long long)uiFsIn * uiASRCFsHz[eASRCPlanTemplates[ui][1]] <=
+            (unsigned long long)uiFsOut * uiASRCFsHz[eASRCPlanTemplates[ui][0]] )
+        {
+            peTemplate  = eASRCPlanTemplates[ui];
+            break;
+        }
+
+    pasrc_ctrl->eInFs           = ASRC_FS_PLANNED;
+    pasrc_ctrl->eOutFs          = ASRC_FS_PLANNED;
+#ifndef __xcore__
+    // On hosts that template is only taken at its own Fs ratio, or to interpolate, where its passband
+    // is that of Fsin. The filters of other rates are designed for them
+    if( (uiFsIn > uiFsOut) && ((peTemplate == 0) ||
+        ((unsigned long long)uiFsIn * uiASRCFsHz[peTemplate[1]] != (unsigned long long)uiFsOut * uiASRCFsHz[peTemplate[0]])) )
+    {
+        if( (pasrc_ctrl->psPlanned == 0) || (ASRC_plan_filters(pasrc_ctrl, uiFsIn, uiFsOut) != ASRC_NO_ERROR) )
+            return ASRC_ERROR;
+    }
+    else
+#endif
+    {
+#ifndef __xcore__
+        pasrc_ctrl->psPlanned       = 0;
+#endif
+        if(peTemplate == 0)
+            return ASRC_ERROR;
+        pasrc_ctrl->sFiltersIDs     = sASRCFiltersIDs[peTemplate[0]][peTemplate[1]];
+        psConfig->iFsRatioShift     = sFsRatioConfigs[peTemplate[0]][peTemplate[1]].iFsRatioShift;
+    }
+
+    // Nominal fs ratio uiFsIn / uiFsOut in 4.60 format, exact to the last bit. The ratio is below
+    // that of the last template, or the highest the filters are designed for, so the integer part fits
+    u64Ratio                    = ((unsigned long long)uiFsIn << ASRC_FS_RATIO_UNIT_BIT) / uiFsOut;
+    psConfig->uiNominalFsRatio  = (unsigned int)u64Ratio;
+    u64Ratio                    = ((unsigned long long)uiFsIn << ASRC_FS_RATIO_UNIT_BIT) - u64Ratio * uiFsOut;
+    psConfig->uiNominalFsRatio_lo = (unsigned int)((u64Ratio << 32) / uiFsOut);
+    if(psConfig->uiNominalFsRatio == 0)
+        return ASRC_ERROR;
+
+    psConfig->uiMinFsRatio      = (unsigned int)((unsigned long long)psConfig->uiNominalFsRatio * ASRC_FS_RATIO_MIN_PERCENT / 100);
+    psConfig->uiMaxFsRatio      = (unsigned int)((unsigned long long)psConfig->uiNominalFsRatio * ASRC_FS_RATIO_MAX_PERCENT / 100);
+
+    return ASRC_NO_ERROR;
+}
+
+
+#ifndef __xcore__
+// ==================================================================== //
+// Function:        ASRC_planned_descriptor                             //
+// Arguments:       ASRCPlannedFilters_t *psPlanned: Planned filters    //
+//                  unsigned int uiIndex: ASRC_F1_INDEX, ASRC_F2_INDEX  //
+//                               or ASRC_F0_INDEX                       //
+//                  FIRDescriptor_t *psDescriptor: Descriptor to set    //
+// Return values:   psDescriptor                                        //
+// Description:     Descriptor of a filter designed by ASRC_plan_rates, //
+//                  without coefficients if it was not designed         //
+// ==================================================================== //
+FIRDescriptor_t*                ASRC_planned_descriptor(ASRCPlannedFilters_t* psPlanned, unsigned int uiIndex, FIRDescriptor_t* psDescriptor)
+{
+    unsigned int                ui;
+    unsigned int                uiOffset    = 0;
+
+    if( (psPlanned == 0) || (psPlanned->uiNCoefs[uiIndex] == 0) )
+    {
+        psDescriptor->eType     = FIR_TYPE_SYNC;
+        psDescriptor->uiNCoefs  = 0;
+        psDescriptor->piCoefs   = 0;
+        return psDescriptor;
+    }
+
+    // The coefficients of the filters come one after the other
+    for(ui = 0; ui < uiIndex; ui++)
+        uiOffset               += psPlanned->uiNCoefs[ui];
+
+    psDescriptor->eType         = psPlanned->eType[uiIndex];
+    psDescriptor->uiNCoefs      = psPlanned->uiNCoefs[uiIndex];
+    psDescriptor->piCoefs       = (psPlanned->piCoefs != 0) ? psPlanned->piCoefs + uiOffset : 0;
+    return psDescriptor;
+}
+
+
+// ==================================================================== //
+// Function:        ASRC_planned_length                                 //
+// Arguments:       ASRCPlannedFilters_t *psPlanned: Planned filters    //
+// Return values:   Coefficient words of the filters, an even number    //
+// Description:     Length of psPlanned->piCoefs for the filters        //
+//                  planned by ASRC_plan_rates (0 if psPlanned is 0)    //
+// ==================================================================== //
+unsigned int                    ASRC_planned_length(ASRCPlannedFilters_t* psPlanned)
+{
+    unsigned int                ui;
+    unsigned int                uiLength    = 0;
+
+    if(psPlanned == 0)
+        return 0;
+    for(ui = 0; ui < ASRC_N_PLANNED_F; ui++)
+        uiLength               += psPlanned->uiNCoefs[ui];
+    // Padded to 64 bits
+    return (uiLength + 1) & ~1;
+}
+#endif
+
+
+// ==================================================================== //
+// Function:        ASRC_fir_descriptor                                 //
+// Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+//                  ASRCFiltersIDs_t *psFiltersID: Filters IDs          //
+//                  FIRDescriptor_t *psFIRDescriptors: Table of the     //
+//                               quality tier and phase                 //
+//                  unsigned int uiIndex: ASRC_F1_INDEX or ASRC_F2_INDEX//
+//                  FIRDescriptor_t *psPlannedDescriptor: Descriptor to //
+//                               set for a designed filter              //
+// Return values:   Descriptor of the F1 or F2 filter                   //
+// Description:     Looks the filter up in the table, unless it was     //
+//                  designed by ASRC_plan_rates                         //
+// ==================================================================== //
+static FIRDescriptor_t*         ASRC_fir_descriptor(asrc_ctrl_t* pasrc_ctrl, ASRCFiltersIDs_t* psFiltersID, FIRDescriptor_t* psFIRDescriptors,
+                                                    unsigned int uiIndex, FIRDescriptor_t* psPlannedDescriptor)
+{
+#ifndef __xcore__
+    if(psFiltersID->uiFID[uiIndex] == ASRC_FIR_PLANNED_ID)
+        return ASRC_planned_descriptor(pasrc_ctrl->psPlanned, uiIndex, psPlannedDescriptor);
+#else
+    (void)pasrc_ctrl;
+    (void)psPlannedDescriptor;
+#endif
+    return &psFIRDescriptors[psFiltersID->uiFID[uiIndex]];
+}
+
+
+#ifndef __xcore__
+// ==================================================================== //
+// Function:        ASRC_bessel_i0                                      //
+// Arguments:       double dX: Argument                                 //
+// Return values:   Modified Bessel function of the first kind, order 0 //
+// Description:     Sums the series until its terms are negligible      //
+// ==================================================================== //
+static double                   ASRC_bessel_i0(double dX)
+{
+    double                      dSum        = 1.0;
+    double                      dTerm       = 1.0;
+    unsigned int                ui;
+
+    for(ui = 1; dTerm > 1e-12 * dSum; ui++)
+    {
+        dTerm                  *= (dX * dX) / (4.0 * ui * ui);
+        dSum                   += dTerm;
+    }
+    return dSum;
+}
+
+
+// ==================================================================== //
+// Function:        ASRC_design_fir                                     //
+// Arguments:       int *piCoefs: Coefficients to write (0 to only      //
+//                               count the taps)                        //
+//                  unsigned int uiMaxTaps: Most taps that fit          //
+//                  double dPassband: Passband edge                     //
+//                  double dStopband: Stopband edge, both relative to   //
+//                               the Nyquist frequency of the input     //
+// Return values:   Number of taps, 0 if more than uiMaxTaps are needed //
+// Description:     Kaiser windowed sinc low-pass filter with           //
+//                  ASRC_PLAN_ATTENUATION_DB of stopband attenuation,   //
+//                  in Q1.31 with unity DC gain, as the generator of    //
+//                  the low quality tables designs them                 //
+// ==================================================================== //
+static unsigned int             ASRC_design_fir(int* piCoefs, unsigned int uiMaxTaps, double dPassband, double dStopband)
+{
+    double                      dWidth      = (dStopband - dPassband) * M_PI;
+    double                      dBeta       = 0.1102 * (ASRC_PLAN_ATTENUATION_DB - 8.7);
+    double                      dCutoff     = (dPassband + dStopband) / 2;
+    double                      dCentre, dT, dH, dSum, dScale;
+    double                      dCoefs[ASRC_PLAN_MAX_TAPS];
+    unsigned int                uiNTaps, ui;
+
+    uiNTaps                     = (unsigned int)ceil((ASRC_PLAN_ATTENUATION_DB - 7.95) / (2.285 * dWidth) + 1);
+    uiNTaps                     = (uiNTaps + ASRC_PLAN_TAPS_MULTIPLE - 1) / ASRC_PLAN_TAPS_MULTIPLE * ASRC_PLAN_TAPS_MULTIPLE;
+    if( (uiNTaps > uiMaxTaps) || (uiNTaps > ASRC_PLAN_MAX_TAPS) )
+        return 0;
+    if(piCoefs == 0)
+        return uiNTaps;
+
+    dCentre                     = (uiNTaps - 1) / 2.0;
+    dSum                        = 0.0;
+    for(ui = 0; ui < uiNTaps; ui++)
+    {
+        dT                      = ui - dCentre;
+        dH                      = dCutoff * sin(M_PI * dCutoff * dT) / (M_PI * dCutoff * dT);
+        dCoefs[ui]              = dH * ASRC_bessel_i0(dBeta * sqrt(1 - (dT / dCentre) * (dT / dCentre))) / ASRC_bessel_i0(dBeta);
+        dSum                   += dCoefs[ui];
+    }
+
+    // Unity DC gain in Q1.31
+    dScale                      = 2147483648.0 / dSum;
+    for(ui = 0; ui < uiNTaps; ui++)
+        piCoefs[ui]             = (int)lrint(dCoefs[ui] * dScale);
+    return uiNTaps;
+}
+
+
+// ==================================================================== //
+// Function:        ASRC_plan_filters                                   //
+// Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+//                  unsigned int uiFsIn: Input rate in Hz               //
+//                  unsigned int uiFsOut: Output rate in Hz, below it   //
+// Return values:   ASRC_NO_ERROR on success                            //
+//                  ASRC_ERROR if the Fs ratio is too high              //
+// Description:     Designs the filters of a pair that is not at the Fs //
+//                  ratio of a template. DS2 filters halve the rate,    //
+//                  or the UP filter doubles it, until the synchronous  //
+//                  rate is between ASRC_PLAN_MIN_SYNC_RATIO and twice  //
+//                  that times Fsout, then a low-pass SYNC filter keeps //
+//                  the band of Fsout                                   //
+// ==================================================================== //
+static ASRCReturnCodes_t        ASRC_plan_filters(asrc_ctrl_t* pasrc_ctrl, unsigned int uiFsIn, unsigned int uiFsOut)
+{
+    ASRCPlannedFilters_t*       psPlanned   = pasrc_ctrl->psPlanned;
+    ASRCFiltersIDs_t*           psFiltersID = &pasrc_ctrl->sFiltersIDs;
+    double                      dRate       = (double)uiFsIn / uiFsOut;     // Filter input rate relative to Fsout
+    unsigned int                uiStages[ASRC_N_PLANNED_F];                 // Filters in the order they run
+    unsigned int                uiNStages   = 0;
+    unsigned int                uiNHalvings = 0;
+    double                      dRates[ASRC_N_PLANNED_F];
+    unsigned int                uiNTaps, ui;
+    int*                        piCoefs;
+
+    while(dRate / (1 << uiNHalvings) > 2 * ASRC_PLAN_MIN_SYNC_RATIO)
+        uiNHalvings++;
+    if(uiNHalvings > ASRC_PLAN_MAX_HALVINGS)
+        return ASRC_ERROR;
+
+    for(ui = 0; ui < ASRC_N_PLANNED_F; ui++)
+        psPlanned->uiNCoefs[ui] = 0;
+    psFiltersID->uiFID[ASRC_F1_INDEX]   = ASRC_FIR_PLANNED_ID;
+    psFiltersID->uiFID[ASRC_F2_INDEX]   = ASRC_FIR_PLANNED_ID;
+
+    if(uiNHalvings == 0 && dRate <= ASRC_PLAN_MIN_SYNC_RATIO)
+    {
+        // F1 is the UP filter, its passband is that of Fsin, above that of Fsout
+        psFiltersID->uiFID[ASRC_F1_INDEX]   = FILTER_DEFS_ASRC_FIR_UP_ID;
+        uiStages[uiNStages++]               = ASRC_F2_INDEX;
+        pasrc_ctrl->sFsRatioConfig.iFsRatioShift    = ASRC_FS_RATIO_SHIFT_P1;
+        dRate                              *= 2;
+    }
+    else if(uiNHalvings == 0)
+    {
+        psFiltersID->uiFID[ASRC_F2_INDEX]   = FILTER_DEFS_ASRC_FIR_NONE_ID;
+        uiStages[uiNStages++]               = ASRC_F1_INDEX;
+        pasrc_ctrl->sFsRatioConfig.iFsRatioShift    = ASRC_FS_RATIO_SHIFT_0;
+    }
+    else
+    {
+        if(uiNHalvings == 2)
+            uiStages[uiNStages++]           = ASRC_F0_INDEX;
+        uiStages[uiNStages++]               = ASRC_F1_INDEX;
+        uiStages[uiNStages++]               = ASRC_F2_INDEX;
+        pasrc_ctrl->sFsRatioConfig.iFsRatioShift    = (uiNHalvings == 2) ? ASRC_FS_RATIO_SHIFT_M2 : ASRC_FS_RATIO_SHIFT_M1;
+    }
+
+    // Input rate of each filter, in the order they run
+    for(ui = 0; ui < uiNStages; ui++)
+    {
+        psPlanned->eType[uiStages[ui]]      = (ui + 1 < uiNStages) ? FIR_TYPE_DS2 : FIR_TYPE_SYNC;
+        psPlanned->uiNCoefs[uiStages[ui]]   = 1;
+        dRates[uiStages[ui]]                = dRate;
+        if(psPlanned->eType[uiStages[ui]] == FIR_TYPE_DS2)
+            dRate                          /= 2;
+    }
+
+    // DS2 filters alias what is above half their output rate less the stopband edge of Fsout to below
+    // that edge. The SYNC filter removes the rest, which F3 would alias. The coefficients are laid out
+    // in index order, unless only the numbers of taps are planned
+    piCoefs                                 = psPlanned->piCoefs;
+    for(ui = 0; ui < ASRC_N_PLANNED_F; ui++)
+    {
+        if(psPlanned->uiNCoefs[ui] == 0)
+            continue;
+        if(psPlanned->eType[ui] == FIR_TYPE_DS2)
+            uiNTaps                         = ASRC_design_fir(piCoefs, FILTER_DEFS_FIR_MAX_TAPS_SHORT,
+                                                              2 * ASRC_PLAN_PASSBAND / dRates[ui], 1 - 2 * ASRC_PLAN_STOPBAND / dRates[ui]);
+        else
+            uiNTaps                         = ASRC_design_fir(piCoefs, ASRC_PLAN_MAX_TAPS,
+                                                              2 * ASRC_PLAN_PASSBAND / dRates[ui], 2 * ASRC_PLAN_STOPBAND / dRates[ui]);
+        if(uiNTaps == 0)
+            return ASRC_ERROR;
+        psPlanned->uiNCoefs[ui]             = uiNTaps;
+        if(piCoefs != 0)
+            piCoefs                        += uiNTaps;
+    }
+
+    return ASRC_NO_ERROR;
+}
+#endif
+
+
+// ==================================================================== //
+// Function:        ASRC_arena_length                                   //
+// Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+//                  unsigned int *puiStackLength: Stack words           //
+// Return values:   Arena words of the channel, 0 on failure            //
+// Description:     Length of the stack, delay lines and dither seed    //
+//                  of a channel for its filters                        //
+// ==================================================================== //
+unsigned int                    ASRC_arena_length(asrc_ctrl_t* pasrc_ctrl, unsigned int* puiStackLength)
+{
+    ASRCFiltersIDs_t*           psFiltersID;
+    FIRDescriptor_t*            psF1Descriptor;
+    FIRDescriptor_t*            psF2Descriptor;
+    FIRDescriptor_t             sPlannedDescriptor[ASRC_N_PLANNED_F];
+    unsigned int                uiNF1InSamples      = pasrc_ctrl->uiNInSamples;
+    unsigned int                uiNF1OutSamples, uiNF2OutSamples;
+    unsigned int                uiF0DelayLength     = 0;
+
+    if( (pasrc_ctrl->eInFs != ASRC_FS_PLANNED) || (pasrc_ctrl->eOutFs != ASRC_FS_PLANNED) )
+    {
+        if( (pasrc_ctrl->eInFs < ASRC_FS_MIN) || (pasrc_ctrl->eInFs > ASRC_FS_MAX))
+            return 0;
+        if( (pasrc_ctrl->eOutFs < ASRC_FS_MIN) || (pasrc_ctrl->eOutFs > ASRC_FS_MAX))
+            return 0;
+        psFiltersID     = &sASRCFiltersIDs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs];
+    }
+    else
+    {
+        psFiltersID     = &pasrc_ctrl->sFiltersIDs;
+#ifndef __xcore__
+        // F0 halves the rate before F1, on the stack
+        psF1Descriptor  = ASRC_planned_descriptor(pasrc_ctrl->psPlanned, ASRC_F0_INDEX, &sPlannedDescriptor[ASRC_F0_INDEX]);
+        uiNF1InSamples  = FIR_n_out_samples(psF1Descriptor, pasrc_ctrl->uiNInSamples);
+        uiF0DelayLength = FIR_delay_length(psF1Descriptor);
+#endif
+    }
+    psF1Descriptor      = ASRC_fir_descriptor(pasrc_ctrl, psFiltersID, sASRCFirDescriptor, ASRC_F1_INDEX, &sPlannedDescriptor[ASRC_F1_INDEX]);
+    psF2Descriptor      = ASRC_fir_descriptor(pasrc_ctrl, psFiltersID, sASRCFirDescriptor, ASRC_F2_INDEX, &sPlannedDescriptor[ASRC_F2_INDEX]);
+
+    // F0, F1 and F2 all write the stack with a step of 1, F1 and F2 in place after F0. Padded to 64 bits
+    uiNF1OutSamples     = FIR_n_out_samples(psF1Descriptor, uiNF1InSamples);
+    uiNF2OutSamples     = FIR_n_out_samples(psF2Descriptor, uiNF1OutSamples);
+    *puiStackLength     = (((uiNF1OutSamples > uiNF2OutSamples) ? uiNF1OutSamples : uiNF2OutSamples) + 1) & ~1;
+    if(uiF0DelayLength != 0)
+        *puiStackLength = (((uiNF1InSamples > *puiStackLength) ? uiNF1InSamples : *puiStackLength) + 1) & ~1;
+
+    // The delay lines have even lengths, the dither seed is padded to 64 bits
+    return *puiStackLength + uiF0DelayLength + FIR_delay_length(psF1Descriptor) + FIR_delay_length(psF2Descriptor) +
+           ADFIR_delay_length(&sADFirDescriptor) + 2;
+}
+
+
+// ==================================================================== //
+// Function:        ASRC_set_min_phase                                  //
+// Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+//                  unsigned int uiMinPhase: 1 for the minimum phase    //
+//                               filters, 0 for the linear phase ones   //
+// Return values:   None                                                //
+// Description:     Selects the coefficients of the F1 and F2 filters   //
+//                  of an initialized ASRC, and on hosts its F3 phases. //
+//                  The minimum phase filters have the same numbers of  //
+//                  taps. Filters designed by ASRC_plan_rates stay      //
+//                  linear phase                                        //
+// ==================================================================== //
+void                            ASRC_set_min_phase(asrc_ctrl_t* pasrc_ctrl, unsigned int uiMinPhase)
+{
+#ifndef __xcore__
+    FIRDescriptor_t*            psFIRDescriptors    = sASRCQualityConfigs[pasrc_ctrl->uiQuality].psFIRDescriptors[uiMinPhase != 0];
+
+    pasrc_ctrl->uiMinPhase              = (uiMinPhase != 0);
+    pasrc_ctrl->piADFirPhases           = sASRCQualityConfigs[pasrc_ctrl->uiQuality].piADFirPhases[pasrc_ctrl->uiMinPhase];
+#else
+    FIRDescriptor_t*            psFIRDescriptors    = uiMinPhase ? sASRCFirMPDescriptor : sASRCFirDescriptor;
+#endif
+
+    FIRDescriptor_t             sPlannedDescriptor;
+
+    pasrc_ctrl->sFIRF1Ctrl.piCoefs      = ASRC_fir_descriptor(pasrc_ctrl, &pasrc_ctrl->sFiltersIDs, psFIRDescriptors, ASRC_F1_INDEX, &sPlannedDescriptor)->piCoefs;
+    pasrc_ctrl->sFIRF2Ctrl.piCoefs      = ASRC_fir_descriptor(pasrc_ctrl, &pasrc_ctrl->sFiltersIDs, psFIRDescriptors, ASRC_F2_INDEX, &sPlannedDescriptor)->piCoefs;
+}
+
+
+#ifndef __xcore__
+// ==================================================================== //
+// Function:        ASRC_set_quality                                    //
+// Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+//                  unsigned int uiQuality: Quality tier                //
+// Return values:   ASRC_NO_ERROR on success                            //
+//                  ASRC_ERROR on failure                               //
+// Description:     Sets up the F1/F2 filters and F3 phases of a        //
+//                  quality tier for an initialized ASRC, and syncs it. //
+//                  Filters designed by ASRC_plan_rates are kept        //
+// ==================================================================== //
+ASRCReturnCodes_t               ASRC_set_quality(asrc_ctrl_t* pasrc_ctrl, unsigned int uiQuality)
+{
+    const ASRCQualityConfigs_t* psQuality;
+    FIRDescriptor_t*            psFIRDescriptors;
+    FIRDescriptor_t             sPlannedDescriptor;
+
+    if(uiQuality >= ASRC_N_QUALITIES)
+        return ASRC_ERROR;
+    psQuality           = &sASRCQualityConfigs[uiQuality];
+    psFIRDescriptors    = psQuality->psFIRDescriptors[pasrc_ctrl->uiMinPhase];
+
+    // F1 and F2 keep their delay lines, number of samples and steps
+    if(FIR_init_from_desc(&pasrc_ctrl->sFIRF1Ctrl, ASRC_fir_descriptor(pasrc_ctrl, &pasrc_ctrl->sFiltersIDs, psFIRDescriptors,
+                                                                       ASRC_F1_INDEX, &sPlannedDescriptor)) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+    if(FIR_init_from_desc(&pasrc_ctrl->sFIRF2Ctrl, ASRC_fir_descriptor(pasrc_ctrl, &pasrc_ctrl->sFiltersIDs, psFIRDescriptors,
+                                                                       ASRC_F2_INDEX, &sPlannedDescriptor)) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+
+    pasrc_ctrl->uiQuality               = uiQuality;
+    pasrc_ctrl->piADFirPhases           = psQuality->piADFirPhases[pasrc_ctrl->uiMinPhase];
+    pasrc_ctrl->uiADFirNPhases          = psQuality->uiADFirNPhases;
+    pasrc_ctrl->iADFirPhasesShift       = psQuality->iADFirPhasesShift;
+
+    return ASRC_sync(pasrc_ctrl);
+}
+#endif
+
+
 // ==================================================================== //
 // Function:        ASRC_sync                                            //
 // Arguments:        asrc_ctrl_t     *pasrc_ctrl: Ctrl strct.                //
@@ -453,6 +1026,10 @@ ASRCReturnCodes_t                ASRC_init(asrc_ctrl_t* pasrc_ctrl)
 ASRCReturnCodes_t                ASRC_sync(asrc_ctrl_t* pasrc_ctrl)
 {
     // Sync the FIR and ADFIR
+#ifndef __xcore__
+    if(FIR_sync(&pasrc_ctrl->sFIRF0Ctrl) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+#endif
     if(FIR_sync(&pasrc_ctrl->sFIRF1Ctrl) != FIR_NO_ERROR)
         return ASRC_ERROR;
     if(FIR_sync(&pasrc_ctrl->sFIRF2Ctrl) != FIR_NO_ERROR)
@@ -462,11 +1039,11 @@ ASRCReturnCodes_t                ASRC_sync(asrc_ctrl_t* pasrc_ctrl)
         return ASRC_ERROR;
 
     // Reset time
-    pasrc_ctrl->iTimeInt        = FILTER_DEFS_ADFIR_N_PHASES + ASRC_ADFIR_INITIAL_PHASE;
+    pasrc_ctrl->iTimeInt        = ASRC_ADFIR_N_PHASES(pasrc_ctrl) + ASRC_ADFIR_INITIAL_PHASE * ASRC_ADFIR_N_PHASES(pasrc_ctrl) / FILTER_DEFS_ADFIR_N_PHASES;
     pasrc_ctrl->uiTimeFract        = 0;
 
     // Reset random seeds to initial values
-    pasrc_ctrl->psState->uiRndSeed    = pasrc_ctrl->uiRndSeedInit;
+    *pasrc_ctrl->puiRndSeed    = pasrc_ctrl->uiRndSeedInit;
 
     // Update time step based on Fs ratio
     if(ASRC_update_fs_ratio(pasrc_ctrl) != ASRC_NO_ERROR)
@@ -484,7 +1061,7 @@ ASRCReturnCodes_t                ASRC_sync(asrc_ctrl_t* pasrc_ctrl)
 //                    ASRC_ERROR on failure                                //
 // Description:        Processes F1 and F2 for a channel                    //
 // ==================================================================== //
-#if (XCC_VERSION_MAJOR < 1402) //Beyond 14.2.0 we have proper function pointer support for C
+#if defined(__xcore__) && (XCC_VERSION_MAJOR < 1402) //Beyond 14.2.0 we have proper function pointer support for C
 #pragma stackfunction 64  //Generous stack allocation (probably needs just a handful through F1_F2, ASM etc).
 #endif
 ASRCReturnCodes_t                ASRC_proc_F1_F2(asrc_ctrl_t* pasrc_ctrl)
@@ -492,9 +1069,19 @@ ASRCReturnCodes_t                ASRC_proc_F1_F2(asrc_ctrl_t* pasrc_ctrl)
 
     // Setup variable input / output buffers
     pasrc_ctrl->sFIRF1Ctrl.piIn            = pasrc_ctrl->piIn;
+#ifndef __xcore__
+    // F0 halves the rate into the stack, for F1 to run in place
+    if(pasrc_ctrl->sFIRF0Ctrl.eEnable == FIR_ON)
+    {
+        pasrc_ctrl->sFIRF0Ctrl.piIn        = pasrc_ctrl->piIn;
+        pasrc_ctrl->sFIRF1Ctrl.piIn        = pasrc_ctrl->piStack;
+        if(pasrc_ctrl->sFIRF0Ctrl.pvProc((int *)&pasrc_ctrl->sFIRF0Ctrl) != FIR_NO_ERROR)
+            return ASRC_ERROR;
+    }
+#endif
 
     // F1 is always enabled, so call F1
-    __attribute__((fptrgroup("MRHF_G1")))
+    MRHF_FPTRGROUP
     FIRReturnCodes_t ret = pasrc_ctrl->sFIRF1Ctrl.pvProc((int *)&pasrc_ctrl->sFIRF1Ctrl);
     if(ret != FIR_NO_ERROR)
         return ASRC_ERROR; 
@@ -503,7 +1090,7 @@ ASRCReturnCodes_t                ASRC_proc_F1_F2(asrc_ctrl_t* pasrc_ctrl)
     if(pasrc_ctrl->sFIRF2Ctrl.eEnable == FIR_ON)
     {
         // F2 is enabled, so call F2
-        __attribute__((fptrgroup("MRHF_G1")))
+        MRHF_FPTRGROUP
         FIRReturnCodes_t ret = pasrc_ctrl->sFIRF2Ctrl.pvProc((int *)&pasrc_ctrl->sFIRF2Ctrl);
         if(ret != FIR_NO_ERROR)
             return ASRC_ERROR; 
@@ -527,14 +1114,14 @@ ASRCReturnCodes_t                ASRC_update_fs_ratio(asrc_ctrl_t* pasrc_ctrl)
     unsigned int    uiFsRatio_low    = pasrc_ctrl->uiFsRatio_lo;
 
     // Check for bounds of new Fs ratio
-    if( (uiFsRatio < sFsRatioConfigs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs].uiMinFsRatio) ||
-        (uiFsRatio > sFsRatioConfigs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs].uiMaxFsRatio) )
+    if( (uiFsRatio < pasrc_ctrl->sFsRatioConfig.uiMinFsRatio) ||
+        (uiFsRatio > pasrc_ctrl->sFsRatioConfig.uiMaxFsRatio) )
         return ASRC_ERROR;
 
     // Apply shift to time ratio to build integer and fractional parts of time step
-    pasrc_ctrl->iTimeStepInt     = uiFsRatio >> (sFsRatioConfigs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs].iFsRatioShift);
-    pasrc_ctrl->uiTimeStepFract  = uiFsRatio << (32 - sFsRatioConfigs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs].iFsRatioShift);
-    pasrc_ctrl->uiTimeStepFract |= (uint32_t)(uiFsRatio_low >> sFsRatioConfigs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs].iFsRatioShift);
+    pasrc_ctrl->iTimeStepInt     = uiFsRatio >> ASRC_FS_RATIO_SHIFT(pasrc_ctrl);
+    pasrc_ctrl->uiTimeStepFract  = uiFsRatio << (32 - ASRC_FS_RATIO_SHIFT(pasrc_ctrl));
+    pasrc_ctrl->uiTimeStepFract |= (uint32_t)(uiFsRatio_low >> ASRC_FS_RATIO_SHIFT(pasrc_ctrl));
 
     return ASRC_NO_ERROR;
 }
@@ -555,7 +1142,7 @@ ASRCReturnCodes_t                ASRC_proc_F3_in_spl(asrc_ctrl_t* pasrc_ctrl, in
         return ASRC_ERROR;
 
     // Decrease next output time (this is an integer value, so no influence on fractional part)
-    pasrc_ctrl->iTimeInt    -= FILTER_DEFS_ADFIR_N_PHASES;
+    pasrc_ctrl->iTimeInt    -= ASRC_ADFIR_N_PHASES(pasrc_ctrl);
 
     return ASRC_NO_ERROR;
 }
@@ -573,7 +1160,6 @@ ASRCReturnCodes_t                ASRC_proc_F3_time(asrc_ctrl_t* pasrc_ctrl)
     unsigned int    uiTemp;
     int                iAlpha;
     int                iH[3]; //iH0, iH1, iH2;
-    int                iZero;
     __int64_t            i64Acc0;
     int*            piPhase0;
     int*            piADCoefs;
@@ -582,7 +1168,7 @@ ASRCReturnCodes_t                ASRC_proc_F3_time(asrc_ctrl_t* pasrc_ctrl)
     // -----------------------------------------------------------------
     // if not return value showing that no output sample needs to be produced
     // Update cycle count
-    if(pasrc_ctrl->iTimeInt >= FILTER_DEFS_ADFIR_N_PHASES)
+    if(pasrc_ctrl->iTimeInt >= ASRC_ADFIR_N_PHASES(pasrc_ctrl))
         return ASRC_ERROR;
 
 
@@ -592,9 +1178,6 @@ ASRCReturnCodes_t                ASRC_proc_F3_time(asrc_ctrl_t* pasrc_ctrl)
     // Loop load approximation: 5.625 instructions per sample + 15 instructions overhead => 5.625 * 16 + 15 = 90 + 15 = 105 Instructions
     // Total: 125 instructions
 
-    // Set register to zero
-    iZero        = 0;
-
     // Compute adative coefficients spline factors
     // The fractional part of time gives alpha
     iAlpha        = pasrc_ctrl->uiTimeFract>>1;        // Now alpha can be seen as a signed number
@@ -610,7 +1193,7 @@ ASRCReturnCodes_t                ASRC_proc_F3_time(asrc_ctrl_t* pasrc_ctrl)
     iH[0]            = iH[0] + iH[2];                        // H2 = 0.5 - alpha + 0.5 * alpha * alpha
 
     // The integer part of time gives the phase
-    piPhase0        = &iADFirCoefs[0][pasrc_ctrl->iTimeInt];
+    piPhase0        = (int*)&iADFirCoefs[0][pasrc_ctrl->iTimeInt];
     piADCoefs        = pasrc_ctrl->piADCoefs;        // Given limited number of registers, this should be DP
     src_mrhf_spline_coeff_gen_inner_loop_asm_xs3(piPhase0, iH, piADCoefs, FILTER_DEFS_ADFIR_PHASE_N_TAPS);
 #else
@@ -623,10 +1206,14 @@ ASRCReturnCodes_t                ASRC_proc_F3_time(asrc_ctrl_t* pasrc_ctrl)
     iH[2]            = iH[2] + iH[0];                        // H2 = 0.5 - alpha + 0.5 * alpha * alpha
 
     // The integer part of time gives the phase
-    piPhase0        = iADFirCoefs[pasrc_ctrl->iTimeInt];
+    piPhase0        = ASRC_ADFIR_PHASE(pasrc_ctrl, pasrc_ctrl->iTimeInt);
     piADCoefs        = pasrc_ctrl->piADCoefs;        // Given limited number of registers, this should be DP
 
+#ifndef __xcore__
+    pasrc_ctrl->pvSplineCoeffGen(piPhase0, iH, piADCoefs, FILTER_DEFS_ADFIR_PHASE_N_TAPS);
+#else
     src_mrhf_spline_coeff_gen_inner_loop_asm(piPhase0, iH, piADCoefs, FILTER_DEFS_ADFIR_PHASE_N_TAPS);
+#endif
 #endif
 
     // Step time for next output sample
@@ -682,7 +1269,7 @@ ASRCReturnCodes_t                ASRC_proc_dither(asrc_ctrl_t* pasrc_ctrl)
     int*            piData;
     unsigned int    uiR;
     int                iDither;
-    __int64_t            i64Acc;
+    __int64              i64Acc;
     unsigned int    ui;
 
 
@@ -692,10 +1279,10 @@ ASRCReturnCodes_t                ASRC_proc_dither(asrc_ctrl_t* pasrc_ctrl)
         // Get data buffer
         piData    = pasrc_ctrl->piOut;
         // Get random seed
-        uiR        = pasrc_ctrl->psState->uiRndSeed;
+        uiR        = *pasrc_ctrl->puiRndSeed;
 
         // Loop through samples
-        for(ui = 0; ui < pasrc_ctrl->uiNASRCOutSamples * pasrc_ctrl->uiNchannels; ui += pasrc_ctrl->uiNchannels)
+        for(ui = 0; ui < pasrc_ctrl->uiNASRCOutSamples * ASRC_IO_STEP(pasrc_ctrl); ui += ASRC_IO_STEP(pasrc_ctrl))
         {
             // Compute dither sample (TPDF)
             iDither        = ASRC_DITHER_BIAS;
@@ -713,7 +1300,7 @@ ASRCReturnCodes_t                ASRC_proc_dither(asrc_ctrl_t* pasrc_ctrl)
                         //pi_Data[ui] = dither_maths_asm(piData[ui],iACCh, iACCl);
 
             // Use MACC instruction to saturate and dither + signal
-            i64Acc        = ((__int64_t)iDither <<32);    // On XMOS this is not necessary, just load dither in the top word of the ACC register
+            i64Acc        = ((__int64)iDither <<32);    // On XMOS this is not necessary, just load dither in the top word of the ACC register
             MACC(&i64Acc, piData[ui], 0x7FFFFFFF);
             LSAT30(&i64Acc);
             // Extract 32bits result
@@ -725,7 +1312,7 @@ ASRCReturnCodes_t                ASRC_proc_dither(asrc_ctrl_t* pasrc_ctrl)
         }
 
         // Write random seed back
-        pasrc_ctrl->psState->uiRndSeed    = uiR;
+        *pasrc_ctrl->puiRndSeed    = uiR;
     }
 
     return ASRC_NO_ERROR;
@@ -24,6 +24,9 @@
     #include "src.h"
     #include "src_mrhf_spline_coeff_gen_inner_loop_asm.h"
     #include "src_mrhf_adfir_inner_loop_asm.h"
+#if !defined(__xcore__) && !defined(INCLUDE_FROM_ASM)
+    #include <pthread.h>
+#endif
 
     // ===========================================================================
     //
@@ -36,7 +39,32 @@
     #define		   ASRC_FS_RATIO_UNIT_BIT					28
     #define        ASRC_STACK_LENGTH_MULT                (ASRC_N_CHANNELS * 4)                // Multiplier for stack length (stack length = this value x the number of input samples to process)
     #define        ASRC_ADFIR_COEFS_LENGTH               FILTER_DEFS_ADFIR_PHASE_N_TAPS        // Length of AD FIR coefficients buffer
+    #define        ASRC_F3_INTERLEAVED_DELAY_LENGTH(n)   (2 * FILTER_DEFS_ADFIR_PHASE_N_TAPS * (n))    // Length of the interleaved F3 delay lines of n channels (host only)
+    #define        ASRC_MT_MAX_THREADS                   16                                   // Threads of an asrc_mt_t, the calling one included (host only)
     #define		   ASRC_NOMINAL_FS_SCALE				     (1 << ASRC_FS_RATIO_UNIT_BIT)
+    #define        ASRC_ADFIR_INITIAL_PHASE              32                                   // F3 phase of the first output after a sync
+    #define        ASRC_PASS_FADE_LENGTH                 256                                  // Output samples of the crossfade between the filters and the passthrough copy (host only)
+    #define        ASRC_PLAN_MAX_TAPS                    272                                  // Taps of the longest filter designed by ASRC_plan_rates (host only), a multiple of 16
+    #define        ASRC_PLAN_COEFS_LENGTH                (2 * FILTER_DEFS_FIR_MAX_TAPS_SHORT + ASRC_PLAN_MAX_TAPS)    // Coefficients of the filters designed for a pair (host only)
+    #define        ASRC_PLAN_DELAY_LENGTH                (FILTER_DEFS_FIR_MAX_TAPS_LONG + 2 * ASRC_PLAN_MAX_TAPS)     // Delay lines of F0, F1 and F2 of a pair with designed filters (host only)
+
+    // Sample step in the input and output buffers: uiNchannels for interleaved buffers, 1 for planar ones (host only)
+#ifndef __xcore__
+    #define        ASRC_IO_STEP(psCtrl)                  ((psCtrl)->uiIOStep)
+#else
+    #define        ASRC_IO_STEP(psCtrl)                  ((psCtrl)->uiNchannels)
+#endif
+
+    // F3 phases, first coefficient of a phase and Fs ratio shift for the time step: those of the quality tier (host only)
+#ifndef __xcore__
+    #define        ASRC_ADFIR_N_PHASES(psCtrl)           ((psCtrl)->uiADFirNPhases)
+    #define        ASRC_ADFIR_PHASE(psCtrl, iPhase)      ((int*)(psCtrl)->piADFirPhases + (iPhase) * FILTER_DEFS_ADFIR_PHASE_N_TAPS)
+    #define        ASRC_FS_RATIO_SHIFT(psCtrl)           ((psCtrl)->sFsRatioConfig.iFsRatioShift - (psCtrl)->iADFirPhasesShift)
+#else
+    #define        ASRC_ADFIR_N_PHASES(psCtrl)           FILTER_DEFS_ADFIR_N_PHASES
+    #define        ASRC_ADFIR_PHASE(psCtrl, iPhase)      ((int*)iADFirCoefs[iPhase])
+    #define        ASRC_FS_RATIO_SHIFT(psCtrl)           ((psCtrl)->sFsRatioConfig.iFsRatioShift)
+#endif
 
 
     // Parameter values
@@ -46,6 +74,10 @@
     #define        ASRC_DITHER_ON_OFF_MIN                ASRC_DITHER_OFF
     #define        ASRC_DITHER_ON_OFF_MAX                ASRC_DITHER_ON
 
+    #define        ASRC_QUALITY_LOW                      0                // Quality tiers (host only), as asrc_quality_t
+    #define        ASRC_QUALITY_STANDARD                 1
+    #define        ASRC_N_QUALITIES                      (ASRC_QUALITY_STANDARD + 1)
+
 
 
 
@@ -84,6 +116,7 @@
             ASRC_FS_96                                = 3,                                // Fs = 96kHz code
             ASRC_FS_176                                = 4,                                // Fs = 176.4kHz code
             ASRC_FS_192                                = 5,                                // Fs = 192kHz code
+            ASRC_FS_PLANNED                            = 6,                                // Other rate, configured by ASRC_plan_rates
         } ASRCFs_t;
         #define        ASRC_N_FS                        (ASRC_FS_192 + 1)
         #define        ASRC_FS_MIN                        ASRC_FS_44
@@ -95,6 +128,9 @@
         #define        ASRC_F1_INDEX                    0
         #define        ASRC_F2_INDEX                    1
         #define        ASRC_N_F                        (ASRC_F2_INDEX + 1)
+        #define        ASRC_F0_INDEX                    2                                   // Host stage halving the rate before F1, only designed by ASRC_plan_rates
+        #define        ASRC_N_PLANNED_F                 (ASRC_F0_INDEX + 1)
+        #define        ASRC_FIR_PLANNED_ID              FILTER_DEFS_ASRC_N_FIR_ID           // F1 or F2 filter ID of a filter designed by ASRC_plan_rates (host only)
 
         typedef struct _ASRCFiltersIDs
         {
@@ -112,6 +148,27 @@
             int                    iFsRatioShift;
         } ASRCFsRatioConfigs_t;
 
+#ifndef __xcore__
+        // ASRC quality tier configurations (host only)
+        // --------------------------------------------
+        typedef struct _ASRCQualityConfigs
+        {
+            FIRDescriptor_t*    psFIRDescriptors[2];        // F1 and F2 descriptors (ordered by ID), linear and minimum phase
+            const int*          piADFirPhases[2];           // F3 phases, uiADFirNPhases + 2 of FILTER_DEFS_ADFIR_PHASE_N_TAPS, linear and minimum phase
+            unsigned int        uiADFirNPhases;
+            int                 iADFirPhasesShift;          // log2(uiADFirNPhases / FILTER_DEFS_ADFIR_N_PHASES)
+        } ASRCQualityConfigs_t;
+
+        // ASRC filters designed for planned rates (host only)
+        // ---------------------------------------------------
+        typedef struct _ASRCPlannedFilters
+        {
+            FIRTypeCodes_t      eType[ASRC_N_PLANNED_F];    // Types of the F1, F2 and F0 filters
+            unsigned int        uiNCoefs[ASRC_N_PLANNED_F]; // Their numbers of taps, 0 where not designed
+            int*                piCoefs;                    // Their coefficients one after the other, in that order (0 to only plan the numbers of taps)
+        } ASRCPlannedFilters_t;
+#endif
+
         // ASRC State structure
         // --------------------
         typedef struct _ASRCState
@@ -154,9 +211,14 @@
             unsigned int                            uiDitherOnOff;                        // Dither on/off flag
             unsigned int                            uiRndSeedInit;                        // Dither random seed initial value
 
+            ASRCFiltersIDs_t                        sFiltersIDs;                        // F1 and F2 filter IDs, from the tables or planned
+            ASRCFsRatioConfigs_t                    sFsRatioConfig;                     // Fs ratio configuration, from the tables or planned
+
             asrc_state_t* unsafe                        psState;                            // Pointer to state structure
             int* unsafe                                piStack;                            // Pointer to stack buffer
             int* unsafe                                piADCoefs;                            // Pointer to AD coefficients
+            int* unsafe                             piDelays;                           // Delay lines of F1, F2 and F3 in turn from an arena (0 to use those of the state structure)
+            unsigned int* unsafe                    puiRndSeed;                         // Dither random seed current value, in the state structure or after the delay lines
 #else
             long long                               pad_to_64b_alignment;               //Force compiler to 64b align
             unsigned int                            uiNchannels;                        // Number of channels in this instance
@@ -183,9 +245,38 @@
             unsigned int                            uiDitherOnOff;                        // Dither on/off flag
             unsigned int                            uiRndSeedInit;                        // Dither random seed initial value
 
+            ASRCFiltersIDs_t                        sFiltersIDs;                        // F1 and F2 filter IDs, from the tables or planned
+            ASRCFsRatioConfigs_t                    sFsRatioConfig;                     // Fs ratio configuration, from the tables or planned
+
             asrc_state_t*                            psState;                            // Pointer to state structure
             int*                                    piStack;                            // Pointer to stack buffer
             int*                                    piADCoefs;                            // Pointer to AD coefficients
+            int*                                    piDelays;                           // Delay lines of F1, F2 and F3 in turn from an arena (0 to use those of the state structure)
+            unsigned int*                           puiRndSeed;                         // Dither random seed current value, in the state structure or after the delay lines
+#ifndef __xcore__
+            void                                    (*pvADFIRMulti)(int *[], int *, int [], unsigned, int);    // Host F3 inner loop for all channels at once (0 if not available), selected at init
+            SRCInnerLoop_t                          pvSplineCoeffGen;                   // Host F3 spline coefficient generation, selected at init
+            int*                                    piF3DelayInterleaved;               // Host F3 delay lines of all channels interleaved tap by tap (0 if one per channel)
+            unsigned int                            uiF3DelayInterleavedI;              // Current position in the interleaved delay lines
+            SRCADFIRInterleaved_t                   pvADFIRInterleaved;                 // Host F3 inner loop for the interleaved delay lines
+            int                                     iF3Head[2 * FILTER_DEFS_ADFIR_PHASE_N_TAPS];    // Host F3 taps before the block and the first stack samples, for the block-planned F3 stage
+            unsigned int                            uiIOStep;                           // Sample step in the input and output buffers, set by ASRC_set_io_step
+            int*                                    piPullBuffer;                       // Host output of the last block pulled in part by asrc_process_pull (0 if not set up)
+            unsigned int                            uiPullNext;                         // Next sample (per channel) to pull from piPullBuffer
+            unsigned int                            uiPullLeft;                         // Samples per channel left in piPullBuffer
+            unsigned int                            uiQuality;                          // Quality tier, set by ASRC_set_quality
+            unsigned int                            uiMinPhase;                         // 1 with the minimum phase F1, F2 and F3 filters, set by ASRC_set_min_phase
+            const int*                              piADFirPhases;                      // F3 phases of the quality tier, see ASRC_ADFIR_PHASE()
+            unsigned int                            uiADFirNPhases;                     // Number of F3 phases of the quality tier
+            int                                     iADFirPhasesShift;                  // log2(uiADFirNPhases / FILTER_DEFS_ADFIR_N_PHASES)
+            int*                                    piPassBuffer;                       // Host input history and warm up output of the passthrough fast path (0 if not set up)
+            unsigned long long                      u64PassStep;                        // F3 time step at the nominal Fs ratio
+            unsigned int                            uiPassWindow;                       // Blocks at the nominal time step before the copy is faded in
+            unsigned int                            uiPassBlocks;                       // Blocks at the nominal time step so far
+            unsigned int                            uiPassFade;                         // Weight of the copy in the output, out of ASRC_PASS_FADE_LENGTH
+            FIRCtrl_t                               sFIRF0Ctrl;                         // Host F0 FIR controller, halving the rate before F1 (off unless planned)
+            ASRCPlannedFilters_t*                   psPlanned;                          // Host filters designed by ASRC_plan_rates, shared by the channels of an instance (0 if none)
+#endif
 #endif
         } asrc_ctrl_t;
 
@@ -199,25 +290,57 @@
                     int             iASRCADFIRCoefs[ASRC_ADFIR_COEFS_LENGTH]; //Adaptive FIR coefficients (one per instance)
                 } asrc_adfir_coefs_t;
 
+#ifndef __xcore__
+        // Host thread pool running an instance on up to ASRC_MT_MAX_THREADS threads, each with a
+        // shard of its channels. Set up by asrc_mt_init()
+        // ------------------------------------------------------------------------------------------
+
+                typedef struct _asrc_mt_shard_t
+                {
+                    struct _asrc_mt_t*  psMt;                               // Pool of the shard
+                    unsigned            uiFirst;                            // First channel of the shard
+                    unsigned            uiEnd;                              // One past its last channel
+                } asrc_mt_shard_t;
+
+                typedef struct _asrc_mt_t
+                {
+                    asrc_ctrl_t*        psCtrl;                             // Control structures of the instance
+                    unsigned            uiNThreads;                         // Threads, the calling one included
+                    pthread_t           sThread[ASRC_MT_MAX_THREADS];       // Worker threads, from 1
+                    asrc_mt_shard_t     sShard[ASRC_MT_MAX_THREADS];        // Channels of each thread
+                    pthread_mutex_t     sMutex;                             // Barrier sleep, with sCond
+                    pthread_cond_t      sCond;
+                    unsigned            uiBarrierCount;                     // Threads at the barrier
+                    unsigned            uiBarrierGen;                       // Barriers passed
+                    int                 iQuit;                              // Set to stop the workers
+                    int*                piIn;                               // Block being processed
+                    int*                piOut;
+                    uint64_t            u64FsRatio;
+                    int*                piSchedCoefs;                       // F3 schedule of the block: adaptive coefficients of each output instant,
+                    unsigned*           puiSchedSpl;                        // and the synchronous sample it follows
+                    unsigned            uiSchedNOut;                        // Output instants in the schedule
+                } asrc_mt_t;
+#endif
+
 
 
 
 
         // ===========================================================================
         //
-        // Function prototypes
+        // Variables
         //
         // ===========================================================================
 
-        // ==================================================================== //
-        // Function:        ASRC_prepare_coefs                                  //
-        // Arguments:       asrc_ctrl_t  *pasrc_ctrl: Ctrl strct.                //
-        // Return values:   ASRC_NO_ERROR on success                            //
-        //                  ASRC_ERROR on failure                               //
-        // Description:     Prepares the ASRC coefficients from the prototype   //
-        //                  Needs to be called only once                        //
-        // ==================================================================== //
-        ASRCReturnCodes_t               ASRC_prepare_coefs(void);
+        // Filter and Fs ratio configuration tables [Fsin][Fsout]
+        extern ASRCFiltersIDs_t                 sASRCFiltersIDs[ASRC_N_FS][ASRC_N_FS];
+        extern ASRCFsRatioConfigs_t             sFsRatioConfigs[ASRC_N_FS][ASRC_N_FS];
+
+        // ===========================================================================
+        //
+        // Function prototypes
+        //
+        // ===========================================================================
 
         // ==================================================================== //
         // Function:        ASRC_init                                            //
@@ -228,6 +351,98 @@
         // ==================================================================== //
         ASRCReturnCodes_t                ASRC_init(asrc_ctrl_t* pasrc_ctrl);
 
+        // ==================================================================== //
+        // Function:        ASRC_plan_rates                                     //
+        // Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+        //                  unsigned int uiFsIn: Input rate in Hz               //
+        //                  unsigned int uiFsOut: Output rate in Hz             //
+        // Return values:   ASRC_NO_ERROR on success                            //
+        //                  ASRC_ERROR if no filter chain fits the rates        //
+        // Description:     Sets the rates of the ASRC before ASRC_init. Rates  //
+        //                  of the Fs codes take the tables, others a nominal   //
+        //                  Fs ratio of exactly uiFsIn / uiFsOut. On xcore they //
+        //                  are given the F1/F2 filters and F3 time step shift  //
+        //                  of the template pair with the next Fs ratio up. On  //
+        //                  hosts only pairs at the Fs ratio of a template, or  //
+        //                  up to 1, take its filters; the filters of others    //
+        //                  are designed for the rates, with an F0 stage before //
+        //                  F1 above an Fs ratio of about 7.8. They are         //
+        //                  designed into psPlanned, which must then be set;    //
+        //                  it is set to 0 for the other pairs                  //
+        // ==================================================================== //
+        ASRCReturnCodes_t                ASRC_plan_rates(asrc_ctrl_t* pasrc_ctrl, unsigned int uiFsIn, unsigned int uiFsOut);
+
+#ifndef __xcore__
+        // ==================================================================== //
+        // Function:        ASRC_planned_descriptor                             //
+        // Arguments:       ASRCPlannedFilters_t *psPlanned: Planned filters    //
+        //                  unsigned int uiIndex: ASRC_F1_INDEX, ASRC_F2_INDEX  //
+        //                               or ASRC_F0_INDEX                       //
+        //                  FIRDescriptor_t *psDescriptor: Descriptor to set    //
+        // Return values:   psDescriptor                                        //
+        // Description:     Descriptor of a filter designed by ASRC_plan_rates, //
+        //                  without coefficients if it was not designed or      //
+        //                  psPlanned is 0                                      //
+        // ==================================================================== //
+        FIRDescriptor_t*                ASRC_planned_descriptor(ASRCPlannedFilters_t* psPlanned, unsigned int uiIndex, FIRDescriptor_t* psDescriptor);
+#endif
+
+        // ==================================================================== //
+        // Function:        ASRC_arena_length                                   //
+        // Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+        //                  unsigned int *puiStackLength: Stack words           //
+        // Return values:   Arena words of the channel, 0 on failure            //
+        // Description:     Length of the stack (piStack), then the delay lines //
+        //                  (piDelays) and dither seed of a channel, all an     //
+        //                  even number of words. The rates (codes or planned)  //
+        //                  and uiNInSamples must be set. The coefficients of   //
+        //                  designed filters are not included, see              //
+        //                  ASRC_planned_length                                 //
+        // ==================================================================== //
+        unsigned int                    ASRC_arena_length(asrc_ctrl_t* pasrc_ctrl, unsigned int* puiStackLength);
+
+#ifndef __xcore__
+        // ==================================================================== //
+        // Function:        ASRC_planned_length                                 //
+        // Arguments:       ASRCPlannedFilters_t *psPlanned: Planned filters    //
+        // Return values:   Coefficient words of the filters, an even number    //
+        // Description:     Length of psPlanned->piCoefs for the filters        //
+        //                  planned by ASRC_plan_rates (0 if psPlanned is 0)    //
+        // ==================================================================== //
+        unsigned int                    ASRC_planned_length(ASRCPlannedFilters_t* psPlanned);
+#endif
+
+        // ==================================================================== //
+        // Function:        ASRC_set_min_phase                                  //
+        // Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+        //                  unsigned int uiMinPhase: 1 for the minimum phase    //
+        //                               filters, 0 for the linear phase ones   //
+        // Return values:   None                                                //
+        // Description:     Selects the coefficients of the F1 and F2 filters   //
+        //                  of an initialized ASRC, and on hosts its F3 phases. //
+        //                  The minimum phase filters have the same numbers of  //
+        //                  taps                                                //
+        // ==================================================================== //
+        void                            ASRC_set_min_phase(asrc_ctrl_t* pasrc_ctrl, unsigned int uiMinPhase);
+
+#ifndef __xcore__
+        // ==================================================================== //
+        // Function:        ASRC_set_quality                                    //
+        // Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+        //                  unsigned int uiQuality: ASRC_QUALITY_LOW or         //
+        //                               ASRC_QUALITY_STANDARD                  //
+        // Return values:   ASRC_NO_ERROR on success                            //
+        //                  ASRC_ERROR on failure                               //
+        // Description:     Sets up the F1 and F2 filters and the F3 phases of  //
+        //                  a quality tier for an initialized ASRC, keeping the //
+        //                  phase response, and syncs it. The F1 and F2 filters //
+        //                  of a tier are not longer than the standard ones, so //
+        //                  they keep their delay lines. ASRC_init sets the     //
+        //                  standard tier                                       //
+        // ==================================================================== //
+        ASRCReturnCodes_t               ASRC_set_quality(asrc_ctrl_t* pasrc_ctrl, unsigned int uiQuality);
+#endif
+
         // ==================================================================== //
         // Function:        ASRC_sync                                            //
         // Arguments:        asrc_ctrl_t     *pasrc_ctrl: Ctrl strct.                //
@@ -293,6 +508,20 @@
         // ==================================================================== //
         ASRCReturnCodes_t                ASRC_proc_dither(asrc_ctrl_t* pasrc_ctrl);
 
+#ifndef __xcore__
+        // ==================================================================== //
+        // Function:        ASRC_set_io_step                                    //
+        // Arguments:       asrc_ctrl_t *pasrc_ctrl: Ctrl strct.                //
+        //                  unsigned int uiIOStep: Sample step in the input and //
+        //                               output buffers                         //
+        // Return values:   None                                                //
+        // Description:     Sets the step of F0/F1 input and of the F3 output.  //
+        //                  ASRC_init sets it to uiNchannels (interleaved       //
+        //                  buffers), planar buffers have a step of 1           //
+        // ==================================================================== //
+        void                            ASRC_set_io_step(asrc_ctrl_t* pasrc_ctrl, unsigned int uiIOStep);
+#endif
+
     #endif // nINCLUDE_FROM_ASM
 
 #endif // _SRC_MRHF_ASRC_H_
@@ -0,0 +1,293 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// ASRC float32 implementation file (host only). Set up and F1/F2 processing
+// as in src_mrhf_asrc.c, the F3 stage is run by asrc_f32_process().
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+// ===========================================================================
+//
+// Includes
+//
+// ===========================================================================
+#include "src.h"
+
+
+// ===========================================================================
+//
+// Defines
+//
+// ===========================================================================
+
+// Scale of the Q1.31 coefficients
+#define        ASRC_F32_Q31                         (1.0f / 2147483648.0f)
+
+
+// ===========================================================================
+//
+// Local Functions prototypes
+//
+// ===========================================================================
+
+static FIRReturnCodes_t         ASRC_f32_init_fir(asrc_f32_ctrl_t* pasrc_ctrl, FIRCtrlF32_t* psFIRCtrl, unsigned int uiFID, unsigned int uiIndex);
+
+
+// ===========================================================================
+//
+// Functions implementations
+//
+// ===========================================================================
+
+// ==================================================================== //
+// Function:        ASRC_f32_init_fir                                   //
+// Arguments:       asrc_f32_ctrl_t *pasrc_ctrl: Ctrl strct.            //
+//                  FIRCtrlF32_t *psFIRCtrl: F0, F1 or F2 Ctrl strct.   //
+//                  unsigned int uiFID: Filter ID                       //
+//                  unsigned int uiIndex: Index of the filter           //
+// Return values:   FIR_NO_ERROR on success                             //
+//                  FIR_ERROR on failure                                //
+// Description:     Inits the FIR from the tables, or with the float32  //
+//                  copy of the filter designed by ASRC_plan_rates      //
+// ==================================================================== //
+static FIRReturnCodes_t         ASRC_f32_init_fir(asrc_f32_ctrl_t* pasrc_ctrl, FIRCtrlF32_t* psFIRCtrl, unsigned int uiFID, unsigned int uiIndex)
+{
+    FIRDescriptor_t             sPlannedDescriptor;
+    FIRDescriptor_t*            psFIRDescriptor;
+    unsigned int                uiOffset    = 0;
+    unsigned int                ui;
+
+    if(uiFID != ASRC_FIR_PLANNED_ID)
+        return FIR_f32_init_from_desc(psFIRCtrl, &sASRCFirDescriptor[uiFID]);
+
+    // The float32 coefficients come one after the other, as the designed ones
+    psFIRDescriptor             = ASRC_planned_descriptor(&pasrc_ctrl->sPlanned, uiIndex, &sPlannedDescriptor);
+    for(ui = 0; ui < uiIndex; ui++)
+        uiOffset               += pasrc_ctrl->sPlanned.uiNCoefs[ui];
+    return FIR_f32_init_from_coefs(psFIRCtrl, psFIRDescriptor, (psFIRDescriptor->uiNCoefs != 0) ?
+                                   &pasrc_ctrl->fPlannedCoefs[uiOffset] : 0);
+}
+
+// ==================================================================== //
+// Function:        ASRC_f32_set_planned                                //
+// Arguments:       asrc_f32_ctrl_t *pasrc_ctrl: Ctrl strct.            //
+//                  ASRCPlannedFilters_t *psPlanned: Filters designed   //
+//                               by ASRC_plan_rates (0 if none)         //
+// Return values:   None                                                //
+// Description:     Takes a float32 copy of the designed filters        //
+// ==================================================================== //
+void                            ASRC_f32_set_planned(asrc_f32_ctrl_t* pasrc_ctrl, ASRCPlannedFilters_t* psPlanned)
+{
+    unsigned int                ui;
+
+    for(ui = 0; ui < ASRC_N_PLANNED_F; ui++)
+    {
+        pasrc_ctrl->sPlanned.eType[ui]      = (psPlanned != 0) ? psPlanned->eType[ui] : FIR_TYPE_SYNC;
+        pasrc_ctrl->sPlanned.uiNCoefs[ui]   = (psPlanned != 0) ? psPlanned->uiNCoefs[ui] : 0;
+    }
+    // Only the float32 copy is kept
+    pasrc_ctrl->sPlanned.piCoefs            = 0;
+    for(ui = 0; ui < ASRC_planned_length(psPlanned); ui++)
+        pasrc_ctrl->fPlannedCoefs[ui]       = (float)psPlanned->piCoefs[ui] * ASRC_F32_Q31;
+}
+
+// ==================================================================== //
+// Function:        ASRC_f32_init                                       //
+// Arguments:       asrc_f32_ctrl_t *pasrc_ctrl: Ctrl strct.            //
+// Return values:   ASRC_NO_ERROR on success                            //
+//                  ASRC_ERROR on failure                               //
+// Description:     Inits the ASRC passed as argument                   //
+// ==================================================================== //
+ASRCReturnCodes_t               ASRC_f32_init(asrc_f32_ctrl_t* pasrc_ctrl)
+{
+    ASRCFiltersIDs_t*           psFiltersID;
+    SRCKernelsF32_t             sKernels;
+    float*                      pfDelays            = 0;
+    unsigned int                ui;
+
+    // Check if state and stack are allocated
+    if(pasrc_ctrl->psState == 0)
+        return ASRC_ERROR;
+    if(pasrc_ctrl->pfStack == 0)
+        return ASRC_ERROR;
+
+    // Rates planned by ASRC_plan_rates come with their filters IDs and fs ratio configuration
+    if( (pasrc_ctrl->eInFs != ASRC_FS_PLANNED) || (pasrc_ctrl->eOutFs != ASRC_FS_PLANNED) )
+    {
+        if( (pasrc_ctrl->eInFs < ASRC_FS_MIN) || (pasrc_ctrl->eInFs > ASRC_FS_MAX))
+            return ASRC_ERROR;
+        if( (pasrc_ctrl->eOutFs < ASRC_FS_MIN) || (pasrc_ctrl->eOutFs > ASRC_FS_MAX))
+            return ASRC_ERROR;
+
+        pasrc_ctrl->sFiltersIDs     = sASRCFiltersIDs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs];
+        pasrc_ctrl->sFsRatioConfig  = sFsRatioConfigs[pasrc_ctrl->eInFs][pasrc_ctrl->eOutFs];
+        for(ui = 0; ui < ASRC_N_PLANNED_F; ui++)
+            pasrc_ctrl->sPlanned.uiNCoefs[ui]   = 0;
+    }
+
+    // Set nominal fs ratio
+    pasrc_ctrl->uiFsRatio       = pasrc_ctrl->sFsRatioConfig.uiNominalFsRatio;
+    pasrc_ctrl->uiFsRatio_lo    = pasrc_ctrl->sFsRatioConfig.uiNominalFsRatio_lo;
+
+    // Check that number of input samples is allocated and is a multiple of 4
+    if(pasrc_ctrl->uiNInSamples == 0)
+        return ASRC_ERROR;
+    if((pasrc_ctrl->uiNInSamples & 0x3) != 0x0)
+        return ASRC_ERROR;
+
+    psFiltersID                 = &pasrc_ctrl->sFiltersIDs;
+
+    // Designed filters run on the float32 copy of ASRC_f32_set_planned, with their delay lines one after the other
+    if( (psFiltersID->uiFID[ASRC_F1_INDEX] == ASRC_FIR_PLANNED_ID) || (psFiltersID->uiFID[ASRC_F2_INDEX] == ASRC_FIR_PLANNED_ID) )
+        pfDelays                                = pasrc_ctrl->psState->fDelayFIRPlanned;
+
+    // Filter F0
+    // ---------
+    pasrc_ctrl->sFIRF0Ctrl.uiNInSamples         = pasrc_ctrl->uiNInSamples;
+    pasrc_ctrl->sFIRF0Ctrl.uiInStep             = pasrc_ctrl->uiNchannels;
+    pasrc_ctrl->sFIRF0Ctrl.pfDelayB             = pfDelays;
+    pasrc_ctrl->sFIRF0Ctrl.uiOutStep            = 1;
+    pasrc_ctrl->sFIRF0Ctrl.pfOut                = pasrc_ctrl->pfStack;
+
+    if(ASRC_f32_init_fir(pasrc_ctrl, &pasrc_ctrl->sFIRF0Ctrl, ASRC_FIR_PLANNED_ID, ASRC_F0_INDEX) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+
+    // Filter F1
+    // ---------
+    if(pasrc_ctrl->sFIRF0Ctrl.eEnable == FIR_ON)
+    {
+        // In place on the stack after F0
+        pasrc_ctrl->sFIRF1Ctrl.uiNInSamples     = pasrc_ctrl->sFIRF0Ctrl.uiNOutSamples;
+        pasrc_ctrl->sFIRF1Ctrl.uiInStep         = 1;
+        pasrc_ctrl->sFIRF1Ctrl.pfIn             = pasrc_ctrl->pfStack;
+        pfDelays                               += pasrc_ctrl->sFIRF0Ctrl.uiDelayL;
+    }
+    else
+    {
+        pasrc_ctrl->sFIRF1Ctrl.uiNInSamples     = pasrc_ctrl->uiNInSamples;
+        pasrc_ctrl->sFIRF1Ctrl.uiInStep         = pasrc_ctrl->uiNchannels;
+    }
+    if( pfDelays != 0 )
+        pasrc_ctrl->sFIRF1Ctrl.pfDelayB         = pfDelays;
+    else if( psFiltersID->uiFID[ASRC_F1_INDEX] == FILTER_DEFS_ASRC_FIR_DS_ID )
+        pasrc_ctrl->sFIRF1Ctrl.pfDelayB         = pasrc_ctrl->psState->fDelayFIRShort;
+    else
+        pasrc_ctrl->sFIRF1Ctrl.pfDelayB         = pasrc_ctrl->psState->fDelayFIRLong;
+    pasrc_ctrl->sFIRF1Ctrl.uiOutStep            = 1;
+
+    if(ASRC_f32_init_fir(pasrc_ctrl, &pasrc_ctrl->sFIRF1Ctrl, psFiltersID->uiFID[ASRC_F1_INDEX], ASRC_F1_INDEX) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+
+    if( psFiltersID->uiFID[ASRC_F1_INDEX] != FILTER_DEFS_ASRC_FIR_NONE_ID )
+        pasrc_ctrl->uiNSyncSamples              = pasrc_ctrl->sFIRF1Ctrl.uiNOutSamples;
+
+    // Filter F2
+    // ---------
+    pasrc_ctrl->sFIRF2Ctrl.uiNInSamples         = pasrc_ctrl->sFIRF1Ctrl.uiNOutSamples;
+    pasrc_ctrl->sFIRF2Ctrl.uiInStep             = pasrc_ctrl->sFIRF1Ctrl.uiOutStep;
+    // Second filter is always long with ASRC
+    if( pfDelays != 0 )
+        pasrc_ctrl->sFIRF2Ctrl.pfDelayB         = pfDelays + pasrc_ctrl->sFIRF1Ctrl.uiDelayL;
+    else
+        pasrc_ctrl->sFIRF2Ctrl.pfDelayB         = pasrc_ctrl->psState->fDelayFIRLong;
+    pasrc_ctrl->sFIRF2Ctrl.uiOutStep            = 1;
+
+    if(ASRC_f32_init_fir(pasrc_ctrl, &pasrc_ctrl->sFIRF2Ctrl, psFiltersID->uiFID[ASRC_F2_INDEX], ASRC_F2_INDEX) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+
+    if( psFiltersID->uiFID[ASRC_F2_INDEX] != FILTER_DEFS_ASRC_FIR_NONE_ID )
+        pasrc_ctrl->uiNSyncSamples              = pasrc_ctrl->sFIRF2Ctrl.uiNOutSamples;
+
+    // F1 and F2 output to the stack, F1 input is only from the stack after F0
+    pasrc_ctrl->sFIRF2Ctrl.pfIn                 = pasrc_ctrl->pfStack;
+    pasrc_ctrl->sFIRF1Ctrl.pfOut                = pasrc_ctrl->pfStack;
+    pasrc_ctrl->sFIRF2Ctrl.pfOut                = pasrc_ctrl->pfStack;
+
+    // Filter F3
+    // ---------
+    pasrc_ctrl->sADFIRF3Ctrl.pfDelayB           = pasrc_ctrl->psState->fDelayADFIR;
+    if(ADFIR_f32_init_from_desc(&pasrc_ctrl->sADFIRF3Ctrl, &sADFirDescriptor) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+
+    pasrc_ctrl->pfADFirCoefs                    = ADFIR_f32_coefs();
+    src_isa_get_kernels_f32(&sKernels);
+    pasrc_ctrl->pvSplineCoeffGen                = sKernels.pvSpline;
+
+    return ASRC_f32_sync(pasrc_ctrl);
+}
+
+// ==================================================================== //
+// Function:        ASRC_f32_sync                                       //
+// Arguments:       asrc_f32_ctrl_t *pasrc_ctrl: Ctrl strct.            //
+// Return values:   ASRC_NO_ERROR on success                            //
+//                  ASRC_ERROR on failure                               //
+// Description:     Syncs the ASRC passed as argument                   //
+// ==================================================================== //
+ASRCReturnCodes_t               ASRC_f32_sync(asrc_f32_ctrl_t* pasrc_ctrl)
+{
+    unsigned int    uiFsRatio       = pasrc_ctrl->uiFsRatio;
+    unsigned int    uiFsRatio_low   = pasrc_ctrl->uiFsRatio_lo;
+
+    // Sync the FIR and ADFIR
+    if(FIR_f32_sync(&pasrc_ctrl->sFIRF0Ctrl) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+    if(FIR_f32_sync(&pasrc_ctrl->sFIRF1Ctrl) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+    if(FIR_f32_sync(&pasrc_ctrl->sFIRF2Ctrl) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+    if(ADFIR_f32_sync(&pasrc_ctrl->sADFIRF3Ctrl) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+
+    // Reset time
+    pasrc_ctrl->iTimeInt        = FILTER_DEFS_ADFIR_N_PHASES + ASRC_ADFIR_INITIAL_PHASE;
+    pasrc_ctrl->uiTimeFract     = 0;
+
+    // Update time step based on Fs ratio, as ASRC_update_fs_ratio
+    if( (uiFsRatio < pasrc_ctrl->sFsRatioConfig.uiMinFsRatio) ||
+        (uiFsRatio > pasrc_ctrl->sFsRatioConfig.uiMaxFsRatio) )
+        return ASRC_ERROR;
+    pasrc_ctrl->iTimeStepInt     = uiFsRatio >> (pasrc_ctrl->sFsRatioConfig.iFsRatioShift);
+    pasrc_ctrl->uiTimeStepFract  = uiFsRatio << (32 - pasrc_ctrl->sFsRatioConfig.iFsRatioShift);
+    pasrc_ctrl->uiTimeStepFract |= (uint32_t)(uiFsRatio_low >> pasrc_ctrl->sFsRatioConfig.iFsRatioShift);
+
+    return ASRC_NO_ERROR;
+}
+
+// ==================================================================== //
+// Function:        ASRC_f32_proc_F1_F2                                 //
+// Arguments:       asrc_f32_ctrl_t *pasrc_ctrl: Ctrl strct.            //
+// Return values:   ASRC_NO_ERROR on success                            //
+//                  ASRC_ERROR on failure                               //
+// Description:     Processes F0, F1 and F2 for a channel               //
+// ==================================================================== //
+ASRCReturnCodes_t               ASRC_f32_proc_F1_F2(asrc_f32_ctrl_t* pasrc_ctrl)
+{
+    // Setup variable input buffer, F0 halves the rate into the stack for F1 to run in place
+    if(pasrc_ctrl->sFIRF0Ctrl.eEnable == FIR_ON)
+    {
+        pasrc_ctrl->sFIRF0Ctrl.pfIn     = pasrc_ctrl->pfIn;
+        if(pasrc_ctrl->sFIRF0Ctrl.pvProc(&pasrc_ctrl->sFIRF0Ctrl) != FIR_NO_ERROR)
+            return ASRC_ERROR;
+    }
+    else
+        pasrc_ctrl->sFIRF1Ctrl.pfIn     = pasrc_ctrl->pfIn;
+
+    // F1 is always enabled
+    if(pasrc_ctrl->sFIRF1Ctrl.pvProc(&pasrc_ctrl->sFIRF1Ctrl) != FIR_NO_ERROR)
+        return ASRC_ERROR;
+
+    if(pasrc_ctrl->sFIRF2Ctrl.eEnable == FIR_ON)
+    {
+        if(pasrc_ctrl->sFIRF2Ctrl.pvProc(&pasrc_ctrl->sFIRF2Ctrl) != FIR_NO_ERROR)
+            return ASRC_ERROR;
+    }
+
+    return ASRC_NO_ERROR;
+}
+
+#endif // !__xcore__
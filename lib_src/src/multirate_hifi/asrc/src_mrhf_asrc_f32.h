@@ -0,0 +1,131 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Definition file for the host float32 ASRC. It has the filters, F3 time
+// and Fs ratio handling of the ASRC in src_mrhf_asrc.h, with float32
+// samples (1.0 is full scale) and coefficients. There is no dither.
+//
+// ===========================================================================
+// ===========================================================================
+
+#ifndef _SRC_MRHF_ASRC_F32_H_
+#define _SRC_MRHF_ASRC_F32_H_
+
+#if !defined(__xcore__)
+
+    // ===========================================================================
+    //
+    // Includes
+    //
+    // ===========================================================================
+    #include "src_mrhf_asrc.h"
+    #include "src_mrhf_fir_f32.h"
+
+    // ===========================================================================
+    //
+    // TypeDefs
+    //
+    // ===========================================================================
+
+    #ifndef INCLUDE_FROM_ASM
+
+        // ASRC float32 State structure
+        // ----------------------------
+        typedef struct _ASRCStateF32
+        {
+            float                                   fDelayFIRLong[2 * FILTER_DEFS_FIR_MAX_TAPS_LONG] __attribute__((aligned(32)));     // Doubled length for circular buffer simulation
+            float                                   fDelayFIRShort[2 * FILTER_DEFS_FIR_MAX_TAPS_SHORT] __attribute__((aligned(32)));   // Doubled length for circular buffer simulation
+            float                                   fDelayADFIR[2 * FILTER_DEFS_ADFIR_PHASE_N_TAPS] __attribute__((aligned(32)));      // Doubled length for circular buffer simulation
+            float                                   fDelayFIRPlanned[ASRC_PLAN_DELAY_LENGTH] __attribute__((aligned(32)));            // Delay lines of F0, F1 and F2 in turn, for a pair with designed filters
+        } asrc_f32_state_t;
+
+        // ASRC float32 Control structure
+        // ------------------------------
+        typedef struct _ASRCCtrlF32
+        {
+            unsigned int                            uiNchannels;                        // Number of channels in this instance
+            float*                                  pfIn;                               // Input buffer pointer (channels time domain interleaved)
+            unsigned int                            uiNInSamples;                       // Number of input samples to process in one call to the processing function
+            unsigned int                            uiNSyncSamples;                     // Number of synchronous samples produced in one call to the processing function
+            ASRCFs_t                                eInFs;                              // Input sampling rate code
+            float*                                  pfOut;                              // Output buffer pointer (channels time domain interleaved)
+            unsigned int                            uiNASRCOutSamples;                  // Number of output samples produced during last call to the processing function
+            ASRCFs_t                                eOutFs;                             // Output sampling rate code
+
+            FIRCtrlF32_t                            sFIRF0Ctrl;                         // F0 FIR controller, only for designed filters
+            FIRCtrlF32_t                            sFIRF1Ctrl;                         // F1 FIR controller
+            FIRCtrlF32_t                            sFIRF2Ctrl;                         // F2 FIR controller
+            ADFIRCtrlF32_t                          sADFIRF3Ctrl;                       // F3 ADFIR controller
+
+            unsigned int                            uiFsRatio;                          // Fs ratio: Fsin / Fsout
+            unsigned int                            uiFsRatio_lo;
+
+            int                                     iTimeInt;                           // Integer part of time
+            unsigned int                            uiTimeFract;                        // Fractional part of time
+            int                                     iTimeStepInt;                       // Integer part of time step
+            unsigned int                            uiTimeStepFract;                    // Fractional part of time step
+
+            ASRCFiltersIDs_t                        sFiltersIDs;                        // F1 and F2 filter IDs, from the tables or planned
+            ASRCFsRatioConfigs_t                    sFsRatioConfig;                     // Fs ratio configuration, from the tables or planned
+            ASRCPlannedFilters_t                    sPlanned;                           // Filters designed by ASRC_plan_rates, without their coefficients
+            float                                   fPlannedCoefs[ASRC_PLAN_COEFS_LENGTH] __attribute__((aligned(32)));   // Their float32 copy, set by ASRC_f32_set_planned
+
+            float*                                  pfADFirCoefs;                       // F3 phases, FILTER_DEFS_ADFIR_N_PHASES + 2 of FILTER_DEFS_ADFIR_PHASE_N_TAPS
+            SRCSplineF32_t                          pvSplineCoeffGen;                   // F3 spline coefficient generation, selected at init
+
+            asrc_f32_state_t*                       psState;                            // Pointer to state structure
+            float*                                  pfStack;                            // Pointer to stack buffer
+        } asrc_f32_ctrl_t;
+
+        // ===========================================================================
+        //
+        // Function prototypes
+        //
+        // ===========================================================================
+
+        // ==================================================================== //
+        // Function:        ASRC_f32_init                                       //
+        // Arguments:       asrc_f32_ctrl_t *pasrc_ctrl: Ctrl strct.            //
+        // Return values:   ASRC_NO_ERROR on success                            //
+        //                  ASRC_ERROR on failure                               //
+        // Description:     As ASRC_init. Planned rates are copied from an      //
+        //                  asrc_ctrl_t set up by ASRC_plan_rates, and their    //
+        //                  designed filters set by ASRC_f32_set_planned        //
+        // ==================================================================== //
+        ASRCReturnCodes_t               ASRC_f32_init(asrc_f32_ctrl_t* pasrc_ctrl);
+
+        // ==================================================================== //
+        // Function:        ASRC_f32_set_planned                                //
+        // Arguments:       asrc_f32_ctrl_t *pasrc_ctrl: Ctrl strct.            //
+        //                  ASRCPlannedFilters_t *psPlanned: Filters designed   //
+        //                               by ASRC_plan_rates (0 if none)         //
+        // Return values:   None                                                //
+        // Description:     Takes a float32 copy of the designed filters        //
+        // ==================================================================== //
+        void                            ASRC_f32_set_planned(asrc_f32_ctrl_t* pasrc_ctrl, ASRCPlannedFilters_t* psPlanned);
+
+        // ==================================================================== //
+        // Function:        ASRC_f32_sync                                       //
+        // Arguments:       asrc_f32_ctrl_t *pasrc_ctrl: Ctrl strct.            //
+        // Return values:   ASRC_NO_ERROR on success                            //
+        //                  ASRC_ERROR on failure                               //
+        // Description:     As ASRC_sync                                        //
+        // ==================================================================== //
+        ASRCReturnCodes_t               ASRC_f32_sync(asrc_f32_ctrl_t* pasrc_ctrl);
+
+        // ==================================================================== //
+        // Function:        ASRC_f32_proc_F1_F2                                 //
+        // Arguments:       asrc_f32_ctrl_t *pasrc_ctrl: Ctrl strct.            //
+        // Return values:   ASRC_NO_ERROR on success                            //
+        //                  ASRC_ERROR on failure                               //
+        // Description:     Processes F0, F1 and F2 for a channel, to the stack //
+        // ==================================================================== //
+        ASRCReturnCodes_t               ASRC_f32_proc_F1_F2(asrc_f32_ctrl_t* pasrc_ctrl);
+
+    #endif // nINCLUDE_FROM_ASM
+
+#endif // !__xcore__
+
+#endif // _SRC_MRHF_ASRC_F32_H_
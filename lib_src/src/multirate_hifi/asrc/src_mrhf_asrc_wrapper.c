@@ -5,16 +5,30 @@
 #include <stdio.h>
 #include <time.h>
 #include <math.h>
+#include <string.h>
+#ifdef __xcore__
 #include <timer.h>
 #include "debug_print.h"
+#else
+#define debug_printf(...)       fprintf(stderr, __VA_ARGS__)
+#define delay_milliseconds(x)
+#endif
 
 // ASRC includes
 #include "src.h"
 #include "use_vpu.h"
-
-extern ASRCFsRatioConfigs_t     sFsRatioConfigs[ASRC_N_FS][ASRC_N_FS];
+#ifndef __xcore__
+#include "src_mrhf_isa.h"
+#endif
 
 #define DO_FS_BOUNDS_CHECK      1   //This is important to prevent pointers going out of bounds when invalid fs_ratios are sent
+#define ASRC_ARENA_COEFS_LENGTH ((ASRC_ADFIR_COEFS_LENGTH + 1) & ~1)  // AD FIR coefficients at the start of an arena, padded to 64 bits
+
+#ifndef __xcore__
+#define ASRC_ARENA_PLANNED_LENGTH   (((sizeof(ASRCPlannedFilters_t) + 7) & ~7) / sizeof(int))  // Designed filters at the start of a rates arena, padded to 64 bits
+#define ASRC_F3_PLAN_MAX_INSTANTS   64  // Output instants planned for the host F3 stage before their coefficients are built and maccs run
+#define ASRC_MT_SPIN                4096  // Polls of a barrier of asrc_mt_t before the thread sleeps
+#endif
 
 static void asrc_error(int code)
 {
@@ -24,17 +38,14 @@ static void asrc_error(int code)
 }
 
 
-uint64_t asrc_init(const fs_code_t sr_in, const fs_code_t sr_out, asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+// Inits the channels of an instance whose rates have been set (as codes, or planned)
+static uint64_t asrc_init_channels(asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
         const unsigned n_in_samples, const dither_flag_t dither_on_off)
 {
     unsigned ui;
 
     ASRCReturnCodes_t ret_code;
 
-    ret_code = ASRC_prepare_coefs();
-
-    if (ret_code != ASRC_NO_ERROR) asrc_error(10);
-
     //Check to see if n_channels_per_instance, n_in_samples are reasonable
     if ((n_in_samples & 0x1) || (n_in_samples < 4)) asrc_error(100);
     if (n_channels_per_instance < 1) asrc_error(101);
@@ -44,10 +55,6 @@ uint64_t asrc_init(const fs_code_t sr_in, const fs_code_t sr_out, asrc_ctrl_t as
         // Set number of channels per instance
         asrc_ctrl[ui].uiNchannels               = n_channels_per_instance;
 
-        // Set input/output sampling rate codes
-        asrc_ctrl[ui].eInFs                     = (int)sr_in;
-        asrc_ctrl[ui].eOutFs                    = (int)sr_out;
-
         // Set number of samples
         asrc_ctrl[ui].uiNInSamples              = n_in_samples;
 
@@ -59,6 +66,19 @@ uint64_t asrc_init(const fs_code_t sr_in, const fs_code_t sr_out, asrc_ctrl_t as
         ret_code = ASRC_init(&asrc_ctrl[ui]);
 
         if (ret_code != ASRC_NO_ERROR) asrc_error(11);
+
+#if !defined(__xcore__) && (defined(__x86_64__) || defined(__i386__))
+        // With AVX-512 the F3 macc loop of all channels shares one load of the adaptive coefficients
+        asrc_ctrl[ui].pvADFIRMulti              = (n_channels_per_instance > 1 && src_isa_detect() >= SRC_ISA_AVX512) ?
+                                                    src_mrhf_adfir_inner_loop_multi_avx512 : 0;
+#elif !defined(__xcore__)
+        asrc_ctrl[ui].pvADFIRMulti              = 0;
+#endif
+#ifndef __xcore__
+        asrc_ctrl[ui].piF3DelayInterleaved      = 0;
+        asrc_ctrl[ui].piPullBuffer              = 0;
+        asrc_ctrl[ui].piPassBuffer              = 0;
+#endif
     }
 
     // Sync
@@ -73,45 +93,576 @@ uint64_t asrc_init(const fs_code_t sr_in, const fs_code_t sr_out, asrc_ctrl_t as
     return (uint64_t)((((uint64_t)asrc_ctrl[0].uiFsRatio) << 32) | asrc_ctrl[0].uiFsRatio_lo);
 }
 
-unsigned asrc_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_ctrl_t asrc_ctrl[]){
+uint64_t asrc_init(const fs_code_t sr_in, const fs_code_t sr_out, asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+        const unsigned n_in_samples, const dither_flag_t dither_on_off)
+{
+    // Set input/output sampling rate codes, the delay lines are in the state structures
+    for(unsigned ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        asrc_ctrl[ui].eInFs                     = (int)sr_in;
+        asrc_ctrl[ui].eOutFs                    = (int)sr_out;
+        asrc_ctrl[ui].piDelays                  = 0;
+    }
 
-    int ui, uj; //General counters
-    int             uiSplCntr;  //Spline counter
+    return asrc_init_channels(asrc_ctrl, n_channels_per_instance, n_in_samples, dither_on_off);
+}
 
-    // Get the number of channels per instance from first channel
-    const unsigned n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+// Plans the rates once for an instance, into the designed filters asrc_ctrl[0].psPlanned points to on
+// hosts, and takes the plan over into each channel
+static void asrc_plan_channels(const unsigned fs_in, const unsigned fs_out, asrc_ctrl_t asrc_ctrl[],
+        const unsigned n_channels_per_instance)
+{
+    if(ASRC_plan_rates(&asrc_ctrl[0], fs_in, fs_out) != ASRC_NO_ERROR) asrc_error(13);
 
-    uint32_t fs_ratio_hi = (uint32_t)(fs_ratio >> 32);
-    uint32_t fs_ratio_lo = (uint32_t)(fs_ratio);
+    for(unsigned ui = 1; ui < n_channels_per_instance; ui++)
+    {
+        asrc_ctrl[ui].eInFs                     = asrc_ctrl[0].eInFs;
+        asrc_ctrl[ui].eOutFs                    = asrc_ctrl[0].eOutFs;
+        asrc_ctrl[ui].sFiltersIDs               = asrc_ctrl[0].sFiltersIDs;
+        asrc_ctrl[ui].sFsRatioConfig            = asrc_ctrl[0].sFsRatioConfig;
+#ifndef __xcore__
+        asrc_ctrl[ui].psPlanned                 = asrc_ctrl[0].psPlanned;
+#endif
+    }
+}
 
-    for(ui = 0; ui < n_channels_per_instance; ui++)
+// Words of the designed filters at the start of the arena of an instance whose rates have been planned
+static unsigned asrc_arena_planned_length(asrc_ctrl_t* pasrc_ctrl)
+{
+#ifndef __xcore__
+    if(pasrc_ctrl->psPlanned != 0)
+        return ASRC_ARENA_PLANNED_LENGTH + ASRC_planned_length(pasrc_ctrl->psPlanned);
+#else
+    (void)pasrc_ctrl;
+#endif
+    return 0;
+}
+
+// Arena bytes of an instance whose rates have been set in a control structure (as codes, or planned)
+static unsigned asrc_arena_size(asrc_ctrl_t* pasrc_ctrl, const unsigned n_channels_per_instance, const unsigned n_in_samples)
+{
+    unsigned        uiStackLength;
+    unsigned        uiLength;
+
+    pasrc_ctrl->uiNInSamples    = n_in_samples;
+    uiLength                    = ASRC_arena_length(pasrc_ctrl, &uiStackLength);
+    if (uiLength == 0) asrc_error(15);
+
+    // The designed filters and the adaptive coefficients shared by the channels, then the stack, delay
+    // lines and seed of each channel
+    return (asrc_arena_planned_length(pasrc_ctrl) + ASRC_ARENA_COEFS_LENGTH + n_channels_per_instance * uiLength) * sizeof(int);
+}
+
+// Carves the arena after the designed filters into the channels of an instance whose rates have been set, and inits them
+static uint64_t asrc_init_arena_channels(asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+        const unsigned n_in_samples, const dither_flag_t dither_on_off, int *piArena)
+{
+    unsigned        uiStackLength;
+    unsigned        uiLength;
+
+    for(unsigned ui = 0; ui < n_channels_per_instance; ui++)
     {
-    // Update Fs Ratio
-        asrc_ctrl[ui].uiFsRatio     = fs_ratio_hi;
-        asrc_ctrl[ui].uiFsRatio_lo = fs_ratio_lo;
+        asrc_ctrl[ui].uiNInSamples              = n_in_samples;
+        uiLength                                = ASRC_arena_length(&asrc_ctrl[ui], &uiStackLength);
+        if (uiLength == 0) asrc_error(15);
+
+        // Carved as sized by asrc_arena_size()
+        asrc_ctrl[ui].psState                   = 0;
+        asrc_ctrl[ui].piADCoefs                 = piArena;
+        asrc_ctrl[ui].piStack                   = piArena + ASRC_ARENA_COEFS_LENGTH + ui * uiLength;
+        asrc_ctrl[ui].piDelays                  = asrc_ctrl[ui].piStack + uiStackLength;
+    }
+
+    return asrc_init_channels(asrc_ctrl, n_channels_per_instance, n_in_samples, dither_on_off);
+}
+
+uint64_t asrc_init_rates(const unsigned fs_in, const unsigned fs_out, asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+        const unsigned n_in_samples, const dither_flag_t dither_on_off)
+{
+    // Plan the filter chain for the rates. Pairs whose filters are designed need asrc_init_rates_arena()
+#ifndef __xcore__
+    asrc_ctrl[0].psPlanned                      = 0;
+#endif
+    asrc_plan_channels(fs_in, fs_out, asrc_ctrl, n_channels_per_instance);
+
+    // The delay lines are in the state structures
+    for(unsigned ui = 0; ui < n_channels_per_instance; ui++)
+        asrc_ctrl[ui].piDelays                  = 0;
+
+    return asrc_init_channels(asrc_ctrl, n_channels_per_instance, n_in_samples, dither_on_off);
+}
+
+unsigned asrc_get_memory_requirements(const fs_code_t sr_in, const fs_code_t sr_out, const unsigned n_channels_per_instance,
+        const unsigned n_in_samples)
+{
+    asrc_ctrl_t     sCtrl;
 
+    sCtrl.eInFs                 = (int)sr_in;
+    sCtrl.eOutFs                = (int)sr_out;
+#ifndef __xcore__
+    sCtrl.psPlanned             = 0;
+#endif
+    return asrc_arena_size(&sCtrl, n_channels_per_instance, n_in_samples);
+}
+
+uint64_t asrc_init_arena(const fs_code_t sr_in, const fs_code_t sr_out, asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+        const unsigned n_in_samples, const dither_flag_t dither_on_off, uint64_t arena[])
+{
+    if (((uintptr_t)arena & 0x7) != 0) asrc_error(15);
+
+    for(unsigned ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        asrc_ctrl[ui].eInFs                     = (int)sr_in;
+        asrc_ctrl[ui].eOutFs                    = (int)sr_out;
+    }
+
+    return asrc_init_arena_channels(asrc_ctrl, n_channels_per_instance, n_in_samples, dither_on_off, (int*)arena);
+}
+
+unsigned asrc_get_memory_requirements_rates(const unsigned fs_in, const unsigned fs_out, const unsigned n_channels_per_instance,
+        const unsigned n_in_samples)
+{
+    asrc_ctrl_t     sCtrl;
+#ifndef __xcore__
+    ASRCPlannedFilters_t sPlanned;
+
+    // Only the numbers of taps of the designed filters are planned
+    sPlanned.piCoefs            = 0;
+    sCtrl.psPlanned             = &sPlanned;
+#endif
+    if(ASRC_plan_rates(&sCtrl, fs_in, fs_out) != ASRC_NO_ERROR) asrc_error(13);
+
+    return asrc_arena_size(&sCtrl, n_channels_per_instance, n_in_samples);
+}
+
+uint64_t asrc_init_rates_arena(const unsigned fs_in, const unsigned fs_out, asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+        const unsigned n_in_samples, const dither_flag_t dither_on_off, uint64_t arena[])
+{
+    if (((uintptr_t)arena & 0x7) != 0) asrc_error(15);
+
+#ifndef __xcore__
+    // The designed filters lead the arena, with their coefficients, as sized by asrc_arena_size()
+    asrc_ctrl[0].psPlanned                      = (ASRCPlannedFilters_t*)arena;
+    asrc_ctrl[0].psPlanned->piCoefs             = (int*)arena + ASRC_ARENA_PLANNED_LENGTH;
+#endif
+    asrc_plan_channels(fs_in, fs_out, asrc_ctrl, n_channels_per_instance);
+
+    return asrc_init_arena_channels(asrc_ctrl, n_channels_per_instance, n_in_samples, dither_on_off,
+                                    (int*)arena + asrc_arena_planned_length(&asrc_ctrl[0]));
+}
+
+void asrc_init_filter_phase(asrc_ctrl_t asrc_ctrl[], const src_filter_phase_t filter_phase)
+{
+    for(unsigned ui = 0; ui < asrc_ctrl[0].uiNchannels; ui++)
+        ASRC_set_min_phase(&asrc_ctrl[ui], filter_phase == SRC_MINIMUM_PHASE);
+}
+
+#ifndef __xcore__
+void asrc_init_quality(asrc_ctrl_t asrc_ctrl[], const asrc_quality_t quality)
+{
+    for(unsigned ui = 0; ui < asrc_ctrl[0].uiNchannels; ui++)
+        if(ASRC_set_quality(&asrc_ctrl[ui], (unsigned)quality) != ASRC_NO_ERROR) asrc_error(18);
+}
+#endif
+
+int asrc_rates_supported(const unsigned fs_in, const unsigned fs_out)
+{
+    asrc_ctrl_t     sCtrl;
+#ifndef __xcore__
+    ASRCPlannedFilters_t sPlanned;
+
+    // Only the numbers of taps of the designed filters are planned
+    sPlanned.piCoefs            = 0;
+    sCtrl.psPlanned             = &sPlanned;
+#endif
+
+    return ASRC_plan_rates(&sCtrl, fs_in, fs_out) == ASRC_NO_ERROR;
+}
+
+// F3 time step for an Fs ratio, integer part in the upper word
+static uint64_t asrc_time_step(const asrc_ctrl_t* pasrc_ctrl, uint64_t fs_ratio)
+{
 #if DO_FS_BOUNDS_CHECK
-        // Check for bounds of new Fs ratio
-        if( (fs_ratio_hi < sFsRatioConfigs[asrc_ctrl[ui].eInFs][asrc_ctrl[ui].eOutFs].uiMinFsRatio) ||
-            (fs_ratio_hi > sFsRatioConfigs[asrc_ctrl[ui].eInFs][asrc_ctrl[ui].eOutFs].uiMaxFsRatio) )
-        {
-            //debug_printf("Passed = %x, Nominal = 0x%x\n", fs_ratio_hi, sFsRatioConfigs[asrc_ctrl[ui].eInFs][asrc_ctrl[ui].eOutFs].uiNominalFsRatio);
-            fs_ratio_hi = sFsRatioConfigs[asrc_ctrl[ui].eInFs][asrc_ctrl[ui].eOutFs].uiNominalFsRatio; //Important to prevent buffer overflow if fs_ratio requests too many samples.
-            fs_ratio_lo = sFsRatioConfigs[asrc_ctrl[ui].eInFs][asrc_ctrl[ui].eOutFs].uiNominalFsRatio_lo;
-            //debug_printf("!");
+    // Check for bounds of new Fs ratio
+    if( ((uint32_t)(fs_ratio >> 32) < pasrc_ctrl->sFsRatioConfig.uiMinFsRatio) ||
+        ((uint32_t)(fs_ratio >> 32) > pasrc_ctrl->sFsRatioConfig.uiMaxFsRatio) )
+    {
+        //Important to prevent buffer overflow if fs_ratio requests too many samples.
+        fs_ratio = (((uint64_t)pasrc_ctrl->sFsRatioConfig.uiNominalFsRatio) << 32) | pasrc_ctrl->sFsRatioConfig.uiNominalFsRatio_lo;
+    }
+#endif
+    // Apply shift to time ratio to build integer and fractional parts of time step
+    return fs_ratio >> ASRC_FS_RATIO_SHIFT(pasrc_ctrl);
+}
+
+static inline void asrc_set_time_step(asrc_ctrl_t* pasrc_ctrl, uint64_t u64Step)
+{
+    pasrc_ctrl->iTimeStepInt       = (int)(u64Step >> 32);
+    pasrc_ctrl->uiTimeStepFract    = (uint32_t)u64Step;
+}
+
+// Steps the F3 time step of a ramp on for the next synchronous sample
+static inline void asrc_ramp_time_step(asrc_ctrl_t* pasrc_ctrl, int64_t i64StepInc)
+{
+    asrc_set_time_step(pasrc_ctrl, ((((uint64_t)(uint32_t)pasrc_ctrl->iTimeStepInt) << 32) | pasrc_ctrl->uiTimeStepFract) + i64StepInc);
+}
+
+#ifndef __xcore__
+void asrc_init_f3_interleaved(asrc_ctrl_t asrc_ctrl[], int delay[])
+{
+    const unsigned  n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+    const unsigned  uiDelayO                = asrc_ctrl[0].sADFIRF3Ctrl.uiDelayO;
+    SRCISA_t        eIsa                    = src_isa_detect();
+    unsigned        ui, uj;
+
+    // Carry the taps over one by one, twice for the circular buffer simulation, so that the
+    // interleaved delay lines start at their base (whether or not the F3 delay lines are mirrored)
+    for(uj = 0; uj < n_channels_per_instance; uj++)
+        for(ui = 0; ui < uiDelayO; ui++)    {
+            delay[ui * n_channels_per_instance + uj]                = asrc_ctrl[uj].sADFIRF3Ctrl.piDelayI[ui];
+            delay[(ui + uiDelayO) * n_channels_per_instance + uj]   = asrc_ctrl[uj].sADFIRF3Ctrl.piDelayI[ui];
         }
+
+    asrc_ctrl[0].piF3DelayInterleaved       = delay;
+    asrc_ctrl[0].uiF3DelayInterleavedI      = 0;
+#if defined(__x86_64__) || defined(__i386__)
+    asrc_ctrl[0].pvADFIRInterleaved         = (eIsa >= SRC_ISA_AVX512) ? src_mrhf_adfir_inner_loop_interleaved_avx512 :
+                                              (eIsa >= SRC_ISA_AVX2)   ? src_mrhf_adfir_inner_loop_interleaved_avx2 :
+                                                                         src_mrhf_adfir_inner_loop_interleaved;
+#else
+    (void)eIsa;
+    asrc_ctrl[0].pvADFIRInterleaved         = src_mrhf_adfir_inner_loop_interleaved;
 #endif
-        // Apply shift to time ratio to build integer and fractional parts of time step
-        asrc_ctrl[ui].iTimeStepInt     = fs_ratio_hi >> (sFsRatioConfigs[asrc_ctrl[ui].eInFs][asrc_ctrl[ui].eOutFs].iFsRatioShift);
-        asrc_ctrl[ui].uiTimeStepFract  = fs_ratio_hi << (32 - sFsRatioConfigs[asrc_ctrl[ui].eInFs][asrc_ctrl[ui].eOutFs].iFsRatioShift);
-        asrc_ctrl[ui].uiTimeStepFract |= (uint32_t)(fs_ratio_lo >> sFsRatioConfigs[asrc_ctrl[ui].eInFs][asrc_ctrl[ui].eOutFs].iFsRatioShift);
+}
+
+int asrc_init_mirrored_delays(asrc_ctrl_t asrc_ctrl[])
+{
+    const unsigned  n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+    unsigned        ui;
+
+    for(ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        if((FIR_mirror(&asrc_ctrl[ui].sFIRF0Ctrl) != FIR_NO_ERROR) ||
+           (FIR_mirror(&asrc_ctrl[ui].sFIRF1Ctrl) != FIR_NO_ERROR) ||
+           (FIR_mirror(&asrc_ctrl[ui].sFIRF2Ctrl) != FIR_NO_ERROR) ||
+           // The F3 delay lines are not used once they are interleaved
+           (!asrc_ctrl[0].piF3DelayInterleaved && (ADFIR_mirror(&asrc_ctrl[ui].sADFIRF3Ctrl) != FIR_NO_ERROR)))
+        {
+            // All or nothing, so the instance is as it was
+            asrc_exit_mirrored_delays(asrc_ctrl);
+            return 0;
+        }
+    }
+    return 1;
+}
 
+void asrc_exit_mirrored_delays(asrc_ctrl_t asrc_ctrl[])
+{
+    const unsigned  n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+    unsigned        ui;
 
+    for(ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        FIR_unmirror(&asrc_ctrl[ui].sFIRF0Ctrl);
+        FIR_unmirror(&asrc_ctrl[ui].sFIRF1Ctrl);
+        FIR_unmirror(&asrc_ctrl[ui].sFIRF2Ctrl);
+        ADFIR_unmirror(&asrc_ctrl[ui].sADFIRF3Ctrl);
+    }
+}
 
+// Most output samples per channel of one block: at the lowest Fs ratio allowed, and one more for the F3 phase
+static unsigned asrc_pull_max_out(asrc_ctrl_t asrc_ctrl[])
+{
+    return (unsigned)(((uint64_t)asrc_ctrl[0].uiNInSamples << ASRC_FS_RATIO_UNIT_BIT) / asrc_ctrl[0].sFsRatioConfig.uiMinFsRatio) + 2;
+}
 
-        // Set input and output data pointers
-        asrc_ctrl[ui].piIn          = in_buff + ui;
-        asrc_ctrl[ui].piOut         = out_buff + ui;
+unsigned asrc_pull_buffer_length(asrc_ctrl_t asrc_ctrl[])
+{
+    return asrc_pull_max_out(asrc_ctrl) * asrc_ctrl[0].uiNchannels;
+}
+
+void asrc_init_pull(asrc_ctrl_t asrc_ctrl[], int buffer[])
+{
+    asrc_ctrl[0].piPullBuffer               = buffer;
+    asrc_ctrl[0].uiPullNext                 = 0;
+    asrc_ctrl[0].uiPullLeft                 = 0;
+}
+
+// Input samples per channel the passthrough fast path keeps from earlier blocks: enough to fill the
+// F1 and F3 delay lines again, in whole blocks
+static unsigned asrc_pass_history_length(asrc_ctrl_t asrc_ctrl[])
+{
+    const unsigned n_in_samples = asrc_ctrl[0].uiNInSamples;
+
+    return (FILTER_DEFS_FIR_MAX_TAPS_LONG / 2 + FILTER_DEFS_ADFIR_PHASE_N_TAPS / 2 + n_in_samples - 1) / n_in_samples * n_in_samples;
+}
+
+unsigned asrc_passthrough_buffer_length(asrc_ctrl_t asrc_ctrl[])
+{
+    return (asrc_pass_history_length(asrc_ctrl) + asrc_ctrl[0].uiNInSamples + asrc_pull_max_out(asrc_ctrl)) * asrc_ctrl[0].uiNchannels;
+}
+
+void asrc_init_passthrough(asrc_ctrl_t asrc_ctrl[], unsigned window, int buffer[])
+{
+    ASRCFsRatioConfigs_t*   psConfig    = &asrc_ctrl[0].sFsRatioConfig;
+
+    if (buffer)
+    {
+        if (window < 1) asrc_error(100);
+        // Equal rates only, where F1 over-samples by 2 and F2 is off, with the linear phase filters
+        // whose delay does not depend on the frequency
+        if ((psConfig->uiNominalFsRatio != ASRC_NOMINAL_FS_SCALE) || (psConfig->uiNominalFsRatio_lo != 0) ||
+            (asrc_ctrl[0].sFIRF1Ctrl.uiNOutSamples != 2 * asrc_ctrl[0].uiNInSamples) ||
+            (asrc_ctrl[0].sFIRF2Ctrl.eEnable == FIR_ON) || asrc_ctrl[0].uiMinPhase)
+            asrc_error(19);
+        memset(buffer, 0, asrc_passthrough_buffer_length(asrc_ctrl) * sizeof(int));
+    }
+    asrc_ctrl[0].piPassBuffer               = buffer;
+    asrc_ctrl[0].u64PassStep                = asrc_time_step(&asrc_ctrl[0], (((uint64_t)psConfig->uiNominalFsRatio) << 32) | psConfig->uiNominalFsRatio_lo);
+    asrc_ctrl[0].uiPassWindow               = window;
+    asrc_ctrl[0].uiPassBlocks               = 0;
+    asrc_ctrl[0].uiPassFade                 = 0;
+}
+
+int asrc_passthrough_active(asrc_ctrl_t asrc_ctrl[])
+{
+    return asrc_ctrl[0].piPassBuffer && (asrc_ctrl[0].uiPassFade == ASRC_PASS_FADE_LENGTH);
+}
+
+// Host F3 macc loop for one output instant with the interleaved delay lines, all channels of the instance share piADCoefs
+static void asrc_proc_F3_macc_interleaved_host(asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance, int* piADCoefs, int uiSplCntr)
+{
+    const unsigned  uiIOStep    = asrc_ctrl[0].uiIOStep;
+    int*            piDelay     = &asrc_ctrl[0].piF3DelayInterleaved[asrc_ctrl[0].uiF3DelayInterleavedI * n_channels_per_instance];
+    unsigned        uj;
+
+    if(uiIOStep == n_channels_per_instance)
+    {
+        // The outputs of the channels are consecutive in the output buffer
+        asrc_ctrl[0].pvADFIRInterleaved(piDelay, piADCoefs, asrc_ctrl[0].piOut + uiIOStep * uiSplCntr,
+                                        n_channels_per_instance, asrc_ctrl[0].sADFIRF3Ctrl.uiNLoops);
+    }
+    else
+    {
+        // Planar output buffers, so spread the outputs of the channels
+        int         iData[n_channels_per_instance];
+
+        asrc_ctrl[0].pvADFIRInterleaved(piDelay, piADCoefs, iData, n_channels_per_instance, asrc_ctrl[0].sADFIRF3Ctrl.uiNLoops);
+        for(uj = 0; uj < n_channels_per_instance; uj++)
+            asrc_ctrl[uj].piOut[uiIOStep * uiSplCntr]   = iData[uj];
+    }
+    for(uj = 0; uj < n_channels_per_instance; uj++)    {
+        asrc_ctrl[uj].sADFIRF3Ctrl.piOut      = &asrc_ctrl[uj].piOut[uiIOStep * uiSplCntr];
+        asrc_ctrl[uj].uiNASRCOutSamples++;
+    }
+}
+
+// Taps of channel uj for an output instant after synchronous sample ui has been pushed into F3.
+// Once 16 samples of this block have been pushed they are all on the stack, before that the
+// older taps come from the head saved at the start of the block
+static inline int* asrc_F3_taps_host(asrc_ctrl_t asrc_ctrl[], unsigned uj, unsigned ui)
+{
+    if(ui + 1 >= FILTER_DEFS_ADFIR_PHASE_N_TAPS)
+        return &asrc_ctrl[uj].piStack[ui + 1 - FILTER_DEFS_ADFIR_PHASE_N_TAPS];
+    return &asrc_ctrl[uj].iF3Head[ui + 1];
+}
+
+// Host F3 macc loops for planned output instants, instant uk after synchronous sample puiSpl[uk]
+// with coefficients ppiADCoefs[uk]. Outputs go from output sample uiSplCntr on
+static void asrc_proc_F3_macc_block_host(asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance, int* ppiADCoefs[],
+                                         unsigned* puiSpl, unsigned uiNInstants, unsigned uiSplCntr)
+{
+    const unsigned  uiNLoops    = asrc_ctrl[0].sADFIRF3Ctrl.uiNLoops;
+    const unsigned  uiIOStep    = asrc_ctrl[0].uiIOStep;
+    unsigned        uj, uk;
+
+    if(asrc_ctrl[0].pvADFIRMulti)
+    {
+        int*            ppiData[SRC_MRHF_ADFIR_MULTI_MAX_CH];
+        int             iData[SRC_MRHF_ADFIR_MULTI_MAX_CH];
+        unsigned        uiNCh;
+
+        // Groups of up to SRC_MRHF_ADFIR_MULTI_MAX_CH channels, one adaptive coefficient load per group
+        for(uk = 0; uk < uiNInstants; uk++)
+            for(uj = 0; uj < n_channels_per_instance; uj += uiNCh)    {
+                uiNCh = n_channels_per_instance - uj;
+                if(uiNCh > SRC_MRHF_ADFIR_MULTI_MAX_CH)
+                    uiNCh = SRC_MRHF_ADFIR_MULTI_MAX_CH;
+                for(unsigned ul = 0; ul < uiNCh; ul++)
+                    ppiData[ul]     = asrc_F3_taps_host(asrc_ctrl, uj + ul, puiSpl[uk]);
+
+                asrc_ctrl[0].pvADFIRMulti(ppiData, ppiADCoefs[uk], iData, uiNCh, uiNLoops);
+
+                for(unsigned ul = 0; ul < uiNCh; ul++)
+                    asrc_ctrl[uj + ul].piOut[uiIOStep * (uiSplCntr + uk)] = iData[ul];
+            }
+    }
+    else
+    {
+        // One channel at a time over all instants
+        for(uj = 0; uj < n_channels_per_instance; uj++)
+            for(uk = 0; uk < uiNInstants; uk++)    {
+                int*            piData  = asrc_F3_taps_host(asrc_ctrl, uj, puiSpl[uk]);
+
+                asrc_ctrl[uj].sADFIRF3Ctrl.pvInnerLoop[SRC_ISA_PARITY(piData)](piData, ppiADCoefs[uk],
+                                                                                &asrc_ctrl[uj].piOut[uiIOStep * (uiSplCntr + uk)], uiNLoops);
+            }
+    }
+
+    for(uj = 0; uj < n_channels_per_instance; uj++)    {
+        asrc_ctrl[uj].sADFIRF3Ctrl.piOut      = &asrc_ctrl[uj].piOut[uiIOStep * (uiSplCntr + uiNInstants - 1)];
+        asrc_ctrl[uj].uiNASRCOutSamples      += uiNInstants;
+    }
+}
+
+// Builds the adaptive coefficients of the planned output instants
+static void asrc_proc_F3_coefs_host(asrc_ctrl_t asrc_ctrl[], int* ppiPhase0[], int iH[][3], int* piADCoefs, unsigned uiNInstants)
+{
+    for(unsigned uk = 0; uk < uiNInstants; uk++)
+        asrc_ctrl[0].pvSplineCoeffGen(ppiPhase0[uk], iH[uk], &piADCoefs[uk * FILTER_DEFS_ADFIR_PHASE_N_TAPS], FILTER_DEFS_ADFIR_PHASE_N_TAPS);
+}
+
+// Saves the head of the taps of channels uiFirst to uiEnd - 1, then pushes the block through their
+// F3 delay lines. Channel 0 steps its time in asrc_proc_F3_plan_host()
+static void asrc_proc_F3_push_host(asrc_ctrl_t asrc_ctrl[], unsigned uiFirst, unsigned uiEnd)
+{
+    const unsigned  uiNSync     = asrc_ctrl[0].uiNSyncSamples;
+    unsigned        ui, uj;
+
+    for(uj = uiFirst; uj < uiEnd; uj++)
+    {
+        ADFIRCtrl_t*    psADFIRCtrl = &asrc_ctrl[uj].sADFIRF3Ctrl;
+
+        for(ui = 0; ui < FILTER_DEFS_ADFIR_PHASE_N_TAPS; ui++)
+            asrc_ctrl[uj].iF3Head[ui]   = psADFIRCtrl->piDelayI[ui];
+        for(ui = 0; ui < FILTER_DEFS_ADFIR_PHASE_N_TAPS && ui < uiNSync; ui++)
+            asrc_ctrl[uj].iF3Head[FILTER_DEFS_ADFIR_PHASE_N_TAPS + ui] = asrc_ctrl[uj].piStack[ui];
+
+        for(ui = 0; ui < uiNSync; ui++)
+        {
+            psADFIRCtrl->iIn    = asrc_ctrl[uj].piStack[ui];
+            ADFIR_proc_in_spl(psADFIRCtrl);
+        }
+        if(uj != 0)
+            asrc_ctrl[uj].iTimeInt     -= ASRC_ADFIR_N_PHASES(&asrc_ctrl[uj]) * uiNSync;
+    }
+}
+
+// Runs planned output instants of the host F3 stage, instant uk after synchronous sample puiSpl[uk]
+// with coefficients ppiADCoefs[uk], as output sample uiSplCntr + uk
+typedef void (*asrc_F3_run_t)(asrc_ctrl_t asrc_ctrl[], void* pvRun, int* ppiADCoefs[], unsigned* puiSpl,
+                              unsigned uiNInstants, unsigned uiSplCntr);
+
+// Runs the macc loops of all channels of the instance
+static void asrc_F3_run_macc_host(asrc_ctrl_t asrc_ctrl[], void* pvRun, int* ppiADCoefs[], unsigned* puiSpl,
+                                  unsigned uiNInstants, unsigned uiSplCntr)
+{
+    (void)pvRun;
+    asrc_proc_F3_macc_block_host(asrc_ctrl, asrc_ctrl[0].uiNchannels, ppiADCoefs, puiSpl, uiNInstants, uiSplCntr);
+}
+
+// Plans the host F3 stage for the whole block, after the push. The output instants (synchronous
+// sample, phase and alpha) are worked out from the time of channel 0 as in the per sample loop, and
+// the adaptive coefficients of up to ASRC_F3_PLAN_MAX_INSTANTS of them are built, then handed to
+// pfRun. The taps are read from the stack, which holds the whole block of F3 input, so the F3 delay
+// lines only take the last samples for the next block. Returns the number of output samples
+static unsigned asrc_proc_F3_plan_host(asrc_ctrl_t asrc_ctrl[], int64_t i64StepInc, asrc_F3_run_t pfRun, void* pvRun)
+{
+    const unsigned  uiNSync     = asrc_ctrl[0].uiNSyncSamples;
+    int*            ppiPhase0[ASRC_F3_PLAN_MAX_INSTANTS];
+    int             iH[ASRC_F3_PLAN_MAX_INSTANTS][3];
+    unsigned        uiSpl[ASRC_F3_PLAN_MAX_INSTANTS];
+    int*            ppiADCoefs[ASRC_F3_PLAN_MAX_INSTANTS];
+    int             iADCoefsBlk[ASRC_F3_PLAN_MAX_INSTANTS * FILTER_DEFS_ADFIR_PHASE_N_TAPS] __attribute__((aligned(64)));
+    unsigned        uiNInstants = 0;
+    unsigned        uiSplCntr   = 0;
+    unsigned        ui;
+
+    for(ui = 0; ui < uiNSync; ui++)
+    {
+        if(i64StepInc && ui)
+            asrc_ramp_time_step(&asrc_ctrl[0], i64StepInc);
+
+        // Decrease next output time for the new synchronous sample
+        asrc_ctrl[0].iTimeInt  -= ASRC_ADFIR_N_PHASES(&asrc_ctrl[0]);
+
+        while(asrc_ctrl[0].iTimeInt < ASRC_ADFIR_N_PHASES(&asrc_ctrl[0]))
+        {
+            unsigned int    uiTemp;
+            int             iAlpha;
+            long long       i64Acc0;
+
+            // The fractional part of time gives alpha
+            iAlpha      = asrc_ctrl[0].uiTimeFract>>1;      // Now alpha can be seen as a signed number
+
+            // Compute adative coefficients spline factors
+            i64Acc0 = (long long)iAlpha * (long long)iAlpha;
+
+            iH[uiNInstants][0]  = (int)(i64Acc0>>32);
+            iH[uiNInstants][2]  = 0x40000000;                                   // Load H2 with 0.5;
+            iH[uiNInstants][1]  = iH[uiNInstants][2] - iH[uiNInstants][0];      // H1 = 0.5 - 0.5 * alpha * alpha;
+            iH[uiNInstants][1]  = iH[uiNInstants][1] - iH[uiNInstants][0];      // H1 = 0.5 - alpha * alpha
+            iH[uiNInstants][1]  = iH[uiNInstants][1] + iAlpha;                  // H1 = 0.5 + alpha - alpha * alpha;
+            iH[uiNInstants][2]  = iH[uiNInstants][2] - iAlpha;                  // H2 = 0.5 - alpha
+            iH[uiNInstants][2]  = iH[uiNInstants][2] + iH[uiNInstants][0];      // H2 = 0.5 - alpha + 0.5 * alpha * alpha
+
+            // The integer part of time gives the phase
+            ppiPhase0[uiNInstants]  = ASRC_ADFIR_PHASE(&asrc_ctrl[0], asrc_ctrl[0].iTimeInt);
+            ppiADCoefs[uiNInstants] = &iADCoefsBlk[uiNInstants * FILTER_DEFS_ADFIR_PHASE_N_TAPS];
+            // The synchronous sample gives the taps
+            uiSpl[uiNInstants]      = ui;
+            uiNInstants++;
+
+            // Step time for next output sample
+            asrc_ctrl[0].iTimeInt       += asrc_ctrl[0].iTimeStepInt;
+            uiTemp      = asrc_ctrl[0].uiTimeFract;
+            asrc_ctrl[0].uiTimeFract        += asrc_ctrl[0].uiTimeStepFract;
+            if(asrc_ctrl[0].uiTimeFract < uiTemp)
+                asrc_ctrl[0].iTimeInt++;
+
+            // Run the plan so far when it is full
+            if(uiNInstants == ASRC_F3_PLAN_MAX_INSTANTS)
+            {
+                asrc_proc_F3_coefs_host(asrc_ctrl, ppiPhase0, iH, iADCoefsBlk, uiNInstants);
+                pfRun(asrc_ctrl, pvRun, ppiADCoefs, uiSpl, uiNInstants, uiSplCntr);
+                uiSplCntr      += uiNInstants;
+                uiNInstants     = 0;
+            }
+        }
+    }
+
+    if(uiNInstants)
+    {
+        asrc_proc_F3_coefs_host(asrc_ctrl, ppiPhase0, iH, iADCoefsBlk, uiNInstants);
+        pfRun(asrc_ctrl, pvRun, ppiADCoefs, uiSpl, uiNInstants, uiSplCntr);
+        uiSplCntr      += uiNInstants;
+    }
+
+    return uiSplCntr;
+}
+
+// Host F3 stage planned for the whole block, see asrc_proc_F3_plan_host(). Returns the number of
+// output samples
+static unsigned asrc_proc_F3_block_host(asrc_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance, int64_t i64StepInc)
+{
+    asrc_proc_F3_push_host(asrc_ctrl, 0, n_channels_per_instance);
+    return asrc_proc_F3_plan_host(asrc_ctrl, i64StepInc, asrc_F3_run_macc_host, 0);
+}
+#endif
+
+// Runs the synchronous part (F1 + F2) of channels uiFirst to uiEnd - 1 at fs_ratio
+static void asrc_proc_F1_F2_channels(asrc_ctrl_t asrc_ctrl[], unsigned uiFirst, unsigned uiEnd, uint64_t fs_ratio){
+    uint32_t fs_ratio_hi = (uint32_t)(fs_ratio >> 32);
+    uint32_t fs_ratio_lo = (uint32_t)(fs_ratio);
+
+    for(unsigned ui = uiFirst; ui < uiEnd; ui++)
+    {
+    // Update Fs Ratio
+        asrc_ctrl[ui].uiFsRatio     = fs_ratio_hi;
+        asrc_ctrl[ui].uiFsRatio_lo = fs_ratio_lo;
+
+        // Time step, from the ratio at the start of the block
+        asrc_set_time_step(&asrc_ctrl[ui], asrc_time_step(&asrc_ctrl[ui], fs_ratio));
 
 
     // Process synchronous part (F1 + F2)
@@ -132,13 +683,81 @@ unsigned asrc_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_ctrl_
 
         asrc_ctrl[ui].uiNASRCOutSamples = 0;
     }
+}
+
+// Runs the dither part of channels uiFirst to uiEnd - 1
+static void asrc_proc_dither_channels(asrc_ctrl_t asrc_ctrl[], unsigned uiFirst, unsigned uiEnd){
+
+#if (ASRC_DITHER_SETTING != ASRC_DITHER_OFF)    //Removed for speed optimisation
+    // Process dither part
+    // ===================
+    // We are back to block based processing. This is where the number of ASRC output samples is required again
+    // (would not be used if sample by sample based (on output samples))
+    for(unsigned ui = uiFirst; ui < uiEnd; ui++)
+    {
+        // Note: this is block based similar to SSRC
+        if(ASRC_proc_dither(&asrc_ctrl[ui]) != ASRC_NO_ERROR)
+        {
+            asrc_error(4);
+        }
+    }
+#endif
+}
+
+// Processes a block of the channels of an instance, whose input and output pointers have been set.
+// The F3 time step is ramped from that of fs_ratio to that of fs_ratio_end, by synchronous sample
+static unsigned asrc_process_filter_channels(uint64_t fs_ratio, uint64_t fs_ratio_end, asrc_ctrl_t asrc_ctrl[]){
+
+    int ui, uj; //General counters
+    int             uiSplCntr;  //Spline counter
+    int64_t         i64StepInc = 0;
+
+    // Get the number of channels per instance from first channel
+    const unsigned n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+
+    asrc_proc_F1_F2_channels(asrc_ctrl, 0, n_channels_per_instance, fs_ratio);
 
     uiSplCntr = 0; // This is actually only used because of the bizarre mix of block and sample based processing
 
+    // Ramp of the time step, only channel 0 steps the F3 time. The step is that of fs_ratio_end after the block
+    if(fs_ratio_end != fs_ratio)
+    {
+        uint64_t    u64Step     = (((uint64_t)(uint32_t)asrc_ctrl[0].iTimeStepInt) << 32) | asrc_ctrl[0].uiTimeStepFract;
+
+        i64StepInc  = (int64_t)(asrc_time_step(&asrc_ctrl[0], fs_ratio_end) - u64Step) / (int64_t)asrc_ctrl[0].uiNSyncSamples;
+    }
+
+#ifndef __xcore__
+    // On the host the F3 stage is planned for the whole block, except with interleaved delay lines
+    if(!asrc_ctrl[0].piF3DelayInterleaved)
+        uiSplCntr = asrc_proc_F3_block_host(asrc_ctrl, n_channels_per_instance, i64StepInc);
+    else
+#endif
     // Driven by samples produced during the synchronous phase
     for(ui = 0; ui < asrc_ctrl[0].uiNSyncSamples; ui++)
     {
+        if(i64StepInc && ui)
+            asrc_ramp_time_step(&asrc_ctrl[0], i64StepInc);
+
         // Push new samples into F3 delay line (input from stack) for each new "synchronous" sample (i.e. output of F1, respectively F2)
+#ifndef __xcore__
+        if(asrc_ctrl[0].piF3DelayInterleaved)
+        {
+            // Double write of all channels to simulate circular buffer, then step delay
+            unsigned    uiDelayO    = asrc_ctrl[0].sADFIRF3Ctrl.uiDelayO * n_channels_per_instance;
+            int*        piDelayI    = &asrc_ctrl[0].piF3DelayInterleaved[asrc_ctrl[0].uiF3DelayInterleavedI * n_channels_per_instance];
+
+            for(uj = 0; uj < n_channels_per_instance; uj++)
+            {
+                piDelayI[uj]                = asrc_ctrl[uj].piStack[ui];
+                piDelayI[uj + uiDelayO]     = asrc_ctrl[uj].piStack[ui];
+                asrc_ctrl[uj].iTimeInt     -= ASRC_ADFIR_N_PHASES(&asrc_ctrl[uj]);
+            }
+            if(++asrc_ctrl[0].uiF3DelayInterleavedI >= asrc_ctrl[0].sADFIRF3Ctrl.uiDelayO)
+                asrc_ctrl[0].uiF3DelayInterleavedI  = 0;
+        }
+        else
+#endif
         for(uj = 0; uj < n_channels_per_instance; uj++)
         {
 
@@ -146,8 +765,9 @@ unsigned asrc_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_ctrl_
             asrc_ctrl[uj].sADFIRF3Ctrl.iIn        = asrc_ctrl[uj].piStack[ui];
 
             //The following is replicated/inlined code from ADFIR_proc_in_spl in FIR.c
-            // Double write to simulate circular buffer
-            *asrc_ctrl[uj].sADFIRF3Ctrl.piDelayI                                  = asrc_ctrl[uj].sADFIRF3Ctrl.iIn;
+            // Double write to simulate circular buffer (only the second one if the delay line is mirrored)
+            if(!FIR_DELAY_MIRRORED(&asrc_ctrl[uj].sADFIRF3Ctrl))
+                *asrc_ctrl[uj].sADFIRF3Ctrl.piDelayI                              = asrc_ctrl[uj].sADFIRF3Ctrl.iIn;
             *(asrc_ctrl[uj].sADFIRF3Ctrl.piDelayI + asrc_ctrl[uj].sADFIRF3Ctrl.uiDelayO)        = asrc_ctrl[uj].sADFIRF3Ctrl.iIn;
             // Step delay (with circular simulation)
             asrc_ctrl[uj].sADFIRF3Ctrl.piDelayI++;
@@ -155,15 +775,54 @@ unsigned asrc_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_ctrl_
                 asrc_ctrl[uj].sADFIRF3Ctrl.piDelayI               =asrc_ctrl[uj].sADFIRF3Ctrl.piDelayB;
 
             // Decrease next output time (this is an integer value, so no influence on fractional part)
-            asrc_ctrl[uj].iTimeInt    -= FILTER_DEFS_ADFIR_N_PHASES;
+            asrc_ctrl[uj].iTimeInt    -= ASRC_ADFIR_N_PHASES(&asrc_ctrl[uj]);
 
 
         }
         // Run macc loop for F3
+#ifndef __xcore__
+        // On the host, build the adaptive coefficients of each output instant with the kernel selected
+        // at init, then run the macc loop for it
+        while(asrc_ctrl[0].iTimeInt < ASRC_ADFIR_N_PHASES(&asrc_ctrl[0]))
+        {
+            unsigned int    uiTemp;
+            int             iAlpha;
+            int             iH[3]; //iH0, iH1, iH2;
+            long long       i64Acc0;
+            int             iADCoefs[FILTER_DEFS_ADFIR_PHASE_N_TAPS] __attribute__((aligned(64)));
+
+            // Compute adative coefficients spline factors
+            // The fractional part of time gives alpha
+            iAlpha      = asrc_ctrl[0].uiTimeFract>>1;      // Now alpha can be seen as a signed number
+            i64Acc0 = (long long)iAlpha * (long long)iAlpha;
+
+            iH[0]       = (int)(i64Acc0>>32);
+            iH[2]       = 0x40000000;                       // Load H2 with 0.5;
+            iH[1]       = iH[2] - iH[0];                    // H1 = 0.5 - 0.5 * alpha * alpha;
+            iH[1]       = iH[1] - iH[0];                    // H1 = 0.5 - alpha * alpha
+            iH[1]       = iH[1] + iAlpha;                   // H1 = 0.5 + alpha - alpha * alpha;
+            iH[2]       = iH[2] - iAlpha;                   // H2 = 0.5 - alpha
+            iH[2]       = iH[2] + iH[0];                    // H2 = 0.5 - alpha + 0.5 * alpha * alpha
+
+            // Apply spline coefficients to filter coefficients, the integer part of time gives the phase
+            asrc_ctrl[0].pvSplineCoeffGen(ASRC_ADFIR_PHASE(&asrc_ctrl[0], asrc_ctrl[0].iTimeInt), iH, iADCoefs, FILTER_DEFS_ADFIR_PHASE_N_TAPS);
+
+            // Step time for next output sample
+            asrc_ctrl[0].iTimeInt       += asrc_ctrl[0].iTimeStepInt;
+            uiTemp      = asrc_ctrl[0].uiTimeFract;
+            asrc_ctrl[0].uiTimeFract        += asrc_ctrl[0].uiTimeStepFract;
+            if(asrc_ctrl[0].uiTimeFract < uiTemp)
+                asrc_ctrl[0].iTimeInt++;
+
+            // Apply filter F3 with just computed adaptive coefficients
+            asrc_proc_F3_macc_interleaved_host(asrc_ctrl, n_channels_per_instance, iADCoefs, uiSplCntr);
+            uiSplCntr++;
+        }
+#else
         // Check if a new output sample needs to be produced
         // Note that this will also update the adaptive filter coefficients
         // These must be computed for one channel only and reused in the macc loop of other channels
-        while(asrc_ctrl[0].iTimeInt < FILTER_DEFS_ADFIR_N_PHASES)
+        while(asrc_ctrl[0].iTimeInt < ASRC_ADFIR_N_PHASES(&asrc_ctrl[0]))
         {
             unsigned int    uiTemp;
             int             iAlpha;
@@ -188,7 +847,7 @@ unsigned asrc_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_ctrl_
             iH[0]           = iH[0] + iH[2];                        // H2 = 0.5 - alpha + 0.5 * alpha * alpha
 
             // The integer part of time gives the phase
-            piPhase0        = &iADFirCoefs[0][asrc_ctrl[0].iTimeInt];
+            piPhase0        = (int*)&iADFirCoefs[0][asrc_ctrl[0].iTimeInt];
             // These are calculated by the asm funcion  piPhase1        = piPhase0 + FILTER_DEFS_ADFIR_PHASE_N_TAPS;
             //                                          piPhase2        = piPhase1 + FILTER_DEFS_ADFIR_PHASE_N_TAPS;
             piADCoefs       = asrc_ctrl[0].piADCoefs;       // Given limited number of registers, this could be DP
@@ -204,7 +863,7 @@ unsigned asrc_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_ctrl_
             iH[2]           = iH[2] + iH[0];                        // H2 = 0.5 - alpha + 0.5 * alpha * alpha
 
             // The integer part of time gives the phase
-            piPhase0        = iADFirCoefs[asrc_ctrl[0].iTimeInt];
+            piPhase0        = ASRC_ADFIR_PHASE(&asrc_ctrl[0], asrc_ctrl[0].iTimeInt);
             // These are calculated by the asm funcion  piPhase1        = piPhase0 + FILTER_DEFS_ADFIR_PHASE_N_TAPS;
             //                                          piPhase2        = piPhase1 + FILTER_DEFS_ADFIR_PHASE_N_TAPS;
             piADCoefs       = asrc_ctrl[0].piADCoefs;       // Given limited number of registers, this could be DP
@@ -247,7 +906,7 @@ unsigned asrc_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_ctrl_
 #if SRC_USE_VPU
                 src_mrhf_adfir_inner_loop_asm_xs3(piData, piCoefs, &iData, asrc_ctrl[uj].sADFIRF3Ctrl.uiNLoops);
 #else
-                if ((unsigned)piData & 0b0100) src_mrhf_adfir_inner_loop_asm_odd(piData, piCoefs, &iData, asrc_ctrl[uj].sADFIRF3Ctrl.uiNLoops);
+                if ((uintptr_t)piData & 0b0100) src_mrhf_adfir_inner_loop_asm_odd(piData, piCoefs, &iData, asrc_ctrl[uj].sADFIRF3Ctrl.uiNLoops);
                 else                               src_mrhf_adfir_inner_loop_asm(piData, piCoefs, &iData, asrc_ctrl[uj].sADFIRF3Ctrl.uiNLoops);
 #endif
 
@@ -257,24 +916,553 @@ unsigned asrc_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_ctrl_
             }
             uiSplCntr++; // This is actually only used because of the bizarre mix of block and sample based processing
         }
+#endif
     }
 
 
-#if (ASRC_DITHER_SETTING != ASRC_DITHER_OFF)    //Removed for speed optimisation
-    // Process dither part
-    // ===================
-    // We are back to block based processing. This is where the number of ASRC output samples is required again
-    // (would not be used if sample by sample based (on output samples))
-    for(ui = 0; ui < n_channels_per_instance; ui++)
+    if(fs_ratio_end != fs_ratio)
+        for(ui = 0; ui < n_channels_per_instance; ui++)
+        {
+            asrc_ctrl[ui].uiFsRatio         = (uint32_t)(fs_ratio_end >> 32);
+            asrc_ctrl[ui].uiFsRatio_lo      = (uint32_t)fs_ratio_end;
+            asrc_set_time_step(&asrc_ctrl[ui], asrc_time_step(&asrc_ctrl[ui], fs_ratio_end));
+        }
+
+    asrc_proc_dither_channels(asrc_ctrl, 0, n_channels_per_instance);
+
+    unsigned n_samps_out = asrc_ctrl[0].uiNASRCOutSamples;
+    return n_samps_out;
+}
+
+#ifndef __xcore__
+// Delay of the passthrough copy in input samples: that of the filters rounded to the nearest sample.
+// At equal rates F1 delays by (N - 1) / 2 samples at twice the input rate, and F3 by
+// (FILTER_DEFS_ADFIR_PHASE_N_TAPS + 3) / 2 - (t + 1) / P of them, t being the F3 time of the next
+// output and P the number of F3 phases
+static unsigned asrc_pass_delay(asrc_ctrl_t* pasrc_ctrl)
+{
+    const int64_t   i64Phases   = ASRC_ADFIR_N_PHASES(pasrc_ctrl);
+    const int64_t   i64Time     = ((int64_t)pasrc_ctrl->iTimeInt << 32) + pasrc_ctrl->uiTimeFract;
+    // In 1 / (4P) input samples, with 32 fractional bits
+    const int64_t   i64Delay    = ((((int64_t)pasrc_ctrl->sFIRF1Ctrl.uiNCoefs + FILTER_DEFS_ADFIR_PHASE_N_TAPS + 2) * i64Phases - 2) << 32) - 2 * i64Time;
+
+    return (unsigned)((i64Delay + (2 * i64Phases << 32)) / (4 * i64Phases << 32));
+}
+
+// Runs the filters on the input history of the passthrough fast path, to fill their delay lines
+// again after the copy. The time step is still that of the nominal Fs ratio, so the F3 time is back
+// where it was after the history. The output is dropped and the dither random seeds are not stepped
+static void asrc_pass_refill(asrc_ctrl_t asrc_ctrl[], unsigned uiHistory)
+{
+    const unsigned  n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+    const unsigned  n_in_samples            = asrc_ctrl[0].uiNInSamples;
+    const uint64_t  u64FsRatio              = (((uint64_t)asrc_ctrl[0].uiFsRatio) << 32) | asrc_ctrl[0].uiFsRatio_lo;
+    int*            piIn[n_channels_per_instance];
+    int*            piOut[n_channels_per_instance];
+    unsigned        uiIOStep[n_channels_per_instance];
+    unsigned        uiDitherOnOff[n_channels_per_instance];
+    unsigned        ui, uj;
+
+    for(uj = 0; uj < n_channels_per_instance; uj++)
     {
-        // Note: this is block based similar to SSRC
-        if(ASRC_proc_dither(&asrc_ctrl[ui]) != ASRC_NO_ERROR)
+        piIn[uj]                            = asrc_ctrl[uj].piIn;
+        piOut[uj]                           = asrc_ctrl[uj].piOut;
+        uiIOStep[uj]                        = asrc_ctrl[uj].uiIOStep;
+        uiDitherOnOff[uj]                   = asrc_ctrl[uj].uiDitherOnOff;
+        ASRC_set_io_step(&asrc_ctrl[uj], n_channels_per_instance);
+        asrc_ctrl[uj].uiDitherOnOff         = ASRC_DITHER_OFF;
+    }
+    for(ui = 0; ui < uiHistory; ui += n_in_samples)
+    {
+        for(uj = 0; uj < n_channels_per_instance; uj++)
         {
-            asrc_error(4);
+            asrc_ctrl[uj].piIn              = asrc_ctrl[0].piPassBuffer + ui * n_channels_per_instance + uj;
+            asrc_ctrl[uj].piOut             = asrc_ctrl[0].piPassBuffer + (uiHistory + n_in_samples) * n_channels_per_instance + uj;
         }
+        asrc_process_filter_channels(u64FsRatio, u64FsRatio, asrc_ctrl);
     }
-#endif
+    for(uj = 0; uj < n_channels_per_instance; uj++)
+    {
+        ASRC_set_io_step(&asrc_ctrl[uj], uiIOStep[uj]);
+        asrc_ctrl[uj].piIn                  = piIn[uj];
+        asrc_ctrl[uj].piOut                 = piOut[uj];
+        asrc_ctrl[uj].uiDitherOnOff         = uiDitherOnOff[uj];
+    }
+}
 
-    unsigned n_samps_out = asrc_ctrl[0].uiNASRCOutSamples;
+// Processes a block with the passthrough fast path of asrc_init_passthrough(). While the F3 time step
+// is that of the nominal Fs ratio the F3 time does not drift, and after uiPassWindow such blocks the
+// output is crossfaded to a copy of the input, delayed as by the filters, which are then no longer
+// run. When the step changes they are run on the input history first and the output is crossfaded back
+static unsigned asrc_process_pass_channels(uint64_t fs_ratio, uint64_t fs_ratio_end, asrc_ctrl_t asrc_ctrl[]){
+
+    const unsigned  n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+    const unsigned  n_in_samples            = asrc_ctrl[0].uiNInSamples;
+    const unsigned  uiHistory               = asrc_pass_history_length(asrc_ctrl);
+    int*            piHistory               = asrc_ctrl[0].piPassBuffer;
+    const int       iLocked                 = (fs_ratio == fs_ratio_end) && (asrc_time_step(&asrc_ctrl[0], fs_ratio) == asrc_ctrl[0].u64PassStep);
+    const unsigned  uiDelay                 = asrc_pass_delay(&asrc_ctrl[0]);
+    unsigned        n_samps_out, ui, uj;
+
+    // The block goes after the history, interleaved
+    for(uj = 0; uj < n_channels_per_instance; uj++)
+        for(ui = 0; ui < n_in_samples; ui++)
+            piHistory[(uiHistory + ui) * n_channels_per_instance + uj] = asrc_ctrl[uj].piIn[ui * asrc_ctrl[uj].uiIOStep];
+
+    if(iLocked && (asrc_ctrl[0].uiPassFade == ASRC_PASS_FADE_LENGTH))
+    {
+        // Copy only
+        for(uj = 0; uj < n_channels_per_instance; uj++)
+        {
+            for(ui = 0; ui < n_in_samples; ui++)
+                asrc_ctrl[uj].piOut[ui * asrc_ctrl[uj].uiIOStep] = piHistory[(uiHistory + ui - uiDelay) * n_channels_per_instance + uj];
+            asrc_ctrl[uj].uiNASRCOutSamples = n_in_samples;
+        }
+        asrc_proc_dither_channels(asrc_ctrl, 0, n_channels_per_instance);
+        n_samps_out = n_in_samples;
+    }
+    else
+    {
+        const int       iTimeInt    = asrc_ctrl[0].iTimeInt;
+        const unsigned  uiTimeFract = asrc_ctrl[0].uiTimeFract;
+        unsigned        uiTarget;
+
+        if(asrc_ctrl[0].uiPassFade == ASRC_PASS_FADE_LENGTH)
+            asrc_pass_refill(asrc_ctrl, uiHistory);
+        n_samps_out = asrc_process_filter_channels(fs_ratio, fs_ratio_end, asrc_ctrl);
+
+        // Locked while the F3 time is the same after each block
+        if(iLocked && (n_samps_out == n_in_samples) && (asrc_ctrl[0].iTimeInt == iTimeInt) && (asrc_ctrl[0].uiTimeFract == uiTimeFract))
+        {
+            if(asrc_ctrl[0].uiPassBlocks < UINT32_MAX)
+                asrc_ctrl[0].uiPassBlocks++;
+        }
+        else
+            asrc_ctrl[0].uiPassBlocks = 0;
+        // The history must have been filled too
+        uiTarget = (asrc_ctrl[0].uiPassBlocks >= asrc_ctrl[0].uiPassWindow) &&
+                   (asrc_ctrl[0].uiPassBlocks * n_in_samples >= uiHistory) ? ASRC_PASS_FADE_LENGTH : 0;
+
+        // Crossfade, by output sample
+        if(asrc_ctrl[0].uiPassFade || uiTarget)
+            for(ui = 0; ui < n_samps_out; ui++)
+            {
+                if(asrc_ctrl[0].uiPassFade < uiTarget)
+                    asrc_ctrl[0].uiPassFade++;
+                else if(asrc_ctrl[0].uiPassFade > uiTarget)
+                    asrc_ctrl[0].uiPassFade--;
+                for(uj = 0; uj < n_channels_per_instance; uj++)
+                {
+                    int*        piOut   = &asrc_ctrl[uj].piOut[ui * asrc_ctrl[uj].uiIOStep];
+                    int64_t     i64Copy = piHistory[(uiHistory + ui - uiDelay) * n_channels_per_instance + uj];
+
+                    *piOut  = (int)(*piOut + (i64Copy - *piOut) * asrc_ctrl[0].uiPassFade / ASRC_PASS_FADE_LENGTH);
+                }
+            }
+    }
+
+    // History for the next block
+    memmove(piHistory, piHistory + n_in_samples * n_channels_per_instance, uiHistory * n_channels_per_instance * sizeof(int));
     return n_samps_out;
 }
+#endif
+
+// Processes a block of the channels of an instance, whose input and output pointers have been set
+static unsigned asrc_process_channels(uint64_t fs_ratio, uint64_t fs_ratio_end, asrc_ctrl_t asrc_ctrl[]){
+
+#ifndef __xcore__
+    if(asrc_ctrl[0].piPassBuffer)
+        return asrc_process_pass_channels(fs_ratio, fs_ratio_end, asrc_ctrl);
+#endif
+    return asrc_process_filter_channels(fs_ratio, fs_ratio_end, asrc_ctrl);
+}
+
+// Sets up the channels of an instance for interleaved buffers
+static void asrc_set_interleaved(int *in_buff, int *out_buff, asrc_ctrl_t asrc_ctrl[]){
+
+    // Get the number of channels per instance from first channel
+    const unsigned n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+
+    for(unsigned ui = 0; ui < n_channels_per_instance; ui++)
+    {
+#ifndef __xcore__
+        // Back to interleaved buffers after asrc_process_planar()
+        if(asrc_ctrl[ui].uiIOStep != n_channels_per_instance)
+            ASRC_set_io_step(&asrc_ctrl[ui], n_channels_per_instance);
+#endif
+        // Set input and output data pointers
+        asrc_ctrl[ui].piIn          = in_buff + ui;
+        asrc_ctrl[ui].piOut         = out_buff + ui;
+    }
+}
+
+unsigned asrc_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_ctrl_t asrc_ctrl[]){
+
+    asrc_set_interleaved(in_buff, out_buff, asrc_ctrl);
+    return asrc_process_channels(fs_ratio, fs_ratio, asrc_ctrl);
+}
+
+unsigned asrc_process_ramp(int *in_buff, int *out_buff, uint64_t fs_ratio_start, uint64_t fs_ratio_end, asrc_ctrl_t asrc_ctrl[]){
+
+    asrc_set_interleaved(in_buff, out_buff, asrc_ctrl);
+    return asrc_process_channels(fs_ratio_start, fs_ratio_end, asrc_ctrl);
+}
+
+#ifndef __xcore__
+unsigned asrc_process_planar(int *in_buff[], int *out_buff[], uint64_t fs_ratio, asrc_ctrl_t asrc_ctrl[]){
+
+    // Get the number of channels per instance from first channel
+    const unsigned n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+
+    for(unsigned ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        // Each channel has its own buffers, read and written with a step of one sample
+        if(asrc_ctrl[ui].uiIOStep != 1)
+            ASRC_set_io_step(&asrc_ctrl[ui], 1);
+        asrc_ctrl[ui].piIn          = in_buff[ui];
+        asrc_ctrl[ui].piOut         = out_buff[ui];
+    }
+
+    return asrc_process_channels(fs_ratio, fs_ratio, asrc_ctrl);
+}
+
+unsigned asrc_process_pull(int out_buff[], unsigned n_out, uint64_t fs_ratio, asrc_ctrl_t asrc_ctrl[],
+        asrc_pull_input_t input, void *context){
+
+    // Get the number of channels per instance from first channel
+    const unsigned n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+    const unsigned max_out  = asrc_pull_max_out(asrc_ctrl);
+    int*           buffer   = asrc_ctrl[0].piPullBuffer;
+    unsigned       n_in     = 0;
+    unsigned       n_done, n;
+
+    if (!buffer) asrc_error(14);
+
+    // Samples left over from the last call first
+    n_done = (asrc_ctrl[0].uiPullLeft < n_out) ? asrc_ctrl[0].uiPullLeft : n_out;
+    memcpy(out_buff, buffer + asrc_ctrl[0].uiPullNext * n_channels_per_instance, n_done * n_channels_per_instance * sizeof(int));
+    asrc_ctrl[0].uiPullNext    += n_done;
+    asrc_ctrl[0].uiPullLeft    -= n_done;
+
+    while(n_done < n_out)
+    {
+        int *in_buff = input(context);
+        n_in += asrc_ctrl[0].uiNInSamples;
+
+        if(n_out - n_done >= max_out)
+        {
+            // The whole block fits, straight to the output
+            n_done += asrc_process(in_buff, out_buff + n_done * n_channels_per_instance, fs_ratio, asrc_ctrl);
+        }
+        else
+        {
+            // Last block, what is not needed now is kept for the next call
+            unsigned n_block = asrc_process(in_buff, buffer, fs_ratio, asrc_ctrl);
+
+            n = (n_block < n_out - n_done) ? n_block : n_out - n_done;
+            memcpy(out_buff + n_done * n_channels_per_instance, buffer, n * n_channels_per_instance * sizeof(int));
+            n_done                     += n;
+            asrc_ctrl[0].uiPullNext     = n;
+            asrc_ctrl[0].uiPullLeft     = n_block - n;
+        }
+    }
+
+    return n_in;
+}
+
+// Waits until all the threads of the pool have reached the barrier. Spins for a while first, as
+// the threads of a block arrive close together, then sleeps
+static void asrc_mt_barrier(asrc_mt_t* psMt)
+{
+    unsigned    uiGen   = __atomic_load_n(&psMt->uiBarrierGen, __ATOMIC_ACQUIRE);
+
+    if(__atomic_add_fetch(&psMt->uiBarrierCount, 1, __ATOMIC_ACQ_REL) == psMt->uiNThreads)
+    {
+        // Last one in, the others wait for the generation to change
+        __atomic_store_n(&psMt->uiBarrierCount, 0, __ATOMIC_RELAXED);
+        pthread_mutex_lock(&psMt->sMutex);
+        __atomic_store_n(&psMt->uiBarrierGen, uiGen + 1, __ATOMIC_RELEASE);
+        pthread_cond_broadcast(&psMt->sCond);
+        pthread_mutex_unlock(&psMt->sMutex);
+        return;
+    }
+    for(unsigned ui = 0; ui < ASRC_MT_SPIN; ui++)
+        if(__atomic_load_n(&psMt->uiBarrierGen, __ATOMIC_ACQUIRE) != uiGen)
+            return;
+    pthread_mutex_lock(&psMt->sMutex);
+    while(__atomic_load_n(&psMt->uiBarrierGen, __ATOMIC_ACQUIRE) == uiGen)
+        pthread_cond_wait(&psMt->sCond, &psMt->sMutex);
+    pthread_mutex_unlock(&psMt->sMutex);
+}
+
+// Copies planned output instants of the F3 stage into the schedule of the block, as the
+// coefficients are only valid until the next ones are built
+static void asrc_mt_F3_schedule(asrc_ctrl_t asrc_ctrl[], void* pvRun, int* ppiADCoefs[], unsigned* puiSpl,
+                                unsigned uiNInstants, unsigned uiSplCntr)
+{
+    asrc_mt_t*  psMt    = (asrc_mt_t*)pvRun;
+
+    for(unsigned uk = 0; uk < uiNInstants; uk++)
+    {
+        memcpy(&psMt->piSchedCoefs[(uiSplCntr + uk) * FILTER_DEFS_ADFIR_PHASE_N_TAPS], ppiADCoefs[uk],
+               FILTER_DEFS_ADFIR_PHASE_N_TAPS * sizeof(int));
+        psMt->puiSchedSpl[uiSplCntr + uk]   = puiSpl[uk];
+    }
+}
+
+// Processes the shard of a thread for the block published in the pool. The F3 stage is planned once,
+// by the thread with channel 0 after its own synchronous part, while the others run theirs. All then
+// run the F3 macc loops of their channels from the schedule
+static void asrc_mt_shard(asrc_mt_shard_t* psShard)
+{
+    asrc_mt_t*      psMt        = psShard->psMt;
+    asrc_ctrl_t*    asrc_ctrl   = psMt->psCtrl;
+    const unsigned  n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+    const unsigned  uiFirst     = psShard->uiFirst;
+    const unsigned  uiEnd       = psShard->uiEnd;
+    int*            ppiADCoefs[ASRC_F3_PLAN_MAX_INSTANTS];
+    unsigned        uiSplCntr, uiN;
+
+    for(unsigned ui = uiFirst; ui < uiEnd; ui++)
+    {
+        if(asrc_ctrl[ui].uiIOStep != n_channels_per_instance)
+            ASRC_set_io_step(&asrc_ctrl[ui], n_channels_per_instance);
+        asrc_ctrl[ui].piIn          = psMt->piIn + ui;
+        asrc_ctrl[ui].piOut         = psMt->piOut + ui;
+    }
+    asrc_proc_F1_F2_channels(asrc_ctrl, uiFirst, uiEnd, psMt->u64FsRatio);
+    asrc_proc_F3_push_host(asrc_ctrl, uiFirst, uiEnd);
+    if(uiFirst == 0)
+        psMt->uiSchedNOut   = asrc_proc_F3_plan_host(asrc_ctrl, 0, asrc_mt_F3_schedule, psMt);
+    asrc_mt_barrier(psMt);
+
+    for(uiSplCntr = 0; uiSplCntr < psMt->uiSchedNOut; uiSplCntr += uiN)
+    {
+        uiN = psMt->uiSchedNOut - uiSplCntr;
+        if(uiN > ASRC_F3_PLAN_MAX_INSTANTS)
+            uiN = ASRC_F3_PLAN_MAX_INSTANTS;
+        for(unsigned uk = 0; uk < uiN; uk++)
+            ppiADCoefs[uk]  = &psMt->piSchedCoefs[(uiSplCntr + uk) * FILTER_DEFS_ADFIR_PHASE_N_TAPS];
+        asrc_proc_F3_macc_block_host(&asrc_ctrl[uiFirst], uiEnd - uiFirst, ppiADCoefs, &psMt->puiSchedSpl[uiSplCntr], uiN, uiSplCntr);
+    }
+    asrc_proc_dither_channels(asrc_ctrl, uiFirst, uiEnd);
+    asrc_mt_barrier(psMt);
+}
+
+// Worker thread of the pool, a shard per block until asrc_mt_exit()
+static void* asrc_mt_worker(void* pvShard)
+{
+    asrc_mt_shard_t*    psShard = (asrc_mt_shard_t*)pvShard;
+
+    for(;;)
+    {
+        asrc_mt_barrier(psShard->psMt);
+        if(psShard->psMt->iQuit)
+            return 0;
+        asrc_mt_shard(psShard);
+    }
+}
+
+unsigned asrc_mt_buffer_length(asrc_ctrl_t asrc_ctrl[])
+{
+    return asrc_pull_max_out(asrc_ctrl) * (FILTER_DEFS_ADFIR_PHASE_N_TAPS + 1);
+}
+
+void asrc_mt_init(asrc_mt_t* mt, asrc_ctrl_t asrc_ctrl[], unsigned n_threads, int buffer[])
+{
+    const unsigned n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+
+    if (n_threads < 1 || n_threads > ASRC_MT_MAX_THREADS) asrc_error(100);
+    if (asrc_ctrl[0].piF3DelayInterleaved || asrc_ctrl[0].piPassBuffer) asrc_error(16);
+    if (n_threads > n_channels_per_instance)
+        n_threads = n_channels_per_instance;
+
+    memset(mt, 0, sizeof(asrc_mt_t));
+    mt->psCtrl          = asrc_ctrl;
+    mt->uiNThreads      = n_threads;
+    mt->piSchedCoefs    = buffer;
+    mt->puiSchedSpl     = (unsigned*)&buffer[asrc_pull_max_out(asrc_ctrl) * FILTER_DEFS_ADFIR_PHASE_N_TAPS];
+    pthread_mutex_init(&mt->sMutex, 0);
+    pthread_cond_init(&mt->sCond, 0);
+
+    // Channels shared out as evenly as they go, the calling thread has channel 0
+    for(unsigned ui = 0; ui < n_threads; ui++)
+    {
+        mt->sShard[ui].psMt     = mt;
+        mt->sShard[ui].uiFirst  = ui * n_channels_per_instance / n_threads;
+        mt->sShard[ui].uiEnd    = (ui + 1) * n_channels_per_instance / n_threads;
+        if(ui && pthread_create(&mt->sThread[ui], 0, asrc_mt_worker, &mt->sShard[ui]) != 0)
+            asrc_error(17);
+    }
+}
+
+unsigned asrc_mt_process(int *in_buff, int *out_buff, uint64_t fs_ratio, asrc_mt_t* mt)
+{
+    // Published to the workers by the barrier
+    mt->piIn            = in_buff;
+    mt->piOut           = out_buff;
+    mt->u64FsRatio      = fs_ratio;
+    asrc_mt_barrier(mt);
+    asrc_mt_shard(&mt->sShard[0]);
+
+    return mt->psCtrl[0].uiNASRCOutSamples;
+}
+
+void asrc_mt_exit(asrc_mt_t* mt)
+{
+    mt->iQuit           = 1;
+    asrc_mt_barrier(mt);
+    for(unsigned ui = 1; ui < mt->uiNThreads; ui++)
+        pthread_join(mt->sThread[ui], 0);
+    pthread_cond_destroy(&mt->sCond);
+    pthread_mutex_destroy(&mt->sMutex);
+}
+#endif
+
+#ifndef __xcore__
+// Inits the float32 channels of an instance whose rates have been set (as codes, or planned)
+static uint64_t asrc_f32_init_channels(asrc_f32_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+        const unsigned n_in_samples)
+{
+    unsigned ui;
+
+    //Check to see if n_channels_per_instance, n_in_samples are reasonable
+    if ((n_in_samples & 0x1) || (n_in_samples < 4)) asrc_error(100);
+    if (n_channels_per_instance < 1) asrc_error(101);
+
+    for(ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        // Set number of channels per instance
+        asrc_ctrl[ui].uiNchannels               = n_channels_per_instance;
+
+        // Set number of samples
+        asrc_ctrl[ui].uiNInSamples              = n_in_samples;
+
+        // Init ASRC instances, this also syncs them
+        if (ASRC_f32_init(&asrc_ctrl[ui]) != ASRC_NO_ERROR) asrc_error(11);
+    }
+
+    return (uint64_t)((((uint64_t)asrc_ctrl[0].uiFsRatio) << 32) | asrc_ctrl[0].uiFsRatio_lo);
+}
+
+uint64_t asrc_f32_init(const fs_code_t sr_in, const fs_code_t sr_out, asrc_f32_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+        const unsigned n_in_samples)
+{
+    // Set input/output sampling rate codes
+    for(unsigned ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        asrc_ctrl[ui].eInFs                     = (int)sr_in;
+        asrc_ctrl[ui].eOutFs                    = (int)sr_out;
+    }
+
+    return asrc_f32_init_channels(asrc_ctrl, n_channels_per_instance, n_in_samples);
+}
+
+uint64_t asrc_f32_init_rates(const unsigned fs_in, const unsigned fs_out, asrc_f32_ctrl_t asrc_ctrl[], const unsigned n_channels_per_instance,
+        const unsigned n_in_samples)
+{
+    asrc_ctrl_t     sCtrl;
+    ASRCPlannedFilters_t sPlanned;
+    int             iPlannedCoefs[ASRC_PLAN_COEFS_LENGTH];
+
+    // Plan the filter chain for the rates once, then take it over into each channel
+    sPlanned.piCoefs            = iPlannedCoefs;
+    sCtrl.psPlanned             = &sPlanned;
+    if(ASRC_plan_rates(&sCtrl, fs_in, fs_out) != ASRC_NO_ERROR) asrc_error(13);
+    for(unsigned ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        asrc_ctrl[ui].eInFs                     = sCtrl.eInFs;
+        asrc_ctrl[ui].eOutFs                    = sCtrl.eOutFs;
+        asrc_ctrl[ui].sFiltersIDs               = sCtrl.sFiltersIDs;
+        asrc_ctrl[ui].sFsRatioConfig            = sCtrl.sFsRatioConfig;
+        ASRC_f32_set_planned(&asrc_ctrl[ui], sCtrl.psPlanned);
+    }
+
+    return asrc_f32_init_channels(asrc_ctrl, n_channels_per_instance, n_in_samples);
+}
+
+unsigned asrc_f32_process(float *in_buff, float *out_buff, uint64_t fs_ratio, asrc_f32_ctrl_t asrc_ctrl[]){
+
+    unsigned        ui, uj;
+    unsigned        uiSplCntr   = 0;
+    float           fADCoefs[FILTER_DEFS_ADFIR_PHASE_N_TAPS] __attribute__((aligned(32)));
+
+    // Get the number of channels per instance from first channel
+    const unsigned n_channels_per_instance = asrc_ctrl[0].uiNchannels;
+
+    for(ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        uint32_t fs_ratio_hi = (uint32_t)(fs_ratio >> 32);
+        uint32_t fs_ratio_lo = (uint32_t)(fs_ratio);
+
+        // Update Fs Ratio
+        asrc_ctrl[ui].uiFsRatio     = fs_ratio_hi;
+        asrc_ctrl[ui].uiFsRatio_lo  = fs_ratio_lo;
+
+#if DO_FS_BOUNDS_CHECK
+        // Check for bounds of new Fs ratio, as in asrc_process
+        if( (fs_ratio_hi < asrc_ctrl[ui].sFsRatioConfig.uiMinFsRatio) ||
+            (fs_ratio_hi > asrc_ctrl[ui].sFsRatioConfig.uiMaxFsRatio) )
+        {
+            fs_ratio_hi = asrc_ctrl[ui].sFsRatioConfig.uiNominalFsRatio;
+            fs_ratio_lo = asrc_ctrl[ui].sFsRatioConfig.uiNominalFsRatio_lo;
+        }
+#endif
+        // Apply shift to time ratio to build integer and fractional parts of time step
+        asrc_ctrl[ui].iTimeStepInt     = fs_ratio_hi >> (asrc_ctrl[ui].sFsRatioConfig.iFsRatioShift);
+        asrc_ctrl[ui].uiTimeStepFract  = fs_ratio_hi << (32 - asrc_ctrl[ui].sFsRatioConfig.iFsRatioShift);
+        asrc_ctrl[ui].uiTimeStepFract |= (uint32_t)(fs_ratio_lo >> asrc_ctrl[ui].sFsRatioConfig.iFsRatioShift);
+
+        // Set input and output data pointers
+        asrc_ctrl[ui].pfIn          = in_buff + ui;
+        asrc_ctrl[ui].pfOut         = out_buff + ui;
+
+        // Process synchronous part (F1 + F2), output on stack
+        if(ASRC_f32_proc_F1_F2(&asrc_ctrl[ui]) != ASRC_NO_ERROR) asrc_error(12);
+
+        asrc_ctrl[ui].uiNASRCOutSamples = 0;
+    }
+
+    // Run the asynchronous part (F3), driven by samples produced during the synchronous phase
+    for(ui = 0; ui < asrc_ctrl[0].uiNSyncSamples; ui++)
+    {
+        for(uj = 0; uj < n_channels_per_instance; uj++)
+        {
+            ADFIR_f32_proc_in_spl(&asrc_ctrl[uj].sADFIRF3Ctrl, asrc_ctrl[uj].pfStack[ui]);
+            asrc_ctrl[uj].iTimeInt     -= FILTER_DEFS_ADFIR_N_PHASES;
+        }
+
+        // The adaptive coefficients are computed for channel 0 and reused in the macc loop of other channels
+        while(asrc_ctrl[0].iTimeInt < FILTER_DEFS_ADFIR_N_PHASES)
+        {
+            unsigned int    uiTemp;
+            float           fAlpha;
+            float           fH[3];
+
+            // The fractional part of time gives alpha, the integer part the phase
+            fAlpha          = (float)asrc_ctrl[0].uiTimeFract * (1.0f / 4294967296.0f);
+            fH[0]           = 0.5f * fAlpha * fAlpha;                   // H0 = 0.5 * alpha * alpha
+            fH[1]           = 0.5f + fAlpha - 2.0f * fH[0];             // H1 = 0.5 + alpha - alpha * alpha
+            fH[2]           = 0.5f - fAlpha + fH[0];                    // H2 = 0.5 - alpha + 0.5 * alpha * alpha
+            asrc_ctrl[0].pvSplineCoeffGen(&asrc_ctrl[0].pfADFirCoefs[asrc_ctrl[0].iTimeInt * FILTER_DEFS_ADFIR_PHASE_N_TAPS], fH, fADCoefs);
+
+            // Step time for next output sample
+            asrc_ctrl[0].iTimeInt      += asrc_ctrl[0].iTimeStepInt;
+            uiTemp                      = asrc_ctrl[0].uiTimeFract;
+            asrc_ctrl[0].uiTimeFract   += asrc_ctrl[0].uiTimeStepFract;
+            if(asrc_ctrl[0].uiTimeFract < uiTemp)
+                asrc_ctrl[0].iTimeInt++;
+
+            // Apply filter F3 with just computed adaptive coefficients
+            for(uj = 0; uj < n_channels_per_instance; uj++)
+            {
+                asrc_ctrl[uj].pfOut[n_channels_per_instance * uiSplCntr] = ADFIR_f32_proc_macc(&asrc_ctrl[uj].sADFIRF3Ctrl, fADCoefs);
+                asrc_ctrl[uj].uiNASRCOutSamples++;
+            }
+            uiSplCntr++;
+        }
+    }
+
+    return uiSplCntr;
+}
+#endif
@@ -0,0 +1,98 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// ADFIR inner loop C implementation for non-xcore (host) targets.
+// Bit-exact with src_mrhf_adfir_inner_loop_asm.S: 32x32->64 MACCS accumulation
+// followed by LSATS/LEXTRACT at bit 30.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+#include <stdint.h>
+
+#include "src_mrhf_int_arithmetic.h"
+#include "src_mrhf_adfir_inner_loop_asm.h"
+
+// ==================================================================== //
+// Function:        src_mrhf_adfir_inner_loop_asm                       //
+// Arguments:       int *piData: Pointer to delay line                  //
+//                  int *piCoefs: Pointer to adaptive coefficients      //
+//                  int iData[]: Result (iData[0])                      //
+//                  int count: Number of 2-tap loops (multiple of 8)    //
+// Return values:   None                                                //
+// Description:     Computes one ADFIR output sample                    //
+// ==================================================================== //
+void src_mrhf_adfir_inner_loop_asm(int *piData, int *piCoefs, int iData[], int count)
+{
+    // Wrapping 64 bit accumulation, as MACCS does not saturate
+    uint64_t        u64Acc      = 0;
+    int             iNTaps      = (count >> 3) << 4;
+    long long       i64Acc;
+    int             i;
+
+    for(i = 0; i < iNTaps; i++)
+        u64Acc += (uint64_t)((long long)piData[i] * (long long)piCoefs[i]);
+
+    i64Acc = (long long)u64Acc;
+    if(i64Acc > MAX_VAL64_29)
+        i64Acc = MAX_VAL64_29;
+    if(i64Acc < MIN_VAL64_29)
+        i64Acc = MIN_VAL64_29;
+    iData[0]        = (int)(i64Acc >> 30);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_adfir_inner_loop_asm_odd                   //
+// Description:     As src_mrhf_adfir_inner_loop_asm. The even/odd      //
+//                  split only matters for xcore double-word loads      //
+// ==================================================================== //
+void src_mrhf_adfir_inner_loop_asm_odd(int *piData, int *piCoefs, int iData[], int count)
+{
+    src_mrhf_adfir_inner_loop_asm(piData, piCoefs, iData, count);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_adfir_inner_loop_interleaved               //
+// Arguments:       int *piData: Pointer to interleaved delay lines     //
+//                  int *piCoefs: Pointer to adaptive coefficients      //
+//                  int iData[]: Results, one per channel               //
+//                  unsigned uiNChannels: Number of channels            //
+//                  int count: Number of 2-tap loops (multiple of 8)    //
+// Return values:   None                                                //
+// Description:     Computes one ADFIR output sample per channel from   //
+//                  delay lines interleaved tap by tap                  //
+// ==================================================================== //
+void src_mrhf_adfir_inner_loop_interleaved(int *piData, int *piCoefs, int iData[], unsigned uiNChannels, int count)
+{
+    int             iNTaps      = (count >> 3) << 4;
+    uint64_t        u64Acc[8];
+    long long       i64Acc;
+    unsigned        uj, uk, uiNCh;
+    int             i;
+
+    // Groups of 8 channels, so a tap of the group is one contiguous run
+    for(uj = 0; uj < uiNChannels; uj += uiNCh)
+    {
+        uiNCh = (uiNChannels - uj < 8) ? uiNChannels - uj : 8;
+        for(uk = 0; uk < uiNCh; uk++)
+            u64Acc[uk] = 0;
+        for(i = 0; i < iNTaps; i++)
+            for(uk = 0; uk < uiNCh; uk++)
+                u64Acc[uk] += (uint64_t)((long long)piData[i * uiNChannels + uj + uk] * (long long)piCoefs[i]);
+        for(uk = 0; uk < uiNCh; uk++)
+        {
+            i64Acc = (long long)u64Acc[uk];
+            if(i64Acc > MAX_VAL64_29)
+                i64Acc = MAX_VAL64_29;
+            if(i64Acc < MIN_VAL64_29)
+                i64Acc = MIN_VAL64_29;
+            iData[uj + uk]  = (int)(i64Acc >> 30);
+        }
+    }
+}
+
+#endif // !__xcore__
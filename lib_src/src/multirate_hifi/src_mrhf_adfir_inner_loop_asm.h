@@ -7,4 +7,22 @@ void src_mrhf_adfir_inner_loop_asm(int *piData, int *piCoefs, int iData[], int c
 void src_mrhf_adfir_inner_loop_asm_odd(int *piData, int *piCoefs, int iData[], int count);
 void src_mrhf_adfir_inner_loop_asm_xs3(int *piData, int *piCoefs, int iData[], int count);
 
+#if !defined(__xcore__)
+// Host versions for the delay lines of all channels of an instance interleaved tap by tap,
+// piData[tap * uiNChannels + channel]. Computes one output per channel into iData[0 .. uiNChannels-1].
+typedef void (*SRCADFIRInterleaved_t)(int *piData, int *piCoefs, int iData[], unsigned uiNChannels, int count);
+void src_mrhf_adfir_inner_loop_interleaved(int *piData, int *piCoefs, int iData[], unsigned uiNChannels, int count);
+#if defined(__x86_64__) || defined(__i386__)
+void src_mrhf_adfir_inner_loop_interleaved_avx2(int *piData, int *piCoefs, int iData[], unsigned uiNChannels, int count);
+void src_mrhf_adfir_inner_loop_interleaved_avx512(int *piData, int *piCoefs, int iData[], unsigned uiNChannels, int count);
+#endif
+#endif
+
+#if !defined(__xcore__) && (defined(__x86_64__) || defined(__i386__))
+// x86 multi-channel version, only to be called when src_isa_detect() reports AVX-512.
+// Computes the outputs of up to SRC_MRHF_ADFIR_MULTI_MAX_CH delay lines sharing one set of coefficients.
+#define SRC_MRHF_ADFIR_MULTI_MAX_CH     8
+void src_mrhf_adfir_inner_loop_multi_avx512(int *ppiData[], int *piCoefs, int iData[], unsigned uiNChannels, int count);
+#endif
+
 #endif // _SRC_MRHF_ADFIR_INNER_LOOP_ASM_H_
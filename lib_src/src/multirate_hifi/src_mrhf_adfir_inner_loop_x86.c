@@ -0,0 +1,183 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Multi-channel ADFIR inner loops for x86 hosts.
+// All channels of an ASRC instance share the adaptive coefficients, so the
+// coefficients are loaded once and up to 8 channels are accumulated with one
+// 64 bit lane per channel. Bit-exact with src_mrhf_adfir_inner_loop.c.
+//
+// The interleaved versions read delay lines stored tap by tap, where one
+// load gives the same tap of consecutive channels and each coefficient is
+// broadcast against it, so no reduction across lanes is needed.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "src_mrhf_int_arithmetic.h"
+#include "src_mrhf_adfir_inner_loop_asm.h"
+
+// ==================================================================== //
+// Function:        src_mrhf_adfir_inner_loop_multi_avx512              //
+// Arguments:       int *ppiData[]: Pointers to the delay lines         //
+//                  int *piCoefs: Pointer to adaptive coefficients      //
+//                  int iData[]: Results, one per channel               //
+//                  unsigned uiNChannels: Number of channels            //
+//                                  (1 to SRC_MRHF_ADFIR_MULTI_MAX_CH)  //
+//                  int count: Number of 2-tap loops (multiple of 8)    //
+// Return values:   None                                                //
+// Description:     Computes one ADFIR output sample per channel        //
+// ==================================================================== //
+__attribute__((target("avx512f")))
+void src_mrhf_adfir_inner_loop_multi_avx512(int *ppiData[], int *piCoefs, int iData[], unsigned uiNChannels, int count)
+{
+    int             iNBlocks    = count >> 3;                   // 16 taps per block
+    __m512i         vAcc[SRC_MRHF_ADFIR_MULTI_MAX_CH];
+    __m512i         vCoefsEven, vCoefsOdd, vData, vA, vB, vC, vD;
+    int             iOut[SRC_MRHF_ADFIR_MULTI_MAX_CH];
+    unsigned        uj;
+    int             i;
+
+    for(uj = 0; uj < SRC_MRHF_ADFIR_MULTI_MAX_CH; uj++)
+        vAcc[uj] = _mm512_setzero_si512();
+
+    // Coefficients loaded once per block for all channels.
+    // PMULDQ multiplies the even 32 bit elements, the odd ones are shifted down for the second product.
+    for(i = 0; i < iNBlocks; i++)
+    {
+        vCoefsEven  = _mm512_loadu_si512((const void *)&piCoefs[i << 4]);
+        vCoefsOdd   = _mm512_srli_epi64(vCoefsEven, 32);
+        for(uj = 0; uj < uiNChannels; uj++)
+        {
+            vData       = _mm512_loadu_si512((const void *)&ppiData[uj][i << 4]);
+            vAcc[uj]    = _mm512_add_epi64(vAcc[uj], _mm512_mul_epi32(vData, vCoefsEven));
+            vAcc[uj]    = _mm512_add_epi64(vAcc[uj], _mm512_mul_epi32(_mm512_srli_epi64(vData, 32), vCoefsOdd));
+        }
+    }
+
+    // Transpose-reduce the 8 accumulators so that 64 bit lane j holds the sum for channel j.
+    // Wrapping adds, so the order of summation does not change the result.
+    vA = _mm512_add_epi64(_mm512_unpacklo_epi64(vAcc[0], vAcc[1]), _mm512_unpackhi_epi64(vAcc[0], vAcc[1]));
+    vB = _mm512_add_epi64(_mm512_unpacklo_epi64(vAcc[2], vAcc[3]), _mm512_unpackhi_epi64(vAcc[2], vAcc[3]));
+    vC = _mm512_add_epi64(_mm512_unpacklo_epi64(vAcc[4], vAcc[5]), _mm512_unpackhi_epi64(vAcc[4], vAcc[5]));
+    vD = _mm512_add_epi64(_mm512_unpacklo_epi64(vAcc[6], vAcc[7]), _mm512_unpackhi_epi64(vAcc[6], vAcc[7]));
+    vA = _mm512_add_epi64(_mm512_shuffle_i64x2(vA, vB, _MM_SHUFFLE(2, 0, 2, 0)), _mm512_shuffle_i64x2(vA, vB, _MM_SHUFFLE(3, 1, 3, 1)));
+    vC = _mm512_add_epi64(_mm512_shuffle_i64x2(vC, vD, _MM_SHUFFLE(2, 0, 2, 0)), _mm512_shuffle_i64x2(vC, vD, _MM_SHUFFLE(3, 1, 3, 1)));
+    vA = _mm512_add_epi64(_mm512_shuffle_i64x2(vA, vC, _MM_SHUFFLE(2, 0, 2, 0)), _mm512_shuffle_i64x2(vA, vC, _MM_SHUFFLE(3, 1, 3, 1)));
+
+    // Saturate and extract at bit 30, as LSATS/LEXTRACT in the ADFIR assembler
+    vA = _mm512_min_epi64(vA, _mm512_set1_epi64(MAX_VAL64_29));
+    vA = _mm512_max_epi64(vA, _mm512_set1_epi64(MIN_VAL64_29));
+    vA = _mm512_srai_epi64(vA, 30);
+    _mm256_storeu_si256((__m256i *)iOut, _mm512_cvtepi64_epi32(vA));
+
+    for(uj = 0; uj < uiNChannels; uj++)
+        iData[uj] = iOut[uj];
+}
+
+// LSATS/LEXTRACT at bit 30 of one 64 bit accumulator
+static inline int adfir_sat_extract(long long i64Acc)
+{
+    if(i64Acc > MAX_VAL64_29)
+        i64Acc = MAX_VAL64_29;
+    if(i64Acc < MIN_VAL64_29)
+        i64Acc = MIN_VAL64_29;
+    return (int)(i64Acc >> 30);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_adfir_inner_loop_interleaved_avx2          //
+// Arguments:       As src_mrhf_adfir_inner_loop_interleaved            //
+// Return values:   None                                                //
+// Description:     Computes one ADFIR output sample per channel        //
+// ==================================================================== //
+__attribute__((target("avx2")))
+void src_mrhf_adfir_inner_loop_interleaved_avx2(int *piData, int *piCoefs, int iData[], unsigned uiNChannels, int count)
+{
+    int             iNTaps      = (count >> 3) << 4;
+    long long       i64Acc[8];
+    unsigned        uj = 0;
+    int             i;
+
+    // 8 channels per pass in two accumulators of 4 64 bit lanes
+    for(; uj + 8 <= uiNChannels; uj += 8)
+    {
+        __m256i     vAcc0       = _mm256_setzero_si256();
+        __m256i     vAcc1       = _mm256_setzero_si256();
+
+        for(i = 0; i < iNTaps; i++)
+        {
+            __m256i vCoef   = _mm256_set1_epi32(piCoefs[i]);
+            int    *piTap   = &piData[i * uiNChannels + uj];
+            vAcc0   = _mm256_add_epi64(vAcc0, _mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)piTap)), vCoef));
+            vAcc1   = _mm256_add_epi64(vAcc1, _mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(piTap + 4))), vCoef));
+        }
+        _mm256_storeu_si256((__m256i *)&i64Acc[0], vAcc0);
+        _mm256_storeu_si256((__m256i *)&i64Acc[4], vAcc1);
+        for(int k = 0; k < 8; k++)
+            iData[uj + k] = adfir_sat_extract(i64Acc[k]);
+    }
+    if(uj + 4 <= uiNChannels)
+    {
+        __m256i     vAcc0       = _mm256_setzero_si256();
+
+        for(i = 0; i < iNTaps; i++)
+            vAcc0   = _mm256_add_epi64(vAcc0, _mm256_mul_epi32(_mm256_cvtepi32_epi64(
+                                _mm_loadu_si128((const __m128i *)&piData[i * uiNChannels + uj])), _mm256_set1_epi32(piCoefs[i])));
+        _mm256_storeu_si256((__m256i *)&i64Acc[0], vAcc0);
+        for(int k = 0; k < 4; k++)
+            iData[uj + k] = adfir_sat_extract(i64Acc[k]);
+        uj += 4;
+    }
+    for(; uj < uiNChannels; uj++)
+    {
+        uint64_t    u64Acc      = 0;
+
+        for(i = 0; i < iNTaps; i++)
+            u64Acc += (uint64_t)((long long)piData[i * uiNChannels + uj] * (long long)piCoefs[i]);
+        iData[uj] = adfir_sat_extract((long long)u64Acc);
+    }
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_adfir_inner_loop_interleaved_avx512        //
+// Arguments:       As src_mrhf_adfir_inner_loop_interleaved            //
+// Return values:   None                                                //
+// Description:     Computes one ADFIR output sample per channel        //
+// ==================================================================== //
+__attribute__((target("avx512f")))
+void src_mrhf_adfir_inner_loop_interleaved_avx512(int *piData, int *piCoefs, int iData[], unsigned uiNChannels, int count)
+{
+    int             iNTaps      = (count >> 3) << 4;
+    unsigned        uj;
+    int             i;
+
+    // 8 channels per 64 bit lane group, the last group masked
+    for(uj = 0; uj < uiNChannels; uj += 8)
+    {
+        unsigned    uiNCh       = (uiNChannels - uj < 8) ? uiNChannels - uj : 8;
+        __mmask16   kMask       = (__mmask16)((1u << uiNCh) - 1);
+        __m512i     vAcc        = _mm512_setzero_si512();
+
+        for(i = 0; i < iNTaps; i++)
+        {
+            __m512i vTap    = _mm512_maskz_loadu_epi32(kMask, &piData[i * uiNChannels + uj]);
+            vAcc    = _mm512_add_epi64(vAcc, _mm512_mul_epi32(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(vTap)),
+                                                              _mm512_set1_epi32(piCoefs[i])));
+        }
+
+        // Saturate and extract at bit 30, as LSATS/LEXTRACT in the ADFIR assembler
+        vAcc = _mm512_min_epi64(vAcc, _mm512_set1_epi64(MAX_VAL64_29));
+        vAcc = _mm512_max_epi64(vAcc, _mm512_set1_epi64(MIN_VAL64_29));
+        vAcc = _mm512_srai_epi64(vAcc, 30);
+        _mm512_mask_cvtepi64_storeu_epi32(&iData[uj], (__mmask8)kMask, vAcc);
+    }
+}
+
+#endif // !__xcore__ && x86
@@ -0,0 +1,53 @@
+#!/usr/bin/env python
+# Copyright 2024 XMOS LIMITED.
+# This Software is subject to the terms of the XMOS Public Licence: Version 1.
+#
+# Generates the ADFIR phase tables FilterData/ADFirPhases.dat and
+# FilterData/ADFirPhases_xs3.dat from the prototype FilterData/ADFir.dat.
+# They are included as const data by src_mrhf_filter_defs.c, so run this
+# again whenever the prototype or the numbers of phases and taps change.
+#
+# There are N_PHASES phases of PHASE_N_TAPS taps, the last tap zero, then two
+# phases which start one tap delayed (first tap zero) so that the spline can
+# read three adjacent phases from any of the first N_PHASES. The VPU table is
+# transposed, tap major, with the taps of each 8 reversed.
+import os.path
+
+PROTOTYPE_N_TAPS = 1920
+N_PHASES = 128
+PHASE_N_TAPS = PROTOTYPE_N_TAPS // N_PHASES + 1
+
+
+def read_prototype(path):
+    with open(path) as f:
+        coefs = [int(c) for c in f.read().replace("\n", " ").split(",") if c.strip()]
+    assert len(coefs) == PROTOTYPE_N_TAPS
+    return coefs
+
+
+def build_phases(prototype, n_phases=N_PHASES):
+    """Phases of a prototype of (PHASE_N_TAPS - 1) * n_phases taps"""
+    assert len(prototype) == (PHASE_N_TAPS - 1) * n_phases
+    base = len(prototype) - n_phases
+    phases = []
+    for ui in range(n_phases):
+        phases.append([prototype[base + ui - uj * n_phases] for uj in range(PHASE_N_TAPS - 1)] + [0])
+    for ui in range(2):
+        phases.append([0] + [prototype[base + ui - uj * n_phases] for uj in range(PHASE_N_TAPS - 1)])
+    return phases
+
+
+def write_table(path, rows):
+    with open(path, "w") as f:
+        f.write(",\n".join("    {" + ", ".join(str(c) for c in row) + "}" for row in rows) + "\n")
+
+
+if __name__ == "__main__":
+    data_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "FilterData")
+    phases = build_phases(read_prototype(os.path.join(data_dir, "ADFir.dat")))
+
+    # iADFirCoefs[N_PHASES + 2][PHASE_N_TAPS]
+    write_table(os.path.join(data_dir, "ADFirPhases.dat"), phases)
+    # iADFirCoefs[PHASE_N_TAPS][N_PHASES + 2], [tap ^ 7][phase]
+    write_table(os.path.join(data_dir, "ADFirPhases_xs3.dat"),
+                [[phases[ui][uj ^ 7] for ui in range(N_PHASES + 2)] for uj in range(PHASE_N_TAPS)])
@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+# Copyright 2024 XMOS LIMITED.
+# This Software is subject to the terms of the XMOS Public Licence: Version 1.
+#
+# Generates the coefficient files of the low quality ASRC tier: the shorter
+# F1/F2 filters FilterData/*_low.dat and the ADFIR phase table
+# FilterData/ADFirPhases_low.dat. They are included by src_mrhf_filter_defs.c on the host. Run this again whenever the
+# standard F1/F2 filters or the ADFIR prototype change, then
+# src_mrhf_min_phase_generator.py for the minimum phase versions.
+#
+# The low tier F1/F2 filters are Kaiser windowed sincs about the centre of
+# the transition band of the standard ones, with 84% of their passband and
+# LOW_ATTENUATION_DB of stopband attenuation. Their taps are a multiple of 16,
+# as the FIR inner loops take 16 taps per step.
+#
+# The ADFIR phases keep PHASE_N_TAPS taps, as the spline and macc loops are
+# written for them, and the tiers differ in the number of phases. The low tier
+# takes every other phase of the standard prototype.
+import math
+import os.path
+
+from src_mrhf_adfir_phases_generator import PHASE_N_TAPS, build_phases, read_prototype, write_table
+
+LOW_PASSBAND = 0.84
+LOW_ATTENUATION_DB = 100.0
+LOW_N_PHASES = 64
+
+# Passband and stopband edges of the standard filters relative to the Nyquist
+# frequency of the rate they run at, and their DC gains
+FIR_FILTERS = {
+    "BL":       (0.4567, 0.5467, 1),
+    "BL9644":   (0.4183, 0.5017, 1),
+    "BL8848":   (0.4967, 0.5933, 1),
+    "BLF":      (0.4133, 0.5467, 1),
+    "BL19288":  (0.3683, 0.5000, 1),
+    "BL17696":  (0.4583, 0.5933, 1),
+    "UP":       (0.4567, 0.5467, 2),
+    "UP4844":   (0.4183, 0.5017, 2),
+    "UPF":      (0.4133, 0.5450, 2),
+    "UP192176": (0.3683, 0.5000, 2),
+}
+
+
+def bessel_i0(x):
+    term, total, k = 1.0, 1.0, 1
+    while term > 1e-12 * total:
+        term *= (x / (2 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def kaiser_lowpass(passband, stopband, gain):
+    """Windowed sinc lowpass, edges relative to the Nyquist frequency, in Q1.31 with gain DC gain"""
+    width = (stopband - passband) * math.pi
+    n_taps = int(math.ceil((LOW_ATTENUATION_DB - 7.95) / (2.285 * width) + 1))
+    n_taps = (n_taps + 15) // 16 * 16
+    beta = 0.1102 * (LOW_ATTENUATION_DB - 8.7)
+    cutoff = (passband + stopband) / 2
+    centre = (n_taps - 1) / 2.0
+    h = []
+    for n in range(n_taps):
+        t = n - centre
+        sinc = cutoff * (math.sin(math.pi * cutoff * t) / (math.pi * cutoff * t) if t else 1.0)
+        h.append(sinc * bessel_i0(beta * math.sqrt(1 - (t / centre) ** 2)) / bessel_i0(beta))
+    scale = gain * 2.0 ** 31 / sum(h)
+    coefs = [int(round(c * scale)) for c in h]
+    assert max(abs(c) for c in coefs) < 2**31
+    return coefs
+
+
+def write_coefs(path, coefs):
+    with open(path, "w") as f:
+        f.write("".join("    %d,\n" % c for c in coefs))
+
+
+if __name__ == "__main__":
+    data_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "FilterData")
+
+    for name, (passband, stopband, gain) in FIR_FILTERS.items():
+        centre = (passband + stopband) / 2
+        low_passband = passband * LOW_PASSBAND
+        write_coefs(os.path.join(data_dir, name + "_low.dat"),
+                    kaiser_lowpass(low_passband, 2 * centre - low_passband, gain))
+
+    prototype = read_prototype(os.path.join(data_dir, "ADFir.dat"))
+    # iADFirLowCoefs[LOW_N_PHASES + 2][PHASE_N_TAPS]
+    write_table(os.path.join(data_dir, "ADFirPhases_low.dat"),
+                build_phases(prototype[::2], LOW_N_PHASES))
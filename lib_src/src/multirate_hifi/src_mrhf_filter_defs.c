@@ -109,6 +109,176 @@ int                    iFirOSCoefs[FILTER_DEFS_FIR_OS_N_TAPS]     = {
     #include FILTER_DEFS_FIR_OS_FILE
 };
 
+// Minimum phase SSRC FIR filters descriptors (ordered by ID)
+FIRDescriptor_t            sSSRCFirMPDescriptor[FILTER_DEFS_SSRC_N_FIR_ID] =
+{
+    {FIR_TYPE_DS2,                            FILTER_DEFS_FIR_BL_N_TAPS,            iFirBLMPCoefs},          // FILTER_DEFS_FIR_BL_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL9644_N_TAPS,        iFirBL9644MPCoefs},      // FILTER_DEFS_FIR_BL9644_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL8848_N_TAPS,        iFirBL8848MPCoefs},      // FILTER_DEFS_FIR_BL8848_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL19288_N_TAPS,        iFirBL19288MPCoefs},     // FILTER_DEFS_FIR_BL19288_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL17696_N_TAPS,        iFirBL17696MPCoefs},     // FILTER_DEFS_FIR_BL17696_ID
+    {FIR_TYPE_OS2,                            FILTER_DEFS_FIR_UP_N_TAPS,            iFirUPMPCoefs},          // FILTER_DEFS_FIR_UP_ID
+    {FIR_TYPE_OS2,                            FILTER_DEFS_FIR_UP4844_N_TAPS,        iFirUP4844MPCoefs},      // FILTER_DEFS_FIR_UP4844_ID
+    {FIR_TYPE_OS2,                            FILTER_DEFS_FIR_UPF_N_TAPS,            iFirUPFMPCoefs},         // FILTER_DEFS_FIR_UPF_ID
+    {FIR_TYPE_OS2,                            FILTER_DEFS_FIR_UP192176_N_TAPS,    iFirUP192176MPCoefs},    // FILTER_DEFS_FIR_UP192176_ID
+    {FIR_TYPE_DS2,                            FILTER_DEFS_FIR_DS_N_TAPS,            iFirDSMPCoefs},          // FILTER_DEFS_FIR_DS_ID
+    {FIR_TYPE_OS2,                            FILTER_DEFS_FIR_OS_N_TAPS,            iFirOSMPCoefs},          // FILTER_DEFS_FIR_OS_ID
+    {FIR_TYPE_SYNC,                            0,                                    0}                        // FILTER_DEFS_FIR_NONE_ID
+};
+// Minimum phase ASRC FIR filters descriptors (ordered by ID)
+FIRDescriptor_t            sASRCFirMPDescriptor[FILTER_DEFS_ASRC_N_FIR_ID] =
+{
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL_N_TAPS,            iFirBLMPCoefs},          // FILTER_DEFS_FIR_BL_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL9644_N_TAPS,        iFirBL9644MPCoefs},      // FILTER_DEFS_FIR_BL9644_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL8848_N_TAPS,        iFirBL8848MPCoefs},      // FILTER_DEFS_FIR_BL8848_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BLF_N_TAPS,            iFirBLFMPCoefs},         // FILTER_DEFS_FIR_BLF_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL19288_N_TAPS,        iFirBL19288MPCoefs},     // FILTER_DEFS_FIR_BL19288_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL17696_N_TAPS,        iFirBL17696MPCoefs},     // FILTER_DEFS_FIR_BL17696_ID
+    {FIR_TYPE_OS2,                            FILTER_DEFS_FIR_UP_N_TAPS,            iFirUPMPCoefs},          // FILTER_DEFS_FIR_UP_ID
+    {FIR_TYPE_OS2,                            FILTER_DEFS_FIR_UP4844_N_TAPS,        iFirUP4844MPCoefs},      // FILTER_DEFS_FIR_UP4844_ID
+    {FIR_TYPE_OS2,                            FILTER_DEFS_FIR_UPF_N_TAPS,            iFirUPFMPCoefs},         // FILTER_DEFS_FIR_UPF_ID
+    {FIR_TYPE_OS2,                            FILTER_DEFS_FIR_UP192176_N_TAPS,    iFirUP192176MPCoefs},    // FILTER_DEFS_FIR_UP192176_ID
+    {FIR_TYPE_DS2,                            FILTER_DEFS_FIR_DS_N_TAPS,            iFirDSMPCoefs},          // FILTER_DEFS_FIR_DS_ID
+    {FIR_TYPE_SYNC,                            0,                                    0}                        // FILTER_DEFS_FIR_NONE_ID
+};
+
+#ifndef __xcore__
+// Low quality ASRC tier FIR filters descriptors (ordered by ID), see src_mrhf_asrc_quality_generator.py
+FIRDescriptor_t            sASRCFirLowDescriptor[FILTER_DEFS_ASRC_N_FIR_ID] =
+{
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL_LOW_N_TAPS,            iFirBLLowCoefs},            // FILTER_DEFS_FIR_BL_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL9644_LOW_N_TAPS,        iFirBL9644LowCoefs},        // FILTER_DEFS_FIR_BL9644_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL8848_LOW_N_TAPS,        iFirBL8848LowCoefs},        // FILTER_DEFS_FIR_BL8848_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BLF_LOW_N_TAPS,           iFirBLFLowCoefs},           // FILTER_DEFS_FIR_BLF_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL19288_LOW_N_TAPS,       iFirBL19288LowCoefs},       // FILTER_DEFS_FIR_BL19288_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL17696_LOW_N_TAPS,       iFirBL17696LowCoefs},       // FILTER_DEFS_FIR_BL17696_ID
+    {FIR_TYPE_OS2,                             FILTER_DEFS_FIR_UP_LOW_N_TAPS,            iFirUPLowCoefs},            // FILTER_DEFS_FIR_UP_ID
+    {FIR_TYPE_OS2,                             FILTER_DEFS_FIR_UP4844_LOW_N_TAPS,        iFirUP4844LowCoefs},        // FILTER_DEFS_FIR_UP4844_ID
+    {FIR_TYPE_OS2,                             FILTER_DEFS_FIR_UPF_LOW_N_TAPS,           iFirUPFLowCoefs},           // FILTER_DEFS_FIR_UPF_ID
+    {FIR_TYPE_OS2,                             FILTER_DEFS_FIR_UP192176_LOW_N_TAPS,      iFirUP192176LowCoefs},      // FILTER_DEFS_FIR_UP192176_ID
+    {FIR_TYPE_DS2,                             FILTER_DEFS_FIR_DS_N_TAPS,                iFirDSCoefs},               // FILTER_DEFS_FIR_DS_ID
+    {FIR_TYPE_SYNC,                            0,                                        0}                          // FILTER_DEFS_FIR_NONE_ID
+};
+// Minimum phase low quality ASRC tier FIR filters descriptors (ordered by ID)
+FIRDescriptor_t            sASRCFirLowMPDescriptor[FILTER_DEFS_ASRC_N_FIR_ID] =
+{
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL_LOW_N_TAPS,            iFirBLLowMPCoefs},          // FILTER_DEFS_FIR_BL_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL9644_LOW_N_TAPS,        iFirBL9644LowMPCoefs},      // FILTER_DEFS_FIR_BL9644_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL8848_LOW_N_TAPS,        iFirBL8848LowMPCoefs},      // FILTER_DEFS_FIR_BL8848_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BLF_LOW_N_TAPS,           iFirBLFLowMPCoefs},         // FILTER_DEFS_FIR_BLF_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL19288_LOW_N_TAPS,       iFirBL19288LowMPCoefs},     // FILTER_DEFS_FIR_BL19288_ID
+    {FIR_TYPE_SYNC,                            FILTER_DEFS_FIR_BL17696_LOW_N_TAPS,       iFirBL17696LowMPCoefs},     // FILTER_DEFS_FIR_BL17696_ID
+    {FIR_TYPE_OS2,                             FILTER_DEFS_FIR_UP_LOW_N_TAPS,            iFirUPLowMPCoefs},          // FILTER_DEFS_FIR_UP_ID
+    {FIR_TYPE_OS2,                             FILTER_DEFS_FIR_UP4844_LOW_N_TAPS,        iFirUP4844LowMPCoefs},      // FILTER_DEFS_FIR_UP4844_ID
+    {FIR_TYPE_OS2,                             FILTER_DEFS_FIR_UPF_LOW_N_TAPS,           iFirUPFLowMPCoefs},         // FILTER_DEFS_FIR_UPF_ID
+    {FIR_TYPE_OS2,                             FILTER_DEFS_FIR_UP192176_LOW_N_TAPS,      iFirUP192176LowMPCoefs},    // FILTER_DEFS_FIR_UP192176_ID
+    {FIR_TYPE_DS2,                             FILTER_DEFS_FIR_DS_N_TAPS,                iFirDSMPCoefs},             // FILTER_DEFS_FIR_DS_ID
+    {FIR_TYPE_SYNC,                            0,                                        0}                          // FILTER_DEFS_FIR_NONE_ID
+};
+#endif
+
+// Minimum phase FIR filters coefficients, generated by src_mrhf_min_phase_generator.py
+int                    iFirBLMPCoefs[FILTER_DEFS_FIR_BL_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL_MP_FILE
+};
+int                    iFirBL9644MPCoefs[FILTER_DEFS_FIR_BL9644_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL9644_MP_FILE
+};
+int                    iFirBL8848MPCoefs[FILTER_DEFS_FIR_BL8848_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL8848_MP_FILE
+};
+int                    iFirBLFMPCoefs[FILTER_DEFS_FIR_BLF_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BLF_MP_FILE
+};
+int                    iFirBL19288MPCoefs[FILTER_DEFS_FIR_BL19288_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL19288_MP_FILE
+};
+int                    iFirBL17696MPCoefs[FILTER_DEFS_FIR_BL17696_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL17696_MP_FILE
+};
+int                    iFirUPMPCoefs[FILTER_DEFS_FIR_UP_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UP_MP_FILE
+};
+int                    iFirUP4844MPCoefs[FILTER_DEFS_FIR_UP4844_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UP4844_MP_FILE
+};
+int                    iFirUPFMPCoefs[FILTER_DEFS_FIR_UPF_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UPF_MP_FILE
+};
+int                    iFirUP192176MPCoefs[FILTER_DEFS_FIR_UP192176_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UP192176_MP_FILE
+};
+int                    iFirDSMPCoefs[FILTER_DEFS_FIR_DS_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_DS_MP_FILE
+};
+int                    iFirOSMPCoefs[FILTER_DEFS_FIR_OS_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_OS_MP_FILE
+};
+
+#ifndef __xcore__
+// Low quality ASRC tier FIR filters coefficients, linear and minimum phase
+int                    iFirBLLowCoefs[FILTER_DEFS_FIR_BL_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL_LOW_FILE
+};
+int                    iFirBL9644LowCoefs[FILTER_DEFS_FIR_BL9644_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL9644_LOW_FILE
+};
+int                    iFirBL8848LowCoefs[FILTER_DEFS_FIR_BL8848_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL8848_LOW_FILE
+};
+int                    iFirBLFLowCoefs[FILTER_DEFS_FIR_BLF_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BLF_LOW_FILE
+};
+int                    iFirBL19288LowCoefs[FILTER_DEFS_FIR_BL19288_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL19288_LOW_FILE
+};
+int                    iFirBL17696LowCoefs[FILTER_DEFS_FIR_BL17696_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL17696_LOW_FILE
+};
+int                    iFirUPLowCoefs[FILTER_DEFS_FIR_UP_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UP_LOW_FILE
+};
+int                    iFirUP4844LowCoefs[FILTER_DEFS_FIR_UP4844_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UP4844_LOW_FILE
+};
+int                    iFirUPFLowCoefs[FILTER_DEFS_FIR_UPF_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UPF_LOW_FILE
+};
+int                    iFirUP192176LowCoefs[FILTER_DEFS_FIR_UP192176_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UP192176_LOW_FILE
+};
+int                    iFirBLLowMPCoefs[FILTER_DEFS_FIR_BL_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL_LOW_MP_FILE
+};
+int                    iFirBL9644LowMPCoefs[FILTER_DEFS_FIR_BL9644_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL9644_LOW_MP_FILE
+};
+int                    iFirBL8848LowMPCoefs[FILTER_DEFS_FIR_BL8848_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL8848_LOW_MP_FILE
+};
+int                    iFirBLFLowMPCoefs[FILTER_DEFS_FIR_BLF_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BLF_LOW_MP_FILE
+};
+int                    iFirBL19288LowMPCoefs[FILTER_DEFS_FIR_BL19288_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL19288_LOW_MP_FILE
+};
+int                    iFirBL17696LowMPCoefs[FILTER_DEFS_FIR_BL17696_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_BL17696_LOW_MP_FILE
+};
+int                    iFirUPLowMPCoefs[FILTER_DEFS_FIR_UP_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UP_LOW_MP_FILE
+};
+int                    iFirUP4844LowMPCoefs[FILTER_DEFS_FIR_UP4844_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UP4844_LOW_MP_FILE
+};
+int                    iFirUPFLowMPCoefs[FILTER_DEFS_FIR_UPF_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UPF_LOW_MP_FILE
+};
+int                    iFirUP192176LowMPCoefs[FILTER_DEFS_FIR_UP192176_LOW_N_TAPS]     = {
+    #include FILTER_DEFS_FIR_UP192176_LOW_MP_FILE
+};
+#endif
+
 
 
 // ADFIR filters descriptor
@@ -121,10 +291,26 @@ ADFIRDescriptor_t        sADFirDescriptor =
 int                    iADFirPrototypeCoefs[FILTER_DEFS_ADFIR_PROTOTYPE_N_TAPS]  = {
     #include FILTER_DEFS_ADFIR_PROTOTYPE_FILE
 };
+// ADFIR filter phases, built from the prototype at build time (tap major with the VPU)
 #if SRC_USE_VPU
-int                    iADFirCoefs[FILTER_DEFS_ADFIR_PHASE_N_TAPS][FILTER_DEFS_ADFIR_N_PHASES + 2];
+const int              iADFirCoefs[FILTER_DEFS_ADFIR_PHASE_N_TAPS][FILTER_DEFS_ADFIR_N_PHASES + 2] = {
 #else
-int                    iADFirCoefs[FILTER_DEFS_ADFIR_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS];
+const int              iADFirCoefs[FILTER_DEFS_ADFIR_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS] = {
+#endif
+    #include FILTER_DEFS_ADFIR_PHASES_FILE
+};
+#ifndef __xcore__
+// ADFIR filter phases of the low quality ASRC tier, see src_mrhf_asrc_quality_generator.py
+const int              iADFirLowCoefs[FILTER_DEFS_ADFIR_LOW_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS] = {
+    #include FILTER_DEFS_ADFIR_LOW_PHASES_FILE
+};
+// Minimum phase ADFIR filter phases of both tiers, see src_mrhf_min_phase_generator.py
+const int              iADFirMPCoefs[FILTER_DEFS_ADFIR_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS] = {
+    #include FILTER_DEFS_ADFIR_MP_PHASES_FILE
+};
+const int              iADFirLowMPCoefs[FILTER_DEFS_ADFIR_LOW_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS] = {
+    #include FILTER_DEFS_ADFIR_LOW_MP_PHASES_FILE
+};
 #endif
 
 // PPFIR filters descriptors (ordered by ID)
@@ -143,6 +329,22 @@ int                    iPPFirHS320Coefs[FILTER_DEFS_PPFIR_HS320_N_TAPS]  = {
     #include FILTER_DEFS_PPFIR_HS320_FILE
 };
 
+// Minimum phase PPFIR filters descriptors (ordered by ID)
+PPFIRDescriptor_t        sPPFirMPDescriptor[FILTER_DEFS_N_PPFIR_ID] =
+{
+    {FILTER_DEFS_PPFIR_HS294_N_TAPS,        FILTER_DEFS_PPFIR_HS294_N_PHASES,    iPPFirHS294MPCoefs},      // FILTER_DEFS_PPFIR_HS294_ID
+    {FILTER_DEFS_PPFIR_HS320_N_TAPS,        FILTER_DEFS_PPFIR_HS320_N_PHASES,    iPPFirHS320MPCoefs},      // FILTER_DEFS_PPFIR_HS320_ID
+    {0,                                        0,                                    0}                        // FILTER_DEFS_PPFIR_NONE_ID
+};
+
+// Minimum phase PPFIR filters coefficients, generated by src_mrhf_min_phase_generator.py
+int                    iPPFirHS294MPCoefs[FILTER_DEFS_PPFIR_HS294_N_TAPS]  = {
+    #include FILTER_DEFS_PPFIR_HS294_MP_FILE
+};
+int                    iPPFirHS320MPCoefs[FILTER_DEFS_PPFIR_HS320_N_TAPS]  = {
+    #include FILTER_DEFS_PPFIR_HS320_MP_FILE
+};
+
 
 
 
@@ -98,6 +98,65 @@
 #endif
     #define        FILTER_DEFS_FIR_DS_FILE                "FilterData/DS.dat"            // Coefficients file for DS filter
 
+    // Minimum phase FIR filter coefficients files, generated from the linear phase ones by src_mrhf_min_phase_generator.py
+#if SRC_USE_VPU
+    #define        FILTER_DEFS_FIR_UP_MP_FILE             "FilterData/UP_mp_xs3.dat"         // Minimum phase coefficients file for UP filter
+    #define        FILTER_DEFS_FIR_UP4844_MP_FILE         "FilterData/UP4844_mp_xs3.dat"     // Minimum phase coefficients file for UP4844 filter
+    #define        FILTER_DEFS_FIR_UPF_MP_FILE            "FilterData/UPF_mp_xs3.dat"        // Minimum phase coefficients file for UPF filter
+    #define        FILTER_DEFS_FIR_UP192176_MP_FILE       "FilterData/UP192176_mp_xs3.dat"   // Minimum phase coefficients file for UP192176 filter
+    #define        FILTER_DEFS_FIR_OS_MP_FILE             "FilterData/OS_mp_xs3.dat"         // Minimum phase coefficients file for OS filter
+#else
+    #define        FILTER_DEFS_FIR_UP_MP_FILE             "FilterData/UP_mp.dat"             // Minimum phase coefficients file for UP filter
+    #define        FILTER_DEFS_FIR_UP4844_MP_FILE         "FilterData/UP4844_mp.dat"         // Minimum phase coefficients file for UP4844 filter
+    #define        FILTER_DEFS_FIR_UPF_MP_FILE            "FilterData/UPF_mp.dat"            // Minimum phase coefficients file for UPF filter
+    #define        FILTER_DEFS_FIR_UP192176_MP_FILE       "FilterData/UP192176_mp.dat"       // Minimum phase coefficients file for UP192176 filter
+    #define        FILTER_DEFS_FIR_OS_MP_FILE             "FilterData/OS_mp.dat"             // Minimum phase coefficients file for OS filter
+#endif
+    #define        FILTER_DEFS_FIR_BL_MP_FILE             "FilterData/BL_mp.dat"             // Minimum phase coefficients file for BL FIR filter
+    #define        FILTER_DEFS_FIR_BL9644_MP_FILE         "FilterData/BL9644_mp.dat"         // Minimum phase coefficients file for BL9644 FIR filter
+    #define        FILTER_DEFS_FIR_BL8848_MP_FILE         "FilterData/BL8848_mp.dat"         // Minimum phase coefficients file for BL8848 filter
+    #define        FILTER_DEFS_FIR_BLF_MP_FILE            "FilterData/BLF_mp.dat"            // Minimum phase coefficients file for BLF FIR filter
+    #define        FILTER_DEFS_FIR_BL19288_MP_FILE        "FilterData/BL19288_mp.dat"        // Minimum phase coefficients file for BL19288 FIR filter
+    #define        FILTER_DEFS_FIR_BL17696_MP_FILE        "FilterData/BL17696_mp.dat"        // Minimum phase coefficients file for BL17696 filter
+    #define        FILTER_DEFS_FIR_DS_MP_FILE             "FilterData/DS_mp.dat"             // Minimum phase coefficients file for DS filter
+
+#ifndef __xcore__
+    // Low quality ASRC tier FIR filters (host only), generated with their phases by src_mrhf_asrc_quality_generator.py.
+    // They are shorter than the standard filters of the same ID, so they fit their delay lines. DS is kept
+    #define        FILTER_DEFS_FIR_BL_LOW_N_TAPS          64            // Number of taps of low quality BL FIR filter
+    #define        FILTER_DEFS_FIR_BL9644_LOW_N_TAPS      64            // Number of taps of low quality BL9644 FIR filter
+    #define        FILTER_DEFS_FIR_BL8848_LOW_N_TAPS      64            // Number of taps of low quality BL8848 filter
+    #define        FILTER_DEFS_FIR_BLF_LOW_N_TAPS         64            // Number of taps of low quality BLF FIR filter
+    #define        FILTER_DEFS_FIR_BL19288_LOW_N_TAPS     64            // Number of taps of low quality BL19288 filter
+    #define        FILTER_DEFS_FIR_BL17696_LOW_N_TAPS     48            // Number of taps of low quality BL17696 filter
+    #define        FILTER_DEFS_FIR_UP_LOW_N_TAPS          64            // Number of taps of low quality UP filter
+    #define        FILTER_DEFS_FIR_UP4844_LOW_N_TAPS      64            // Number of taps of low quality UP4844 filter
+    #define        FILTER_DEFS_FIR_UPF_LOW_N_TAPS         64            // Number of taps of low quality UPF filter
+    #define        FILTER_DEFS_FIR_UP192176_LOW_N_TAPS    64            // Number of taps of low quality UP192176 filter
+
+    #define        FILTER_DEFS_FIR_BL_LOW_FILE            "FilterData/BL_low.dat"            // Coefficients file for low quality BL FIR filter
+    #define        FILTER_DEFS_FIR_BL9644_LOW_FILE        "FilterData/BL9644_low.dat"        // Coefficients file for low quality BL9644 FIR filter
+    #define        FILTER_DEFS_FIR_BL8848_LOW_FILE        "FilterData/BL8848_low.dat"        // Coefficients file for low quality BL8848 filter
+    #define        FILTER_DEFS_FIR_BLF_LOW_FILE           "FilterData/BLF_low.dat"           // Coefficients file for low quality BLF FIR filter
+    #define        FILTER_DEFS_FIR_BL19288_LOW_FILE       "FilterData/BL19288_low.dat"       // Coefficients file for low quality BL19288 FIR filter
+    #define        FILTER_DEFS_FIR_BL17696_LOW_FILE       "FilterData/BL17696_low.dat"       // Coefficients file for low quality BL17696 filter
+    #define        FILTER_DEFS_FIR_UP_LOW_FILE            "FilterData/UP_low.dat"            // Coefficients file for low quality UP filter
+    #define        FILTER_DEFS_FIR_UP4844_LOW_FILE        "FilterData/UP4844_low.dat"        // Coefficients file for low quality UP4844 filter
+    #define        FILTER_DEFS_FIR_UPF_LOW_FILE           "FilterData/UPF_low.dat"           // Coefficients file for low quality UPF filter
+    #define        FILTER_DEFS_FIR_UP192176_LOW_FILE      "FilterData/UP192176_low.dat"      // Coefficients file for low quality UP192176 filter
+
+    #define        FILTER_DEFS_FIR_BL_LOW_MP_FILE         "FilterData/BL_low_mp.dat"         // Minimum phase coefficients file for low quality BL FIR filter
+    #define        FILTER_DEFS_FIR_BL9644_LOW_MP_FILE     "FilterData/BL9644_low_mp.dat"     // Minimum phase coefficients file for low quality BL9644 FIR filter
+    #define        FILTER_DEFS_FIR_BL8848_LOW_MP_FILE     "FilterData/BL8848_low_mp.dat"     // Minimum phase coefficients file for low quality BL8848 filter
+    #define        FILTER_DEFS_FIR_BLF_LOW_MP_FILE        "FilterData/BLF_low_mp.dat"        // Minimum phase coefficients file for low quality BLF FIR filter
+    #define        FILTER_DEFS_FIR_BL19288_LOW_MP_FILE    "FilterData/BL19288_low_mp.dat"    // Minimum phase coefficients file for low quality BL19288 FIR filter
+    #define        FILTER_DEFS_FIR_BL17696_LOW_MP_FILE    "FilterData/BL17696_low_mp.dat"    // Minimum phase coefficients file for low quality BL17696 filter
+    #define        FILTER_DEFS_FIR_UP_LOW_MP_FILE         "FilterData/UP_low_mp.dat"         // Minimum phase coefficients file for low quality UP filter
+    #define        FILTER_DEFS_FIR_UP4844_LOW_MP_FILE     "FilterData/UP4844_low_mp.dat"     // Minimum phase coefficients file for low quality UP4844 filter
+    #define        FILTER_DEFS_FIR_UPF_LOW_MP_FILE        "FilterData/UPF_low_mp.dat"        // Minimum phase coefficients file for low quality UPF filter
+    #define        FILTER_DEFS_FIR_UP192176_LOW_MP_FILE   "FilterData/UP192176_low_mp.dat"   // Minimum phase coefficients file for low quality UP192176 filter
+#endif
+
     // ADFIR filter number of taps and phases
     #define        FILTER_DEFS_ADFIR_PROTOTYPE_N_TAPS    1920                                                                        // Number of taps of ADFIR filter prototype
 
@@ -107,6 +166,21 @@
 
     // ADFIR filter coefficients files
     #define        FILTER_DEFS_ADFIR_PROTOTYPE_FILE    "FilterData/ADFir.dat"        // Coefficients file for the ADFIR filter (prototype)
+#if SRC_USE_VPU
+    #define        FILTER_DEFS_ADFIR_PHASES_FILE        "FilterData/ADFirPhases_xs3.dat"    // Phases of the ADFIR filter, generated from the prototype by src_mrhf_adfir_phases_generator.py
+#else
+    #define        FILTER_DEFS_ADFIR_PHASES_FILE        "FilterData/ADFirPhases.dat"        // Phases of the ADFIR filter, generated from the prototype by src_mrhf_adfir_phases_generator.py
+#endif
+
+#ifndef __xcore__
+    // ADFIR filter phases of the low quality ASRC tier (host only), of FILTER_DEFS_ADFIR_PHASE_N_TAPS taps as the standard ones
+    #define        FILTER_DEFS_ADFIR_LOW_N_PHASES       64                                    // Number of phases of low quality ADFIR filter
+    #define        FILTER_DEFS_ADFIR_LOW_PHASES_FILE    "FilterData/ADFirPhases_low.dat"      // Phases of the low quality ADFIR filter, every other phase of the standard one
+
+    // Minimum phase ADFIR filter phases (host only), generated by src_mrhf_min_phase_generator.py
+    #define        FILTER_DEFS_ADFIR_MP_PHASES_FILE     "FilterData/ADFirPhases_mp.dat"       // Phases of the minimum phase ADFIR filter
+    #define        FILTER_DEFS_ADFIR_LOW_MP_PHASES_FILE "FilterData/ADFirPhases_low_mp.dat"   // Phases of the minimum phase low quality ADFIR filter
+#endif
 
     // PPFIR filters IDs
     #define        FILTER_DEFS_PPFIR_HS294_ID            0            // ID of HS294 PPFIR filter
@@ -132,6 +206,8 @@
     // PPFIR filter coefficients files
     #define        FILTER_DEFS_PPFIR_HS294_FILE        "FilterData/HS294.dat"    // Coefficients file for HS294 PPFIR filter
     #define        FILTER_DEFS_PPFIR_HS320_FILE        "FilterData/HS320.dat"    // Coefficients file for HS320 PPFIR filter
+    #define        FILTER_DEFS_PPFIR_HS294_MP_FILE     "FilterData/HS294_mp.dat"    // Minimum phase coefficients file for HS294 PPFIR filter
+    #define        FILTER_DEFS_PPFIR_HS320_MP_FILE     "FilterData/HS320_mp.dat"    // Minimum phase coefficients file for HS320 PPFIR filter
 
 
 
@@ -159,14 +235,65 @@
     extern        int                                    iFirDSCoefs[FILTER_DEFS_FIR_DS_N_TAPS];
     extern        int                                    iFirOSCoefs[FILTER_DEFS_FIR_OS_N_TAPS];
 
+    // Minimum phase FIR filters descriptors (ordered by ID, as the linear phase ones)
+    extern        FIRDescriptor_t                        sSSRCFirMPDescriptor[FILTER_DEFS_SSRC_N_FIR_ID];
+    extern        FIRDescriptor_t                        sASRCFirMPDescriptor[FILTER_DEFS_ASRC_N_FIR_ID];
+
+    // Minimum phase FIR filters coefficients
+    extern        int                                    iFirBLMPCoefs[FILTER_DEFS_FIR_BL_N_TAPS];
+    extern        int                                    iFirBL9644MPCoefs[FILTER_DEFS_FIR_BL9644_N_TAPS];
+    extern        int                                    iFirBL8848MPCoefs[FILTER_DEFS_FIR_BL8848_N_TAPS];
+    extern        int                                    iFirBLFMPCoefs[FILTER_DEFS_FIR_BLF_N_TAPS];
+    extern        int                                    iFirBL19288MPCoefs[FILTER_DEFS_FIR_BL19288_N_TAPS];
+    extern        int                                    iFirBL17696MPCoefs[FILTER_DEFS_FIR_BL17696_N_TAPS];
+    extern        int                                    iFirUPMPCoefs[FILTER_DEFS_FIR_UP_N_TAPS];
+    extern        int                                    iFirUP4844MPCoefs[FILTER_DEFS_FIR_UP4844_N_TAPS];
+    extern        int                                    iFirUPFMPCoefs[FILTER_DEFS_FIR_UPF_N_TAPS];
+    extern        int                                    iFirUP192176MPCoefs[FILTER_DEFS_FIR_UP192176_N_TAPS];
+    extern        int                                    iFirDSMPCoefs[FILTER_DEFS_FIR_DS_N_TAPS];
+    extern        int                                    iFirOSMPCoefs[FILTER_DEFS_FIR_OS_N_TAPS];
+
+#ifndef __xcore__
+    // Low quality ASRC tier FIR filters descriptors, linear and minimum phase (ordered by ID, as the standard ones)
+    extern        FIRDescriptor_t                        sASRCFirLowDescriptor[FILTER_DEFS_ASRC_N_FIR_ID];
+    extern        FIRDescriptor_t                        sASRCFirLowMPDescriptor[FILTER_DEFS_ASRC_N_FIR_ID];
+
+    // Low quality ASRC tier FIR filters coefficients
+    extern        int                                    iFirBLLowCoefs[FILTER_DEFS_FIR_BL_LOW_N_TAPS];
+    extern        int                                    iFirBL9644LowCoefs[FILTER_DEFS_FIR_BL9644_LOW_N_TAPS];
+    extern        int                                    iFirBL8848LowCoefs[FILTER_DEFS_FIR_BL8848_LOW_N_TAPS];
+    extern        int                                    iFirBLFLowCoefs[FILTER_DEFS_FIR_BLF_LOW_N_TAPS];
+    extern        int                                    iFirBL19288LowCoefs[FILTER_DEFS_FIR_BL19288_LOW_N_TAPS];
+    extern        int                                    iFirBL17696LowCoefs[FILTER_DEFS_FIR_BL17696_LOW_N_TAPS];
+    extern        int                                    iFirUPLowCoefs[FILTER_DEFS_FIR_UP_LOW_N_TAPS];
+    extern        int                                    iFirUP4844LowCoefs[FILTER_DEFS_FIR_UP4844_LOW_N_TAPS];
+    extern        int                                    iFirUPFLowCoefs[FILTER_DEFS_FIR_UPF_LOW_N_TAPS];
+    extern        int                                    iFirUP192176LowCoefs[FILTER_DEFS_FIR_UP192176_LOW_N_TAPS];
+    extern        int                                    iFirBLLowMPCoefs[FILTER_DEFS_FIR_BL_LOW_N_TAPS];
+    extern        int                                    iFirBL9644LowMPCoefs[FILTER_DEFS_FIR_BL9644_LOW_N_TAPS];
+    extern        int                                    iFirBL8848LowMPCoefs[FILTER_DEFS_FIR_BL8848_LOW_N_TAPS];
+    extern        int                                    iFirBLFLowMPCoefs[FILTER_DEFS_FIR_BLF_LOW_N_TAPS];
+    extern        int                                    iFirBL19288LowMPCoefs[FILTER_DEFS_FIR_BL19288_LOW_N_TAPS];
+    extern        int                                    iFirBL17696LowMPCoefs[FILTER_DEFS_FIR_BL17696_LOW_N_TAPS];
+    extern        int                                    iFirUPLowMPCoefs[FILTER_DEFS_FIR_UP_LOW_N_TAPS];
+    extern        int                                    iFirUP4844LowMPCoefs[FILTER_DEFS_FIR_UP4844_LOW_N_TAPS];
+    extern        int                                    iFirUPFLowMPCoefs[FILTER_DEFS_FIR_UPF_LOW_N_TAPS];
+    extern        int                                    iFirUP192176LowMPCoefs[FILTER_DEFS_FIR_UP192176_LOW_N_TAPS];
+#endif
+
     // ADFIR filter descriptor
     extern        ADFIRDescriptor_t                    sADFirDescriptor;
     // ADFIR filters coefficients
     extern        int                                    iADFirPrototypeCoefs[FILTER_DEFS_ADFIR_PROTOTYPE_N_TAPS];
 #if SRC_USE_VPU
-    extern        int                                    iADFirCoefs[FILTER_DEFS_ADFIR_PHASE_N_TAPS][FILTER_DEFS_ADFIR_N_PHASES + 2];
+    extern const  int                                    iADFirCoefs[FILTER_DEFS_ADFIR_PHASE_N_TAPS][FILTER_DEFS_ADFIR_N_PHASES + 2];
 #else
-    extern        int                                    iADFirCoefs[FILTER_DEFS_ADFIR_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS];
+    extern const  int                                    iADFirCoefs[FILTER_DEFS_ADFIR_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS];
+#endif
+#ifndef __xcore__
+    extern const  int                                    iADFirLowCoefs[FILTER_DEFS_ADFIR_LOW_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS];
+    extern const  int                                    iADFirMPCoefs[FILTER_DEFS_ADFIR_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS];
+    extern const  int                                    iADFirLowMPCoefs[FILTER_DEFS_ADFIR_LOW_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS];
 #endif
 
     // PPFIR filters descriptors (ordered by ID)
@@ -174,6 +301,11 @@
     // FIR filters coefficients
     extern        int                                    iPPFirHS294Coefs[FILTER_DEFS_PPFIR_HS294_N_TAPS];
     extern        int                                    iPPFirHS320Coefs[FILTER_DEFS_PPFIR_HS320_N_TAPS];
+    // Minimum phase PPFIR filters descriptors (ordered by ID, as the linear phase ones)
+    extern        PPFIRDescriptor_t                    sPPFirMPDescriptor[FILTER_DEFS_N_PPFIR_ID];
+    // Minimum phase PPFIR filters coefficients
+    extern        int                                    iPPFirHS294MPCoefs[FILTER_DEFS_PPFIR_HS294_N_TAPS];
+    extern        int                                    iPPFirHS320MPCoefs[FILTER_DEFS_PPFIR_HS320_N_TAPS];
 
     // ===========================================================================
     //
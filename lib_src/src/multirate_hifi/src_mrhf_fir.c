@@ -16,6 +16,7 @@
 //
 // ===========================================================================
 #include <stdlib.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <time.h>
 #include <math.h>
@@ -29,6 +30,9 @@
 // FIR includes
 #include "src_mrhf_fir.h"
 #include "use_vpu.h"
+#ifndef __xcore__
+#include "src_mrhf_mirror.h"
+#endif
 
 // ===========================================================================
 //
@@ -58,6 +62,10 @@
 //
 // ===========================================================================
 
+#ifndef __xcore__
+static void                     release_delay(int** ppiDelayB, unsigned int uiDelayL, int* piDelayW, int** ppiDelayM);
+#endif
+
 
 
 // ===========================================================================
@@ -76,6 +84,10 @@
 // ==================================================================== //
 FIRReturnCodes_t                FIR_init_from_desc(FIRCtrl_t* psFIRCtrl, FIRDescriptor_t* psFIRDescriptor)
 {
+#ifndef __xcore__
+    // Delay lines start as double write buffers, see FIR_mirror()
+    release_delay(&psFIRCtrl->piDelayB, psFIRCtrl->uiDelayL, psFIRCtrl->piDelayW, &psFIRCtrl->piDelayM);
+#endif
 
     // Check if FIR is disabled (this is given by the number of coefficients being zero)
     if( psFIRDescriptor->uiNCoefs == 0)
@@ -165,6 +177,11 @@ FIRReturnCodes_t                FIR_init_from_desc(FIRCtrl_t* psFIRCtrl, FIRDesc
             return FIR_ERROR;
     }
 
+#ifndef __xcore__
+    // Resolve the inner loops for this CPU once, rather than testing on every call
+    src_isa_get_kernels((psFIRDescriptor->eType == FIR_TYPE_OS2) ? SRC_KERNEL_FIR_OS : SRC_KERNEL_FIR, psFIRCtrl->pvInnerLoop);
+#endif
+
     // Sync the FIR
     if(FIR_sync(psFIRCtrl) != FIR_NO_ERROR)
         return FIR_ERROR;
@@ -173,6 +190,40 @@ FIRReturnCodes_t                FIR_init_from_desc(FIRCtrl_t* psFIRCtrl, FIRDesc
 }
 
 
+// ==================================================================== //
+// Function:        FIR_delay_length                                    //
+// Arguments:       FIRDescriptor_t *psFIRDescriptor: Desc. strct.      //
+// Return values:   Length of the delay line in words                   //
+// Description:     Delay line length FIR_init_from_desc sets up for    //
+//                  the Descriptor (0 if the FIR is disabled)           //
+// ==================================================================== //
+unsigned int                    FIR_delay_length(FIRDescriptor_t* psFIRDescriptor)
+{
+    // Double length for circular buffer simulation, but only half length for OS2
+    if(psFIRDescriptor->eType == FIR_TYPE_OS2)
+        return psFIRDescriptor->uiNCoefs;
+    return psFIRDescriptor->uiNCoefs<<1;
+}
+
+// ==================================================================== //
+// Function:        FIR_n_out_samples                                   //
+// Arguments:       FIRDescriptor_t *psFIRDescriptor: Desc. strct.      //
+//                  unsigned int uiNInSamples: Number of input samples  //
+// Return values:   Number of output samples                            //
+// Description:     Output samples of the FIR for a number of input     //
+//                  samples (as many if the FIR is disabled)            //
+// ==================================================================== //
+unsigned int                    FIR_n_out_samples(FIRDescriptor_t* psFIRDescriptor, unsigned int uiNInSamples)
+{
+    if(psFIRDescriptor->uiNCoefs == 0)
+        return uiNInSamples;
+    if(psFIRDescriptor->eType == FIR_TYPE_OS2)
+        return uiNInSamples<<1;
+    if(psFIRDescriptor->eType == FIR_TYPE_DS2)
+        return uiNInSamples>>1;
+    return uiNInSamples;
+}
+
 // ==================================================================== //
 // Function:        FIR_sync                                            //
 // Arguments:        FIRCtrl_t     *psFIRCtrl: Ctrl strct.                    //
@@ -205,7 +256,7 @@ FIRReturnCodes_t                FIR_sync(FIRCtrl_t* psFIRCtrl)
 //                    FIR_ERROR on failure                                //
 // Description:        Processes the FIR in over-sample by 2 mode            //
 // ==================================================================== //
- __attribute__((fptrgroup("MRHF_G1")))
+ MRHF_FPTRGROUP
 FIRReturnCodes_t                FIR_proc_os2(FIRCtrl_t* psFIRCtrl)
 {
     int*            piIn        = psFIRCtrl->piIn;
@@ -228,8 +279,9 @@ FIRReturnCodes_t                FIR_proc_os2(FIRCtrl_t* psFIRCtrl)
         // Get new data sample to delay line (double write for circular buffer simulation) with step
         iData[0]                    = *piIn;
         piIn                    += uiInStep;
-        // Double write to simulate circular buffer
-        *piDelayI               = iData[0];
+        // Double write to simulate circular buffer (only the second one if the delay line is mirrored)
+        if(!FIR_DELAY_MIRRORED(psFIRCtrl))
+            *piDelayI           = iData[0];
         *(piDelayI + uiDelayO)  = iData[0];
 
         // Step delay (with circular simulation)
@@ -244,8 +296,10 @@ FIRReturnCodes_t                FIR_proc_os2(FIRCtrl_t* psFIRCtrl)
         //printf("piData = %p, piCoefs = %p\n", piData, piCoefs);
 #if SRC_USE_VPU
         src_mrhf_fir_os_inner_loop_asm_xs3(piData, piCoefs, iData, uiNLoops);
+#elif !defined(__xcore__)
+        psFIRCtrl->pvInnerLoop[SRC_ISA_PARITY(piData)](piData, piCoefs, iData, uiNLoops);
 #else
-        if ((unsigned)piData & 0b0100)
+        if ((uintptr_t)piData & 0b0100)
             src_mrhf_fir_os_inner_loop_asm_odd(piData, piCoefs, iData, uiNLoops);
         else
             src_mrhf_fir_os_inner_loop_asm(piData, piCoefs, iData, uiNLoops);
@@ -261,8 +315,9 @@ FIRReturnCodes_t                FIR_proc_os2(FIRCtrl_t* psFIRCtrl)
         // Get new data sample to delay line (double write for circular buffer simulation) with step
         iData[0]                    = *piIn;
         piIn                    += uiInStep;
-        // Double write to simulate circular buffer
-        *piDelayI               = iData[0];
+        // Double write to simulate circular buffer (only the second one if the delay line is mirrored)
+        if(!FIR_DELAY_MIRRORED(psFIRCtrl))
+            *piDelayI           = iData[0];
         *(piDelayI + uiDelayO)  = iData[0];
 
         // Step delay (with circular simulation)
@@ -277,8 +332,10 @@ FIRReturnCodes_t                FIR_proc_os2(FIRCtrl_t* psFIRCtrl)
         //printf("piData = %p, piCoefs = %p\n", piData, piCoefs);
 #if SRC_USE_VPU
         src_mrhf_fir_os_inner_loop_asm_xs3(piData, piCoefs, iData, uiNLoops);
+#elif !defined(__xcore__)
+        psFIRCtrl->pvInnerLoop[SRC_ISA_PARITY(piData)](piData, piCoefs, iData, uiNLoops);
 #else
-        if ((unsigned)piData & 0b0100)
+        if ((uintptr_t)piData & 0b0100)
             src_mrhf_fir_os_inner_loop_asm_odd(piData, piCoefs, iData, uiNLoops);
         else
             src_mrhf_fir_os_inner_loop_asm(piData, piCoefs, iData, uiNLoops);
@@ -305,7 +362,7 @@ FIRReturnCodes_t                FIR_proc_os2(FIRCtrl_t* psFIRCtrl)
 //                    FIR_ERROR on failure                                //
 // Description:        Processes the FIR in asynchronous mode                //
 // ==================================================================== //
-__attribute__((fptrgroup("MRHF_G1")))
+MRHF_FPTRGROUP
 FIRReturnCodes_t                FIR_proc_sync(FIRCtrl_t* psFIRCtrl)
 {
     int*            piIn        = psFIRCtrl->piIn;
@@ -328,8 +385,9 @@ FIRReturnCodes_t                FIR_proc_sync(FIRCtrl_t* psFIRCtrl)
         // Get new data sample to delay line (double write for circular buffer simulation) with step
         iData0                    = *piIn;
         piIn                    += uiInStep;
-        // Double write to simulate circular buffer
-        *piDelayI                = iData0;
+        // Double write to simulate circular buffer (only the second one if the delay line is mirrored)
+        if(!FIR_DELAY_MIRRORED(psFIRCtrl))
+            *piDelayI            = iData0;
         *(piDelayI + uiDelayO)    = iData0;
         // Step delay (with circular simulation)
         piDelayI++;
@@ -342,8 +400,10 @@ FIRReturnCodes_t                FIR_proc_sync(FIRCtrl_t* psFIRCtrl)
 
 #if SRC_USE_VPU
         src_mrhf_fir_inner_loop_asm_xs3(piData, piCoefs, &iData0, uiNLoops);
+#elif !defined(__xcore__)
+        psFIRCtrl->pvInnerLoop[SRC_ISA_PARITY(piData)](piData, piCoefs, &iData0, uiNLoops);
 #else
-        if ((unsigned)piData & 0b0100) src_mrhf_fir_inner_loop_asm_odd(piData, piCoefs, &iData0, uiNLoops);
+        if ((uintptr_t)piData & 0b0100) src_mrhf_fir_inner_loop_asm_odd(piData, piCoefs, &iData0, uiNLoops);
         else src_mrhf_fir_inner_loop_asm(piData, piCoefs, &iData0, uiNLoops);
 #endif
 
@@ -366,7 +426,7 @@ FIRReturnCodes_t                FIR_proc_sync(FIRCtrl_t* psFIRCtrl)
 //                    FIR_ERROR on failure                                //
 // Description:        Processes the FIR in down-sample by 2 mode            //
 // ==================================================================== //
-__attribute__((fptrgroup("MRHF_G1")))
+MRHF_FPTRGROUP
 FIRReturnCodes_t                FIR_proc_ds2(FIRCtrl_t* psFIRCtrl)
 {
     int*            piIn        = psFIRCtrl->piIn;
@@ -391,9 +451,12 @@ FIRReturnCodes_t                FIR_proc_ds2(FIRCtrl_t* psFIRCtrl)
         piIn                    += uiInStep;
         iData1                    = *piIn;
         piIn                    += uiInStep;
-        // Double write to simulate circular buffer with DUAL store instruction
-        *piDelayI                = iData0;
-        *(piDelayI + 1)            = iData1;
+        // Double write to simulate circular buffer with DUAL store instruction (only the second one if the delay line is mirrored)
+        if(!FIR_DELAY_MIRRORED(psFIRCtrl))
+        {
+            *piDelayI            = iData0;
+            *(piDelayI + 1)        = iData1;
+        }
         *(piDelayI + uiDelayO)    = iData0;
         *(piDelayI + uiDelayO + 1)    = iData1;
         // Step delay with circular simulation
@@ -406,8 +469,10 @@ FIRReturnCodes_t                FIR_proc_ds2(FIRCtrl_t* psFIRCtrl)
         piCoefs                    = piCoefsB;
 #if SRC_USE_VPU
         src_mrhf_fir_inner_loop_asm_xs3(piData, piCoefs, &iData0, uiNLoops);
+#elif !defined(__xcore__)
+        psFIRCtrl->pvInnerLoop[SRC_ISA_PARITY(piData)](piData, piCoefs, &iData0, uiNLoops);
 #else
-        if ((unsigned)piData & 0b0100) src_mrhf_fir_inner_loop_asm_odd(piData, piCoefs, &iData0, uiNLoops);
+        if ((uintptr_t)piData & 0b0100) src_mrhf_fir_inner_loop_asm_odd(piData, piCoefs, &iData0, uiNLoops);
         else src_mrhf_fir_inner_loop_asm(piData, piCoefs, &iData0, uiNLoops);
 #endif
         // Write output with step
@@ -422,6 +487,19 @@ FIRReturnCodes_t                FIR_proc_ds2(FIRCtrl_t* psFIRCtrl)
 }
 
 
+// ==================================================================== //
+// Function:        ADFIR_delay_length                                  //
+// Arguments:       ADFIRDescriptor_t *psADFIRDescriptor: Desc. strct.  //
+// Return values:   Length of the delay line in words                   //
+// Description:     Delay line length ADFIR_init_from_desc sets up for  //
+//                  the Descriptor                                      //
+// ==================================================================== //
+unsigned int                    ADFIR_delay_length(ADFIRDescriptor_t* psADFIRDescriptor)
+{
+    // Double length for circular buffer simulation
+    return psADFIRDescriptor->uiNCoefsPerPhase<<1;
+}
+
 // ==================================================================== //
 // Function:        ADFIR_init_from_desc                                //
 // Arguments:        ADFIRCtrl_t     *psADFIRCtrl: Ctrl strct.            //
@@ -434,6 +512,10 @@ FIRReturnCodes_t                ADFIR_init_from_desc(ADFIRCtrl_t* psADFIRCtrl, A
 {
     unsigned int        uiPhaseLength;
 
+#ifndef __xcore__
+    release_delay(&psADFIRCtrl->piDelayB, psADFIRCtrl->uiDelayL, psADFIRCtrl->piDelayW, &psADFIRCtrl->piDelayM);
+#endif
+
     // Check that delay line base has been set
     if(psADFIRCtrl->piDelayB == 0)
         return FIR_ERROR;
@@ -454,6 +536,9 @@ FIRReturnCodes_t                ADFIR_init_from_desc(ADFIRCtrl_t* psADFIRCtrl, A
     psADFIRCtrl->piDelayW            = psADFIRCtrl->piDelayB + uiPhaseLength;
     psADFIRCtrl->uiDelayO            = uiPhaseLength;
     psADFIRCtrl->uiNLoops            = uiPhaseLength>>1;                    // Due to 2 x 32bits read for data and coefs per inner loop
+#ifndef __xcore__
+    src_isa_get_kernels(SRC_KERNEL_ADFIR, psADFIRCtrl->pvInnerLoop);
+#endif
 
     // Sync the ADFIR
     if(ADFIR_sync(psADFIRCtrl) != FIR_NO_ERROR)
@@ -492,8 +577,9 @@ FIRReturnCodes_t                ADFIR_sync(ADFIRCtrl_t* psADFIRCtrl)
 // ==================================================================== //
 FIRReturnCodes_t                ADFIR_proc_in_spl(ADFIRCtrl_t* psADFIRCtrl)
 {
-    // Double write to simulate circular buffer
-    *psADFIRCtrl->piDelayI                                    = psADFIRCtrl->iIn;
+    // Double write to simulate circular buffer (only the second one if the delay line is mirrored)
+    if(!FIR_DELAY_MIRRORED(psADFIRCtrl))
+        *psADFIRCtrl->piDelayI                                = psADFIRCtrl->iIn;
     *(psADFIRCtrl->piDelayI + psADFIRCtrl->uiDelayO)        = psADFIRCtrl->iIn;
     // Step delay (with circular simulation)
     psADFIRCtrl->piDelayI++;
@@ -523,8 +609,12 @@ FIRReturnCodes_t                ADFIR_proc_macc(ADFIRCtrl_t* psADFIRCtrl)
     // Clear accumulator and set access pointers
     piData                    = psADFIRCtrl->piDelayI;
     piCoefs                    = psADFIRCtrl->piADCoefs;
-    if ((unsigned)piData & 0b0100) src_mrhf_adfir_inner_loop_asm_odd(piData, piCoefs, &iData, psADFIRCtrl->uiNLoops);
+#ifndef __xcore__
+    psADFIRCtrl->pvInnerLoop[SRC_ISA_PARITY(piData)](piData, piCoefs, &iData, psADFIRCtrl->uiNLoops);
+#else
+    if ((uintptr_t)piData & 0b0100) src_mrhf_adfir_inner_loop_asm_odd(piData, piCoefs, &iData, psADFIRCtrl->uiNLoops);
     else                               src_mrhf_adfir_inner_loop_asm(piData, piCoefs, &iData, psADFIRCtrl->uiNLoops);
+#endif
 
     // Write output
     *(psADFIRCtrl->piOut)        = iData;
@@ -533,6 +623,21 @@ FIRReturnCodes_t                ADFIR_proc_macc(ADFIRCtrl_t* psADFIRCtrl)
 }
 
 
+// ==================================================================== //
+// Function:        PPFIR_delay_length                                  //
+// Arguments:       PPFIRDescriptor_t *psPPFIRDescriptor: Desc. strct.  //
+// Return values:   Length of the delay line in words                   //
+// Description:     Delay line length PPFIR_init_from_desc sets up for  //
+//                  the Descriptor (0 if the PPFIR is disabled)         //
+// ==================================================================== //
+unsigned int                    PPFIR_delay_length(PPFIRDescriptor_t* psPPFIRDescriptor)
+{
+    if(psPPFIRDescriptor->uiNCoefs == 0)
+        return 0;
+    // Double length of a phase for circular buffer simulation
+    return (psPPFIRDescriptor->uiNCoefs / psPPFIRDescriptor->uiNPhases)<<1;
+}
+
 // ==================================================================== //
 // Function:        PPFIR_init_from_desc                                //
 // Arguments:        PPFIRCtrl_t     *psPPFIRCtrl: Ctrl strct.            //
@@ -545,6 +650,10 @@ FIRReturnCodes_t                PPFIR_init_from_desc(PPFIRCtrl_t* psPPFIRCtrl, P
 {
     unsigned int        uiPhaseLength;
 
+#ifndef __xcore__
+    release_delay(&psPPFIRCtrl->piDelayB, psPPFIRCtrl->uiDelayL, psPPFIRCtrl->piDelayW, &psPPFIRCtrl->piDelayM);
+#endif
+
     // Check if PPFIR is disabled (this is given by the number of coefficients being zero)
     if( psPPFIRDescriptor->uiNCoefs == 0)
     {
@@ -601,6 +710,9 @@ FIRReturnCodes_t                PPFIR_init_from_desc(PPFIRCtrl_t* psPPFIRCtrl, P
     psPPFIRCtrl->piCoefs            = psPPFIRDescriptor->piCoefs;
     psPPFIRCtrl->uiNPhases            = psPPFIRDescriptor->uiNPhases;
     psPPFIRCtrl->uiCoefsPhaseStep    = psPPFIRCtrl->uiPhaseStep * uiPhaseLength;            // Length (number of coefs) of a phase step
+#ifndef __xcore__
+    src_isa_get_kernels(SRC_KERNEL_FIR, psPPFIRCtrl->pvInnerLoop);
+#endif
 
     // Sync the PPFIR
     if(PPFIR_sync(psPPFIRCtrl) != FIR_NO_ERROR)
@@ -676,8 +788,9 @@ FIRReturnCodes_t                PPFIR_proc(PPFIRCtrl_t* psPPFIRCtrl)
         // Get new data sample to delay line (double write for circular buffer simulation) with step
         iData[0]                    = *piIn;
         piIn                    += uiInStep;
-        // Double write to simulate circular buffer
-        *piDelayI                = iData[0];
+        // Double write to simulate circular buffer (only the second one if the delay line is mirrored)
+        if(!FIR_DELAY_MIRRORED(psPPFIRCtrl))
+            *piDelayI            = iData[0];
         *(piDelayI + uiDelayO)    = iData[0];
         // Step delay (with circular simulation)
         piDelayI++;
@@ -693,8 +806,12 @@ FIRReturnCodes_t                PPFIR_proc(PPFIRCtrl_t* psPPFIRCtrl)
             piData                    = piDelayI;
             piCoefs                    = piCoefsB + uiCoefsPhase;
 
-            if ((unsigned)piData & 0b0100) src_mrhf_fir_inner_loop_asm_odd(piData, piCoefs, iData, uiNLoops);
+#ifndef __xcore__
+            psPPFIRCtrl->pvInnerLoop[SRC_ISA_PARITY(piData)](piData, piCoefs, iData, uiNLoops);
+#else
+            if ((uintptr_t)piData & 0b0100) src_mrhf_fir_inner_loop_asm_odd(piData, piCoefs, iData, uiNLoops);
             else src_mrhf_fir_inner_loop_asm(piData, piCoefs, iData, uiNLoops);
+#endif
 
 
             // Write output with step
@@ -721,3 +838,93 @@ FIRReturnCodes_t                PPFIR_proc(PPFIRCtrl_t* psPPFIRCtrl)
 
     return FIR_NO_ERROR;
 }
+
+#ifndef __xcore__
+// Moves a double write delay line to a mirrored ring: the ring length replaces the wrap,
+// uiDelayO stays the offset of the one write that is left
+static FIRReturnCodes_t         mirror_delay(int** ppiDelayB, unsigned int* puiDelayL, int** ppiDelayI, int** ppiDelayW, unsigned int uiDelayO, int** ppiDelayM)
+{
+    unsigned int        uiLength;
+    int*                piRing;
+
+    if(*ppiDelayM != 0)
+        return FIR_NO_ERROR;
+
+    piRing              = src_mirror_delay_line(*ppiDelayI, uiDelayO, &uiLength);
+    if(piRing == 0)
+        return FIR_ERROR;
+
+    *ppiDelayM          = *ppiDelayB;
+    *ppiDelayB          = piRing;
+    *puiDelayL          = uiLength;
+    *ppiDelayI          = piRing;
+    *ppiDelayW          = piRing + uiLength;
+
+    return FIR_NO_ERROR;
+}
+
+// Unmaps the ring a delay line was left with by mirror_delay, and points the base back at the
+// delay line it replaced if it is still the ring. The wrap of a mirrored ring is at its end
+static void                     release_delay(int** ppiDelayB, unsigned int uiDelayL, int* piDelayW, int** ppiDelayM)
+{
+    int*                piRing;
+
+    if(*ppiDelayM != 0)
+    {
+        piRing          = (int*)((uintptr_t)piDelayW - (uintptr_t)uiDelayL * sizeof(int));
+        if(src_mirror_release(piRing) && (*ppiDelayB == piRing))
+            *ppiDelayB  = *ppiDelayM;
+    }
+    *ppiDelayM          = 0;
+}
+
+static void                     unmirror_delay(int** ppiDelayB, unsigned int* puiDelayL, int** ppiDelayI, int** ppiDelayW, unsigned int uiDelayO, int** ppiDelayM)
+{
+    if(*ppiDelayM == 0)
+        return;
+
+    src_unmirror_delay_line(*ppiDelayB, *puiDelayL, *ppiDelayI, uiDelayO, *ppiDelayM);
+
+    *ppiDelayB          = *ppiDelayM;
+    *puiDelayL          = uiDelayO<<1;
+    *ppiDelayI          = *ppiDelayM;
+    *ppiDelayW          = *ppiDelayM + uiDelayO;
+    *ppiDelayM          = 0;
+}
+
+FIRReturnCodes_t                FIR_mirror(FIRCtrl_t* psFIRCtrl)
+{
+    if(psFIRCtrl->eEnable != FIR_ON)
+        return FIR_NO_ERROR;
+
+    return mirror_delay(&psFIRCtrl->piDelayB, &psFIRCtrl->uiDelayL, &psFIRCtrl->piDelayI, &psFIRCtrl->piDelayW, psFIRCtrl->uiDelayO, &psFIRCtrl->piDelayM);
+}
+
+FIRReturnCodes_t                ADFIR_mirror(ADFIRCtrl_t* psADFIRCtrl)
+{
+    return mirror_delay(&psADFIRCtrl->piDelayB, &psADFIRCtrl->uiDelayL, &psADFIRCtrl->piDelayI, &psADFIRCtrl->piDelayW, psADFIRCtrl->uiDelayO, &psADFIRCtrl->piDelayM);
+}
+
+FIRReturnCodes_t                PPFIR_mirror(PPFIRCtrl_t* psPPFIRCtrl)
+{
+    if(psPPFIRCtrl->eEnable != FIR_ON)
+        return FIR_NO_ERROR;
+
+    return mirror_delay(&psPPFIRCtrl->piDelayB, &psPPFIRCtrl->uiDelayL, &psPPFIRCtrl->piDelayI, &psPPFIRCtrl->piDelayW, psPPFIRCtrl->uiDelayO, &psPPFIRCtrl->piDelayM);
+}
+
+void                            FIR_unmirror(FIRCtrl_t* psFIRCtrl)
+{
+    unmirror_delay(&psFIRCtrl->piDelayB, &psFIRCtrl->uiDelayL, &psFIRCtrl->piDelayI, &psFIRCtrl->piDelayW, psFIRCtrl->uiDelayO, &psFIRCtrl->piDelayM);
+}
+
+void                            ADFIR_unmirror(ADFIRCtrl_t* psADFIRCtrl)
+{
+    unmirror_delay(&psADFIRCtrl->piDelayB, &psADFIRCtrl->uiDelayL, &psADFIRCtrl->piDelayI, &psADFIRCtrl->piDelayW, psADFIRCtrl->uiDelayO, &psADFIRCtrl->piDelayM);
+}
+
+void                            PPFIR_unmirror(PPFIRCtrl_t* psPPFIRCtrl)
+{
+    unmirror_delay(&psPPFIRCtrl->piDelayB, &psPPFIRCtrl->uiDelayL, &psPPFIRCtrl->piDelayI, &psPPFIRCtrl->piDelayW, psPPFIRCtrl->uiDelayO, &psPPFIRCtrl->piDelayM);
+}
+#endif
@@ -26,6 +26,27 @@
 /// (on xcore) Force variable to double word alignment
 #ifndef DWORD_ALIGNED
 #  define DWORD_ALIGNED  ALIGNMENT(8)
+#endif
+
+/// (on host) Kernel tables for the inner loops
+#ifndef __xcore__
+#  include "src_mrhf_isa.h"
+#endif
+
+/// (on host) A mirrored delay line only takes the second of the two writes, see src_mrhf_mirror.h
+#ifndef __xcore__
+#  define FIR_DELAY_MIRRORED(psCtrl)   ((psCtrl)->piDelayM != 0)
+#else
+#  define FIR_DELAY_MIRRORED(psCtrl)   0
+#endif
+
+/// (on xcore) Annotate the FIR processing function pointer group for stack analysis
+#ifndef MRHF_FPTRGROUP
+#  ifdef __xcore__
+#    define MRHF_FPTRGROUP  __attribute__((fptrgroup("MRHF_G1")))
+#  else
+#    define MRHF_FPTRGROUP
+#  endif
 #endif
     // ===========================================================================
     //
@@ -211,7 +232,7 @@
             unsigned int                            uiNOutSamples;    // Number of output samples produced
             unsigned int                            uiOutStep;        // Step between output data samples
 
-__attribute__((fptrgroup("MRHF_G1")))
+MRHF_FPTRGROUP
             FIRReturnCodes_t                         (*pvProc)(int *);// Processing function address
 
             int*                                    piDelayB;        // Pointer to delay line base
@@ -223,6 +244,10 @@ __attribute__((fptrgroup("MRHF_G1")))
             unsigned int                            uiNLoops;        // Number of inner loop iterations
             unsigned int                            uiNCoefs;        // Number of coefficients
             int*                                    piCoefs;        // Pointer to coefficients
+#ifndef __xcore__
+            SRCInnerLoop_t                          pvInnerLoop[2];    // Host inner loops by delay line alignment parity, selected at init
+            int*                                    piDelayM;        // Delay line base before FIR_mirror(), 0 if the delay line is not mirrored
+#endif
         } FIRCtrl_t;
 
         // ADFIR Descriptor
@@ -249,6 +274,10 @@ __attribute__((fptrgroup("MRHF_G1")))
 
             unsigned int                            uiNLoops;            // Number of inner loop iterations
             int*                                    piADCoefs;            // Pointer to adaptive coefficients
+#ifndef __xcore__
+            SRCInnerLoop_t                          pvInnerLoop[2];        // Host inner loops by delay line alignment parity, selected at init
+            int*                                    piDelayM;            // Delay line base before ADFIR_mirror(), 0 if the delay line is not mirrored
+#endif
         } ADFIRCtrl_t;
 
 
@@ -288,6 +317,10 @@ __attribute__((fptrgroup("MRHF_G1")))
             unsigned int                            uiCoefsPhaseStep;    // Number of coefficients for a phase step
             unsigned int                            uiCoefsPhase;        // Current phase coefficient offset from base
 
+#ifndef __xcore__
+            SRCInnerLoop_t                          pvInnerLoop[2];        // Host inner loops by delay line alignment parity, selected at init
+            int*                                    piDelayM;            // Delay line base before PPFIR_mirror(), 0 if the delay line is not mirrored
+#endif
         } PPFIRCtrl_t;
 #endif
 
@@ -307,6 +340,25 @@ __attribute__((fptrgroup("MRHF_G1")))
         // ==================================================================== //
         FIRReturnCodes_t                FIR_init_from_desc(FIRCtrl_t* psFIRCtrl, FIRDescriptor_t* psFIRDescriptor);
 
+        // ==================================================================== //
+        // Function:        FIR_delay_length                                    //
+        // Arguments:       FIRDescriptor_t *psFIRDescriptor: Desc. strct.      //
+        // Return values:   Length of the delay line in words                   //
+        // Description:     Delay line length FIR_init_from_desc sets up for    //
+        //                  the Descriptor (0 if the FIR is disabled)           //
+        // ==================================================================== //
+        unsigned int                    FIR_delay_length(FIRDescriptor_t* psFIRDescriptor);
+
+        // ==================================================================== //
+        // Function:        FIR_n_out_samples                                   //
+        // Arguments:       FIRDescriptor_t *psFIRDescriptor: Desc. strct.      //
+        //                  unsigned int uiNInSamples: Number of input samples  //
+        // Return values:   Number of output samples                            //
+        // Description:     Output samples of the FIR for a number of input     //
+        //                  samples (as many if the FIR is disabled)            //
+        // ==================================================================== //
+        unsigned int                    FIR_n_out_samples(FIRDescriptor_t* psFIRDescriptor, unsigned int uiNInSamples);
+
         // ==================================================================== //
         // Function:        FIR_sync                                            //
         // Arguments:        FIRCtrl_t     *psFIRCtrl: Ctrl strct.                    //
@@ -353,6 +405,15 @@ __attribute__((fptrgroup("MRHF_G1")))
         // ==================================================================== //
         FIRReturnCodes_t                ADFIR_init_from_desc(ADFIRCtrl_t* psADFIRCtrl, ADFIRDescriptor_t* psADFIRDescriptor);
 
+        // ==================================================================== //
+        // Function:        ADFIR_delay_length                                  //
+        // Arguments:       ADFIRDescriptor_t *psADFIRDescriptor: Desc. strct.  //
+        // Return values:   Length of the delay line in words                   //
+        // Description:     Delay line length ADFIR_init_from_desc sets up for  //
+        //                  the Descriptor                                      //
+        // ==================================================================== //
+        unsigned int                    ADFIR_delay_length(ADFIRDescriptor_t* psADFIRDescriptor);
+
         // ==================================================================== //
         // Function:        ADFIR_snyc                                            //
         // Arguments:        ADFIRCtrl_t     *psADFIRCtrl: Ctrl strct.            //
@@ -390,6 +451,15 @@ __attribute__((fptrgroup("MRHF_G1")))
         // ==================================================================== //
         FIRReturnCodes_t                PPFIR_init_from_desc(PPFIRCtrl_t* psPPFIRCtrl, PPFIRDescriptor_t* psPPFIRDescriptor);
 
+        // ==================================================================== //
+        // Function:        PPFIR_delay_length                                  //
+        // Arguments:       PPFIRDescriptor_t *psPPFIRDescriptor: Desc. strct.  //
+        // Return values:   Length of the delay line in words                   //
+        // Description:     Delay line length PPFIR_init_from_desc sets up for  //
+        //                  the Descriptor (0 if the PPFIR is disabled)         //
+        // ==================================================================== //
+        unsigned int                    PPFIR_delay_length(PPFIRDescriptor_t* psPPFIRDescriptor);
+
         // ==================================================================== //
         // Function:        PPFIR_snyc                                            //
         // Arguments:        PPFIRCtrl_t     *psPPFIRCtrl: Ctrl strct.            //
@@ -407,6 +477,34 @@ __attribute__((fptrgroup("MRHF_G1")))
         // Description:        Processes the PPFIR polyphase filter                 //
         // ==================================================================== //
         FIRReturnCodes_t                PPFIR_proc(PPFIRCtrl_t* psPPFIRCtrl);
+
+#ifndef __xcore__
+        // ==================================================================== //
+        // Function:        FIR_mirror, ADFIR_mirror, PPFIR_mirror              //
+        // Arguments:        xCtrl_t     *psCtrl: Ctrl strct.                    //
+        // Return values:    FIR_NO_ERROR on success, or if the filter is off   //
+        //                    or already mirrored                                //
+        //                    FIR_ERROR if mirrored mappings are not available,  //
+        //                    the filter is then unchanged                       //
+        // Description:        Moves the delay line to a mirrored ring, keeping  //
+        //                    its state (host only)                             //
+        // ==================================================================== //
+        FIRReturnCodes_t                FIR_mirror(FIRCtrl_t* psFIRCtrl);
+        FIRReturnCodes_t                ADFIR_mirror(ADFIRCtrl_t* psADFIRCtrl);
+        FIRReturnCodes_t                PPFIR_mirror(PPFIRCtrl_t* psPPFIRCtrl);
+
+        // ==================================================================== //
+        // Function:        FIR_unmirror, ADFIR_unmirror, PPFIR_unmirror        //
+        // Arguments:        xCtrl_t     *psCtrl: Ctrl strct.                    //
+        // Return values:    None                                                //
+        // Description:        Moves the delay line back to its double write     //
+        //                    buffer, keeping its state, and unmaps the ring.   //
+        //                    Does nothing if it is not mirrored (host only)    //
+        // ==================================================================== //
+        void                            FIR_unmirror(FIRCtrl_t* psFIRCtrl);
+        void                            ADFIR_unmirror(ADFIRCtrl_t* psADFIRCtrl);
+        void                            PPFIR_unmirror(PPFIRCtrl_t* psPPFIRCtrl);
+#endif
     #endif // nINCLUDE_FROM_ASM
 
 #endif // _SRC_MRHF_FIR_H
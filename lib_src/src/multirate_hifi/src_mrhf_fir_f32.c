@@ -0,0 +1,711 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Float32 FIR functions implementation file for the host float32 ASRC and
+// SSRC. The processing functions follow FIR_proc_os2, FIR_proc_sync,
+// FIR_proc_ds2 and PPFIR_proc sample for sample, on float32 copies of the
+// coefficient tables built on first use.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+// ===========================================================================
+//
+// Includes
+//
+// ===========================================================================
+#include <stdatomic.h>
+
+#include "src_mrhf_fir_f32.h"
+
+// ===========================================================================
+//
+// Defines
+//
+// ===========================================================================
+
+// State init value
+#define        FIR_F32_STATE_INIT                   0.0f
+
+// Scale of the Q1.31 coefficients
+#define        FIR_F32_Q31                          (1.0f / 2147483648.0f)
+
+// Float32 kernels need tap counts that are multiples of this
+#define        FIR_F32_TAPS_MULTIPLE                8
+
+// States of the coefficient tables
+#define        FIR_F32_COEFS_NONE                   0
+#define        FIR_F32_COEFS_BUSY                   1
+#define        FIR_F32_COEFS_READY                  2
+
+
+// ===========================================================================
+//
+// Variables
+//
+// ===========================================================================
+
+// Float32 copies of the coefficient tables (OS2 tables in two halves, see FIR_f32_coefs)
+static float                fFirBLCoefs[FILTER_DEFS_FIR_BL_N_TAPS]                  __attribute__((aligned(32)));
+static float                fFirBL9644Coefs[FILTER_DEFS_FIR_BL9644_N_TAPS]          __attribute__((aligned(32)));
+static float                fFirBL8848[FILTER_DEFS_FIR_BL8848_N_TAPS]               __attribute__((aligned(32)));
+static float                fFirBLFCoefs[FILTER_DEFS_FIR_BLF_N_TAPS]                __attribute__((aligned(32)));
+static float                fFirBL19288Coefs[FILTER_DEFS_FIR_BL19288_N_TAPS]        __attribute__((aligned(32)));
+static float                fFirBL17696[FILTER_DEFS_FIR_BL17696_N_TAPS]             __attribute__((aligned(32)));
+static float                fFirUPCoefs[FILTER_DEFS_FIR_UP_N_TAPS]                  __attribute__((aligned(32)));
+static float                fFirUP4844Coefs[FILTER_DEFS_FIR_UP4844_N_TAPS]          __attribute__((aligned(32)));
+static float                fFirUPFCoefs[FILTER_DEFS_FIR_UPF_N_TAPS]                __attribute__((aligned(32)));
+static float                fFirUP192176Coefs[FILTER_DEFS_FIR_UP192176_N_TAPS]      __attribute__((aligned(32)));
+static float                fFirDSCoefs[FILTER_DEFS_FIR_DS_N_TAPS]                  __attribute__((aligned(32)));
+static float                fFirOSCoefs[FILTER_DEFS_FIR_OS_N_TAPS]                  __attribute__((aligned(32)));
+static float                fPPFirHS294Coefs[FILTER_DEFS_PPFIR_HS294_N_TAPS]        __attribute__((aligned(32)));
+static float                fPPFirHS320Coefs[FILTER_DEFS_PPFIR_HS320_N_TAPS]        __attribute__((aligned(32)));
+static float                fADFirCoefs[FILTER_DEFS_ADFIR_N_PHASES + 2][FILTER_DEFS_ADFIR_PHASE_N_TAPS]   __attribute__((aligned(32)));
+
+static const struct
+{
+    int*                    piCoefs;            // Q1.31 coefficients
+    unsigned int            uiNCoefs;           // Number of coefficients
+    unsigned int            uiOS2;              // Non zero for an OS2 table
+    float*                  pfCoefs;            // Float32 copy
+} sFirF32Tables[] =
+{
+    {iFirBLCoefs,           FILTER_DEFS_FIR_BL_N_TAPS,          0,  fFirBLCoefs},
+    {iFirBL9644Coefs,       FILTER_DEFS_FIR_BL9644_N_TAPS,      0,  fFirBL9644Coefs},
+    {iFirBL8848,            FILTER_DEFS_FIR_BL8848_N_TAPS,      0,  fFirBL8848},
+    {iFirBLFCoefs,          FILTER_DEFS_FIR_BLF_N_TAPS,         0,  fFirBLFCoefs},
+    {iFirBL19288Coefs,      FILTER_DEFS_FIR_BL19288_N_TAPS,     0,  fFirBL19288Coefs},
+    {iFirBL17696,           FILTER_DEFS_FIR_BL17696_N_TAPS,     0,  fFirBL17696},
+    {iFirUPCoefs,           FILTER_DEFS_FIR_UP_N_TAPS,          1,  fFirUPCoefs},
+    {iFirUP4844Coefs,       FILTER_DEFS_FIR_UP4844_N_TAPS,      1,  fFirUP4844Coefs},
+    {iFirUPFCoefs,          FILTER_DEFS_FIR_UPF_N_TAPS,         1,  fFirUPFCoefs},
+    {iFirUP192176Coefs,     FILTER_DEFS_FIR_UP192176_N_TAPS,    1,  fFirUP192176Coefs},
+    {iFirDSCoefs,           FILTER_DEFS_FIR_DS_N_TAPS,          0,  fFirDSCoefs},
+    {iFirOSCoefs,           FILTER_DEFS_FIR_OS_N_TAPS,          1,  fFirOSCoefs},
+    {iPPFirHS294Coefs,      FILTER_DEFS_PPFIR_HS294_N_TAPS,     0,  fPPFirHS294Coefs},
+    {iPPFirHS320Coefs,      FILTER_DEFS_PPFIR_HS320_N_TAPS,     0,  fPPFirHS320Coefs},
+};
+#define        FIR_F32_N_TABLES                     (sizeof(sFirF32Tables) / sizeof(sFirF32Tables[0]))
+
+static atomic_int           iFirF32CoefsState   = FIR_F32_COEFS_NONE;
+
+
+// ===========================================================================
+//
+// Local Functions prototypes
+//
+// ===========================================================================
+
+static void                 FIR_f32_build_coefs(void);
+static void                 FIR_f32_prepare_coefs(void);
+
+
+// ===========================================================================
+//
+// Functions implementations
+//
+// ===========================================================================
+
+// ==================================================================== //
+// Function:        FIR_f32_build_coefs                                 //
+// Arguments:       None                                                //
+// Return values:   None                                                //
+// Description:     Converts all tables. The OS2 kernel gives the first //
+//                  output from the odd coefficients, see               //
+//                  src_mrhf_fir_os_inner_loop.c, so these come first.  //
+//                  The ADFIR phases are taken from the prototype as    //
+//                  src_mrhf_adfir_phases_generator.py does             //
+// ==================================================================== //
+static void                 FIR_f32_build_coefs(void)
+{
+    unsigned int        ui, uj;
+    int                 iIndex;
+
+    for(ui = 0; ui < FIR_F32_N_TABLES; ui++)
+    {
+        int*            piCoefs     = sFirF32Tables[ui].piCoefs;
+        float*          pfCoefs     = sFirF32Tables[ui].pfCoefs;
+        unsigned int    uiNCoefs    = sFirF32Tables[ui].uiNCoefs;
+
+        if(sFirF32Tables[ui].uiOS2)
+        {
+            for(uj = 0; uj < (uiNCoefs>>1); uj++)
+            {
+                pfCoefs[uj]                     = (float)piCoefs[2 * uj + 1] * FIR_F32_Q31;
+                pfCoefs[(uiNCoefs>>1) + uj]     = (float)piCoefs[2 * uj] * FIR_F32_Q31;
+            }
+        }
+        else
+        {
+            for(uj = 0; uj < uiNCoefs; uj++)
+                pfCoefs[uj]                     = (float)piCoefs[uj] * FIR_F32_Q31;
+        }
+    }
+
+    // Tap uj of phase ui, zero where it falls outside the prototype (last tap of the normal
+    // phases, first tap of the two delayed ones)
+    for(ui = 0; ui < FILTER_DEFS_ADFIR_N_PHASES + 2; ui++)
+        for(uj = 0; uj < FILTER_DEFS_ADFIR_PHASE_N_TAPS; uj++)
+        {
+            iIndex      = FILTER_DEFS_ADFIR_PROTOTYPE_N_TAPS - FILTER_DEFS_ADFIR_N_PHASES + (int)ui - (int)uj * FILTER_DEFS_ADFIR_N_PHASES;
+            fADFirCoefs[ui][uj]     = ((iIndex >= 0) && (iIndex < FILTER_DEFS_ADFIR_PROTOTYPE_N_TAPS)) ?
+                                        (float)iADFirPrototypeCoefs[iIndex] * FIR_F32_Q31 : 0.0f;
+        }
+}
+
+// ==================================================================== //
+// Function:        FIR_f32_prepare_coefs                               //
+// Arguments:       None                                                //
+// Return values:   None                                                //
+// Description:     Builds the tables once. Other threads wait for the  //
+//                  one that builds them                                //
+// ==================================================================== //
+static void                 FIR_f32_prepare_coefs(void)
+{
+    int                 iState      = FIR_F32_COEFS_NONE;
+
+    if(atomic_load_explicit(&iFirF32CoefsState, memory_order_acquire) == FIR_F32_COEFS_READY)
+        return;
+
+    if(atomic_compare_exchange_strong_explicit(&iFirF32CoefsState, &iState, FIR_F32_COEFS_BUSY,
+                                               memory_order_acquire, memory_order_acquire))
+    {
+        FIR_f32_build_coefs();
+        atomic_store_explicit(&iFirF32CoefsState, FIR_F32_COEFS_READY, memory_order_release);
+        return;
+    }
+
+    while(atomic_load_explicit(&iFirF32CoefsState, memory_order_acquire) != FIR_F32_COEFS_READY)
+        ;
+}
+
+// ==================================================================== //
+// Function:        FIR_f32_coefs                                       //
+// Arguments:       int *piCoefs: Coefficients of a FIR or PPFIR        //
+//                                descriptor                            //
+// Return values:   Their float32 copy, 0 if they are not known         //
+// Description:     Builds the copies of all tables on first use        //
+// ==================================================================== //
+float*                      FIR_f32_coefs(int* piCoefs)
+{
+    unsigned int        ui;
+
+    FIR_f32_prepare_coefs();
+    for(ui = 0; ui < FIR_F32_N_TABLES; ui++)
+        if(sFirF32Tables[ui].piCoefs == piCoefs)
+            return sFirF32Tables[ui].pfCoefs;
+    return 0;
+}
+
+// ==================================================================== //
+// Function:        ADFIR_f32_coefs                                     //
+// Arguments:       None                                                //
+// Return values:   Float32 ADFIR phase table                           //
+// Description:     Builds the copies of all tables on first use        //
+// ==================================================================== //
+float*                      ADFIR_f32_coefs(void)
+{
+    FIR_f32_prepare_coefs();
+    return &fADFirCoefs[0][0];
+}
+
+// ==================================================================== //
+// Function:        FIR_f32_init_from_desc                              //
+// Arguments:       FIRCtrlF32_t *psFIRCtrl: Ctrl strct.                //
+//                  FIRDescriptor_t *psFIRDescriptor: Desc. strct.      //
+// Return values:   FIR_NO_ERROR on success                             //
+//                  FIR_ERROR on failure                                //
+// Description:     Inits the FIR from the Descriptor                   //
+// ==================================================================== //
+FIRReturnCodes_t            FIR_f32_init_from_desc(FIRCtrlF32_t* psFIRCtrl, FIRDescriptor_t* psFIRDescriptor)
+{
+    // A disabled FIR has no coefficients to look up
+    return FIR_f32_init_from_coefs(psFIRCtrl, psFIRDescriptor, (psFIRDescriptor->uiNCoefs != 0) ? FIR_f32_coefs(psFIRDescriptor->piCoefs) : 0);
+}
+
+// ==================================================================== //
+// Function:        FIR_f32_init_from_coefs                             //
+// Arguments:       FIRCtrlF32_t *psFIRCtrl: Ctrl strct.                //
+//                  FIRDescriptor_t *psFIRDescriptor: Desc. strct.      //
+//                  float *pfCoefs: Float32 coefficients                //
+// Return values:   FIR_NO_ERROR on success                             //
+//                  FIR_ERROR on failure                                //
+// Description:     Inits the FIR from the Descriptor, with its         //
+//                  coefficients given in float32                       //
+// ==================================================================== //
+FIRReturnCodes_t            FIR_f32_init_from_coefs(FIRCtrlF32_t* psFIRCtrl, FIRDescriptor_t* psFIRDescriptor, float* pfCoefs)
+{
+    SRCKernelsF32_t     sKernels;
+
+    // Check if FIR is disabled (this is given by the number of coefficients being zero)
+    if(psFIRDescriptor->uiNCoefs == 0)
+    {
+        psFIRCtrl->eEnable          = FIR_OFF;
+        psFIRCtrl->uiNOutSamples    = 0;
+        psFIRCtrl->pvProc           = 0;
+        psFIRCtrl->uiDelayL         = 0;
+        psFIRCtrl->pfDelayW         = 0;
+        psFIRCtrl->uiDelayO         = 0;
+        psFIRCtrl->uiNTaps          = 0;
+        psFIRCtrl->pfCoefs          = 0;
+
+        return FIR_NO_ERROR;
+    }
+
+    // Check that delay line base has been set
+    if(psFIRCtrl->pfDelayB == 0)
+        return FIR_ERROR;
+
+    // Check that number of samples has been set and is a multiple of 2
+    if(psFIRCtrl->uiNInSamples == 0)
+        return FIR_ERROR;
+    if((psFIRCtrl->uiNInSamples & 0x1) != 0x0)
+        return FIR_ERROR;
+
+    // Check the input and output samples steps have been set
+    if(psFIRCtrl->uiInStep == 0)
+        return FIR_ERROR;
+    if(psFIRCtrl->uiOutStep == 0)
+        return FIR_ERROR;
+
+    // Set the float32 coefficients
+    psFIRCtrl->pfCoefs              = pfCoefs;
+    if(psFIRCtrl->pfCoefs == 0)
+        return FIR_ERROR;
+
+    // Setup depending on FIR descriptor
+    switch(psFIRDescriptor->eType)
+    {
+        // Over-sampler by 2 type
+        case FIR_TYPE_OS2:
+            psFIRCtrl->uiNOutSamples    = (psFIRCtrl->uiNInSamples)<<1;                     // Os2 FIR doubles the number of samples
+            psFIRCtrl->pvProc           = FIR_f32_proc_os2;
+            psFIRCtrl->uiNTaps          = psFIRDescriptor->uiNCoefs>>1;                     // Each output takes half of the coefficients
+        break;
+
+        // Asynchronous type
+        case FIR_TYPE_SYNC:
+            psFIRCtrl->uiNOutSamples    = psFIRCtrl->uiNInSamples;                          // Sync FIR does not change number of samples
+            psFIRCtrl->pvProc           = FIR_f32_proc_sync;
+            psFIRCtrl->uiNTaps          = psFIRDescriptor->uiNCoefs;
+        break;
+
+        // Down-sample by 2 type
+        case FIR_TYPE_DS2:
+            psFIRCtrl->uiNOutSamples    = psFIRCtrl->uiNInSamples>>1;                       // Ds2 FIR divides the number of samples by two
+            psFIRCtrl->pvProc           = FIR_f32_proc_ds2;
+            psFIRCtrl->uiNTaps          = psFIRDescriptor->uiNCoefs;
+        break;
+
+        // Unrecognized type
+        default:
+            return FIR_ERROR;
+    }
+    if((psFIRCtrl->uiNTaps % FIR_F32_TAPS_MULTIPLE) != 0)
+        return FIR_ERROR;
+
+    psFIRCtrl->eEnable              = FIR_ON;
+    psFIRCtrl->uiDelayL             = psFIRCtrl->uiNTaps<<1;                                // Double length for circular buffer simulation
+    psFIRCtrl->pfDelayW             = psFIRCtrl->pfDelayB + psFIRCtrl->uiNTaps;
+    psFIRCtrl->uiDelayO             = psFIRCtrl->uiNTaps;
+
+    // Resolve the inner loops for this CPU once
+    src_isa_get_kernels_f32(&sKernels);
+    psFIRCtrl->pfInnerLoop          = sKernels.pfFir;
+    psFIRCtrl->pvInnerLoopOS        = sKernels.pvFirOS;
+
+    // Sync the FIR
+    return FIR_f32_sync(psFIRCtrl);
+}
+
+// ==================================================================== //
+// Function:        FIR_f32_sync                                        //
+// Arguments:       FIRCtrlF32_t *psFIRCtrl: Ctrl strct.                //
+// Return values:   FIR_NO_ERROR on success                             //
+// Description:     Syncs the FIR                                       //
+// ==================================================================== //
+FIRReturnCodes_t            FIR_f32_sync(FIRCtrlF32_t* psFIRCtrl)
+{
+    unsigned int        ui;
+
+    if(psFIRCtrl->eEnable == FIR_ON)
+    {
+        // Set delay line index back to base
+        psFIRCtrl->pfDelayI     = psFIRCtrl->pfDelayB;
+
+        // Clear delay line
+        for(ui = 0; ui < psFIRCtrl->uiDelayL; ui++)
+            psFIRCtrl->pfDelayB[ui]     = FIR_F32_STATE_INIT;
+    }
+
+    return FIR_NO_ERROR;
+}
+
+// ==================================================================== //
+// Function:        FIR_f32_proc_os2                                    //
+// Arguments:       FIRCtrlF32_t *psFIRCtrl: Ctrl strct.                //
+// Return values:   FIR_NO_ERROR on success                             //
+// Description:     Processes the FIR in over-sample by 2 mode          //
+// ==================================================================== //
+FIRReturnCodes_t            FIR_f32_proc_os2(FIRCtrlF32_t* psFIRCtrl)
+{
+    float*          pfIn        = psFIRCtrl->pfIn;
+    unsigned int    uiInStep    = psFIRCtrl->uiInStep;
+    float*          pfOut       = psFIRCtrl->pfOut;
+    unsigned int    uiOutStep   = psFIRCtrl->uiOutStep;
+    float*          pfDelayB    = psFIRCtrl->pfDelayB;
+    float*          pfDelayI    = psFIRCtrl->pfDelayI;
+    float*          pfDelayW    = psFIRCtrl->pfDelayW;
+    unsigned int    uiDelayO    = psFIRCtrl->uiDelayO;
+    unsigned int    uiNTaps     = psFIRCtrl->uiNTaps;
+    float           fData[2];
+    unsigned int    ui;
+
+    for(ui = 0; ui < psFIRCtrl->uiNInSamples; ui++)
+    {
+        // Get new data sample to delay line (double write for circular buffer simulation) with step
+        fData[0]                = *pfIn;
+        pfIn                   += uiInStep;
+        *pfDelayI               = fData[0];
+        *(pfDelayI + uiDelayO)  = fData[0];
+
+        // Step delay (with circular simulation)
+        if(++pfDelayI >= pfDelayW)
+            pfDelayI            = pfDelayB;
+
+        psFIRCtrl->pvInnerLoopOS(pfDelayI, psFIRCtrl->pfCoefs, fData, uiNTaps);
+
+        // Write output with step
+        *pfOut                  = fData[0];
+        pfOut                  += uiOutStep;
+        *pfOut                  = fData[1];
+        pfOut                  += uiOutStep;
+    }
+
+    // Write delay line index back for next round
+    psFIRCtrl->pfDelayI         = pfDelayI;
+
+    return FIR_NO_ERROR;
+}
+
+// ==================================================================== //
+// Function:        FIR_f32_proc_sync                                   //
+// Arguments:       FIRCtrlF32_t *psFIRCtrl: Ctrl strct.                //
+// Return values:   FIR_NO_ERROR on success                             //
+// Description:     Processes the FIR in asynchronous mode              //
+// ==================================================================== //
+FIRReturnCodes_t            FIR_f32_proc_sync(FIRCtrlF32_t* psFIRCtrl)
+{
+    float*          pfIn        = psFIRCtrl->pfIn;
+    unsigned int    uiInStep    = psFIRCtrl->uiInStep;
+    float*          pfOut       = psFIRCtrl->pfOut;
+    unsigned int    uiOutStep   = psFIRCtrl->uiOutStep;
+    float*          pfDelayB    = psFIRCtrl->pfDelayB;
+    float*          pfDelayI    = psFIRCtrl->pfDelayI;
+    float*          pfDelayW    = psFIRCtrl->pfDelayW;
+    unsigned int    uiDelayO    = psFIRCtrl->uiDelayO;
+    unsigned int    uiNTaps     = psFIRCtrl->uiNTaps;
+    float           fData0;
+    unsigned int    ui;
+
+    for(ui = 0; ui < psFIRCtrl->uiNInSamples; ui++)
+    {
+        // Get new data sample to delay line (double write for circular buffer simulation) with step
+        fData0                  = *pfIn;
+        pfIn                   += uiInStep;
+        *pfDelayI               = fData0;
+        *(pfDelayI + uiDelayO)  = fData0;
+
+        // Step delay (with circular simulation)
+        if(++pfDelayI >= pfDelayW)
+            pfDelayI            = pfDelayB;
+
+        // Write output with step
+        *pfOut                  = psFIRCtrl->pfInnerLoop(pfDelayI, psFIRCtrl->pfCoefs, uiNTaps);
+        pfOut                  += uiOutStep;
+    }
+
+    // Write delay line index back for next round
+    psFIRCtrl->pfDelayI         = pfDelayI;
+
+    return FIR_NO_ERROR;
+}
+
+// ==================================================================== //
+// Function:        FIR_f32_proc_ds2                                    //
+// Arguments:       FIRCtrlF32_t *psFIRCtrl: Ctrl strct.                //
+// Return values:   FIR_NO_ERROR on success                             //
+// Description:     Processes the FIR in down-sample by 2 mode          //
+// ==================================================================== //
+FIRReturnCodes_t            FIR_f32_proc_ds2(FIRCtrlF32_t* psFIRCtrl)
+{
+    float*          pfIn        = psFIRCtrl->pfIn;
+    unsigned int    uiInStep    = psFIRCtrl->uiInStep;
+    float*          pfOut       = psFIRCtrl->pfOut;
+    unsigned int    uiOutStep   = psFIRCtrl->uiOutStep;
+    float*          pfDelayB    = psFIRCtrl->pfDelayB;
+    float*          pfDelayI    = psFIRCtrl->pfDelayI;
+    float*          pfDelayW    = psFIRCtrl->pfDelayW;
+    unsigned int    uiDelayO    = psFIRCtrl->uiDelayO;
+    unsigned int    uiNTaps     = psFIRCtrl->uiNTaps;
+    float           fData0, fData1;
+    unsigned int    ui;
+
+    for(ui = 0; ui < psFIRCtrl->uiNInSamples>>1; ui++)
+    {
+        // Get two new data samples to delay line (double write for circular buffer simulation), with input buffer step
+        fData0                      = *pfIn;
+        pfIn                       += uiInStep;
+        fData1                      = *pfIn;
+        pfIn                       += uiInStep;
+        *pfDelayI                   = fData0;
+        *(pfDelayI + 1)             = fData1;
+        *(pfDelayI + uiDelayO)      = fData0;
+        *(pfDelayI + uiDelayO + 1)  = fData1;
+
+        // Step delay with circular simulation
+        pfDelayI                   += 2;
+        if(pfDelayI >= pfDelayW)
+            pfDelayI                = pfDelayB;
+
+        // Write output with step
+        *pfOut                      = psFIRCtrl->pfInnerLoop(pfDelayI, psFIRCtrl->pfCoefs, uiNTaps);
+        pfOut                      += uiOutStep;
+    }
+
+    // Write delay line index back for next round
+    psFIRCtrl->pfDelayI             = pfDelayI;
+
+    return FIR_NO_ERROR;
+}
+
+// ==================================================================== //
+// Function:        ADFIR_f32_init_from_desc                            //
+// Arguments:       ADFIRCtrlF32_t *psADFIRCtrl: Ctrl strct.            //
+//                  ADFIRDescriptor_t *psADFIRDescriptor: Desc. strct.  //
+// Return values:   FIR_NO_ERROR on success                             //
+//                  FIR_ERROR on failure                                //
+// Description:     Inits the ADFIR from the Descriptor                 //
+// ==================================================================== //
+FIRReturnCodes_t            ADFIR_f32_init_from_desc(ADFIRCtrlF32_t* psADFIRCtrl, ADFIRDescriptor_t* psADFIRDescriptor)
+{
+    SRCKernelsF32_t     sKernels;
+    unsigned int        uiPhaseLength;
+
+    // Check that delay line base has been set
+    if(psADFIRCtrl->pfDelayB == 0)
+        return FIR_ERROR;
+
+    // Check that number of phases and number of coefficients per phase are set
+    if(psADFIRDescriptor->uiNPhases == 0)
+        return FIR_ERROR;
+    uiPhaseLength                   = psADFIRDescriptor->uiNCoefsPerPhase;
+    if((uiPhaseLength == 0) || ((uiPhaseLength % FIR_F32_TAPS_MULTIPLE) != 0))
+        return FIR_ERROR;
+
+    // Setup ADFIR
+    psADFIRCtrl->uiDelayL           = uiPhaseLength<<1;                 // Double length for circular buffer simulation
+    psADFIRCtrl->pfDelayW           = psADFIRCtrl->pfDelayB + uiPhaseLength;
+    psADFIRCtrl->uiDelayO           = uiPhaseLength;
+    psADFIRCtrl->uiNTaps            = uiPhaseLength;
+
+    src_isa_get_kernels_f32(&sKernels);
+    psADFIRCtrl->pfInnerLoop        = sKernels.pfFir;
+
+    // Sync the ADFIR
+    return ADFIR_f32_sync(psADFIRCtrl);
+}
+
+// ==================================================================== //
+// Function:        ADFIR_f32_sync                                      //
+// Arguments:       ADFIRCtrlF32_t *psADFIRCtrl: Ctrl strct.            //
+// Return values:   FIR_NO_ERROR on success                             //
+// Description:     Syncs the ADFIR filter                              //
+// ==================================================================== //
+FIRReturnCodes_t            ADFIR_f32_sync(ADFIRCtrlF32_t* psADFIRCtrl)
+{
+    unsigned int        ui;
+
+    // Set delay line index back to base
+    psADFIRCtrl->pfDelayI   = psADFIRCtrl->pfDelayB;
+
+    // Clear delay line
+    for(ui = 0; ui < psADFIRCtrl->uiDelayL; ui++)
+        psADFIRCtrl->pfDelayB[ui]   = FIR_F32_STATE_INIT;
+
+    return FIR_NO_ERROR;
+}
+
+// ==================================================================== //
+// Function:        PPFIR_f32_init_from_desc                            //
+// Arguments:       PPFIRCtrlF32_t *psPPFIRCtrl: Ctrl strct.            //
+//                  PPFIRDescriptor_t *psPPFIRDescriptor: Desc. strct.  //
+// Return values:   FIR_NO_ERROR on success                             //
+//                  FIR_ERROR on failure                                //
+// Description:     Inits the PPFIR from the Descriptor                 //
+// ==================================================================== //
+FIRReturnCodes_t            PPFIR_f32_init_from_desc(PPFIRCtrlF32_t* psPPFIRCtrl, PPFIRDescriptor_t* psPPFIRDescriptor)
+{
+    SRCKernelsF32_t     sKernels;
+    unsigned int        uiPhaseLength;
+
+    // Check if PPFIR is disabled (this is given by the number of coefficients being zero)
+    if(psPPFIRDescriptor->uiNCoefs == 0)
+    {
+        psPPFIRCtrl->eEnable            = FIR_OFF;
+        psPPFIRCtrl->uiNOutSamples      = 0;
+        psPPFIRCtrl->uiDelayL           = 0;
+        psPPFIRCtrl->pfDelayW           = 0;
+        psPPFIRCtrl->uiDelayO           = 0;
+        psPPFIRCtrl->uiNTaps            = 0;
+        psPPFIRCtrl->uiNCoefs           = 0;
+        psPPFIRCtrl->pfCoefs            = 0;
+        psPPFIRCtrl->uiNPhases          = 0;
+        psPPFIRCtrl->uiPhaseStep        = 0;
+        psPPFIRCtrl->uiCoefsPhaseStep   = 0;
+        psPPFIRCtrl->uiCoefsPhase       = 0;
+
+        return FIR_NO_ERROR;
+    }
+
+    // Check that delay line base has been set
+    if(psPPFIRCtrl->pfDelayB == 0)
+        return FIR_ERROR;
+
+    // Check that number of samples has been set
+    if(psPPFIRCtrl->uiNInSamples == 0)
+        return FIR_ERROR;
+
+    // Check the input and output samples steps have been set
+    if(psPPFIRCtrl->uiInStep == 0)
+        return FIR_ERROR;
+    if(psPPFIRCtrl->uiOutStep == 0)
+        return FIR_ERROR;
+
+    // Check that phase step has been set properly
+    if(psPPFIRCtrl->uiPhaseStep == 0)
+        return FIR_ERROR;
+
+    // Check that number of phases and number of coefficients are compatible
+    uiPhaseLength                   = (psPPFIRDescriptor->uiNCoefs / psPPFIRDescriptor->uiNPhases);
+    if(uiPhaseLength == 0)
+        return FIR_ERROR;
+    if((uiPhaseLength * psPPFIRDescriptor->uiNPhases) != psPPFIRDescriptor->uiNCoefs)
+        return FIR_ERROR;
+    if((uiPhaseLength % FIR_F32_TAPS_MULTIPLE) != 0)
+        return FIR_ERROR;
+
+    // Get the float32 coefficients
+    psPPFIRCtrl->pfCoefs            = FIR_f32_coefs(psPPFIRDescriptor->piCoefs);
+    if(psPPFIRCtrl->pfCoefs == 0)
+        return FIR_ERROR;
+
+    // Setup PPFIR
+    psPPFIRCtrl->eEnable            = FIR_ON;
+    psPPFIRCtrl->uiDelayL           = uiPhaseLength<<1;                                 // Double length for circular buffer simulation
+    psPPFIRCtrl->pfDelayW           = psPPFIRCtrl->pfDelayB + uiPhaseLength;
+    psPPFIRCtrl->uiDelayO           = uiPhaseLength;
+    psPPFIRCtrl->uiNTaps            = uiPhaseLength;
+    psPPFIRCtrl->uiNCoefs           = psPPFIRDescriptor->uiNCoefs;
+    psPPFIRCtrl->uiNPhases          = psPPFIRDescriptor->uiNPhases;
+    psPPFIRCtrl->uiCoefsPhaseStep   = psPPFIRCtrl->uiPhaseStep * uiPhaseLength;         // Length (number of coefs) of a phase step
+
+    src_isa_get_kernels_f32(&sKernels);
+    psPPFIRCtrl->pfInnerLoop        = sKernels.pfFir;
+
+    // Sync the PPFIR
+    return PPFIR_f32_sync(psPPFIRCtrl);
+}
+
+// ==================================================================== //
+// Function:        PPFIR_f32_sync                                      //
+// Arguments:       PPFIRCtrlF32_t *psPPFIRCtrl: Ctrl strct.            //
+// Return values:   FIR_NO_ERROR on success                             //
+// Description:     Syncs the PPFIR                                     //
+// ==================================================================== //
+FIRReturnCodes_t            PPFIR_f32_sync(PPFIRCtrlF32_t* psPPFIRCtrl)
+{
+    unsigned int        ui;
+
+    if(psPPFIRCtrl->eEnable == FIR_ON)
+    {
+        // Set delay line index back to base
+        psPPFIRCtrl->pfDelayI   = psPPFIRCtrl->pfDelayB;
+
+        // Clear delay line
+        for(ui = 0; ui < psPPFIRCtrl->uiDelayL; ui++)
+            psPPFIRCtrl->pfDelayB[ui]   = FIR_F32_STATE_INIT;
+
+        // Set coefficients phase to zero and clear number of output samples
+        psPPFIRCtrl->uiCoefsPhase       = 0;
+        psPPFIRCtrl->uiNOutSamples      = 0;
+    }
+
+    return FIR_NO_ERROR;
+}
+
+// ==================================================================== //
+// Function:        PPFIR_f32_proc                                      //
+// Arguments:       PPFIRCtrlF32_t *psPPFIRCtrl: Ctrl strct.            //
+// Return values:   FIR_NO_ERROR on success                             //
+// Description:     Processes the PPFIR                                 //
+// ==================================================================== //
+FIRReturnCodes_t            PPFIR_f32_proc(PPFIRCtrlF32_t* psPPFIRCtrl)
+{
+    float*          pfIn                = psPPFIRCtrl->pfIn;
+    unsigned int    uiInStep            = psPPFIRCtrl->uiInStep;
+    float*          pfOut               = psPPFIRCtrl->pfOut;
+    unsigned int    uiOutStep           = psPPFIRCtrl->uiOutStep;
+    float*          pfDelayB            = psPPFIRCtrl->pfDelayB;
+    float*          pfDelayI            = psPPFIRCtrl->pfDelayI;
+    float*          pfDelayW            = psPPFIRCtrl->pfDelayW;
+    unsigned int    uiDelayO            = psPPFIRCtrl->uiDelayO;
+    float*          pfCoefsB            = psPPFIRCtrl->pfCoefs;
+    unsigned int    uiNTaps             = psPPFIRCtrl->uiNTaps;
+    unsigned int    uiNCoefs            = psPPFIRCtrl->uiNCoefs;
+    unsigned int    uiCoefsPhase        = psPPFIRCtrl->uiCoefsPhase;
+    unsigned int    uiCoefsPhaseStep    = psPPFIRCtrl->uiCoefsPhaseStep;
+    unsigned int    uiNOutSamples       = 0;
+    float           fData0;
+    unsigned int    ui;
+
+    for(ui = 0; ui < psPPFIRCtrl->uiNInSamples; ui++)
+    {
+        // Get new data sample to delay line (double write for circular buffer simulation) with step
+        fData0                  = *pfIn;
+        pfIn                   += uiInStep;
+        *pfDelayI               = fData0;
+        *(pfDelayI + uiDelayO)  = fData0;
+
+        // Step delay (with circular simulation)
+        if(++pfDelayI >= pfDelayW)
+            pfDelayI            = pfDelayB;
+
+        // Produce the outputs that fall between this input sample and the next
+        while(uiCoefsPhase < uiNCoefs)
+        {
+            *pfOut              = psPPFIRCtrl->pfInnerLoop(pfDelayI, pfCoefsB + uiCoefsPhase, uiNTaps);
+            pfOut              += uiOutStep;
+
+            // Step phase coefficient offset for next output phase
+            uiCoefsPhase       += uiCoefsPhaseStep;
+            uiNOutSamples++;
+        }
+
+        // Reduce phase for next input sample (one input sample corresponds to all coefficients in the PP filter)
+        uiCoefsPhase           -= uiNCoefs;
+    }
+
+    // Write delay line index, coefs phase and number of samples back for next round
+    psPPFIRCtrl->pfDelayI       = pfDelayI;
+    psPPFIRCtrl->uiCoefsPhase   = uiCoefsPhase;
+    psPPFIRCtrl->uiNOutSamples  = uiNOutSamples;
+
+    return FIR_NO_ERROR;
+}
+
+#endif // !__xcore__
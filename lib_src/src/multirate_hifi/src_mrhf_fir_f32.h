@@ -0,0 +1,234 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Float32 FIR functions definition file for the host float32 ASRC and SSRC.
+// The filters are set up from the same descriptors as src_mrhf_fir.h, with
+// float32 copies of the coefficient tables, and keep the same double write
+// delay lines. Samples are scaled so that 1.0 is the full scale of Q1.31.
+//
+// ===========================================================================
+// ===========================================================================
+#ifndef _SRC_MRHF_FIR_F32_H
+#define _SRC_MRHF_FIR_F32_H
+
+#if !defined(__xcore__)
+
+#include "src_mrhf_fir.h"
+#include "src_mrhf_filter_defs.h"
+#include "src_mrhf_isa.h"
+
+    // ===========================================================================
+    //
+    // TypeDefs
+    //
+    // ===========================================================================
+
+    // FIR Ctrl
+    // --------
+    typedef struct _FIRCtrlF32
+    {
+        FIROnOffCodes_t                         eEnable;            // FIR on/off
+        float*                                  pfIn;               // Pointer to input data
+        unsigned int                            uiNInSamples;       // Number of input samples to process
+        unsigned int                            uiInStep;           // Step between input data samples
+        float*                                  pfOut;              // Pointer to output data
+        unsigned int                            uiNOutSamples;      // Number of output samples produced
+        unsigned int                            uiOutStep;          // Step between output data samples
+        FIRReturnCodes_t                        (*pvProc)(struct _FIRCtrlF32 *);    // Processing function address
+        float*                                  pfDelayB;           // Pointer to delay line base
+        unsigned int                            uiDelayL;           // Total length of delay line
+        float*                                  pfDelayI;           // Pointer to current position in delay line
+        float*                                  pfDelayW;           // Delay buffer wrap around address (for circular buffer simulation)
+        unsigned int                            uiDelayO;           // Delay line offset for second write (for circular buffer simulation)
+        unsigned int                            uiNTaps;            // Number of taps per output sample
+        float*                                  pfCoefs;            // Pointer to coefficients (OS2: those of the first output, then the second)
+        SRCInnerLoopF32_t                       pfInnerLoop;        // Inner loop, selected at init
+        SRCInnerLoopOSF32_t                     pvInnerLoopOS;      // OS2 inner loop, selected at init
+    } FIRCtrlF32_t;
+
+    // ADFIR Ctrl
+    // ----------
+    typedef struct _ADFIRCtrlF32
+    {
+        float*                                  pfDelayB;           // Pointer to delay line base
+        unsigned int                            uiDelayL;           // Total length of delay line
+        float*                                  pfDelayI;           // Pointer to current position in delay line
+        float*                                  pfDelayW;           // Delay buffer wrap around address (for circular buffer simulation)
+        unsigned int                            uiDelayO;           // Delay line offset for second write (for circular buffer simulation)
+        unsigned int                            uiNTaps;            // Number of taps
+        SRCInnerLoopF32_t                       pfInnerLoop;        // Inner loop, selected at init
+    } ADFIRCtrlF32_t;
+
+    // PPFIR Ctrl
+    // ----------
+    typedef struct _PPFIRCtrlF32
+    {
+        FIROnOffCodes_t                         eEnable;            // PPFIR on/off
+        float*                                  pfIn;               // Pointer to input data
+        unsigned int                            uiNInSamples;       // Number of input samples to process
+        unsigned int                            uiInStep;           // Step between input data samples
+        float*                                  pfOut;              // Pointer to output data
+        unsigned int                            uiNOutSamples;      // Number of output samples produced
+        unsigned int                            uiOutStep;          // Step between output data samples
+        float*                                  pfDelayB;           // Pointer to delay line base
+        unsigned int                            uiDelayL;           // Total length of delay line
+        float*                                  pfDelayI;           // Pointer to current position in delay line
+        float*                                  pfDelayW;           // Delay buffer wrap around address (for circular buffer simulation)
+        unsigned int                            uiDelayO;           // Delay line offset for second write (for circular buffer simulation)
+        unsigned int                            uiNTaps;            // Number of taps per phase
+        unsigned int                            uiNCoefs;           // Number of coefficients
+        float*                                  pfCoefs;            // Pointer to coefficients
+        unsigned int                            uiNPhases;          // Number of phases
+        unsigned int                            uiPhaseStep;        // Phase step
+        unsigned int                            uiCoefsPhaseStep;   // Number of coefficients for a phase step
+        unsigned int                            uiCoefsPhase;       // Current phase coefficient offset from base
+        SRCInnerLoopF32_t                       pfInnerLoop;        // Inner loop, selected at init
+    } PPFIRCtrlF32_t;
+
+    // ===========================================================================
+    //
+    // Function prototypes
+    //
+    // ===========================================================================
+
+    // ==================================================================== //
+    // Function:        FIR_f32_coefs                                       //
+    // Arguments:       int *piCoefs: Coefficients of a FIR or PPFIR        //
+    //                                descriptor                            //
+    // Return values:   Their float32 copy, 0 if they are not known         //
+    // Description:     The copies of all tables are built on first use,    //
+    //                  thread safe. OS2 tables are reordered to the first  //
+    //                  output's coefficients, then the second's            //
+    // ==================================================================== //
+    float*                          FIR_f32_coefs(int* piCoefs);
+
+    // ==================================================================== //
+    // Function:        ADFIR_f32_coefs                                     //
+    // Arguments:       None                                                //
+    // Return values:   Float32 ADFIR phase table, FILTER_DEFS_ADFIR_N_     //
+    //                  PHASES + 2 phases of FILTER_DEFS_ADFIR_PHASE_N_TAPS //
+    // Description:     Built from the prototype with the tables above, so  //
+    //                  it does not depend on the layout of iADFirCoefs     //
+    // ==================================================================== //
+    float*                          ADFIR_f32_coefs(void);
+
+    // ==================================================================== //
+    // Function:        FIR_f32_init_from_desc                              //
+    // Arguments:       FIRCtrlF32_t *psFIRCtrl: Ctrl strct.                //
+    //                  FIRDescriptor_t *psFIRDescriptor: Desc. strct.      //
+    // Return values:   FIR_NO_ERROR on success                             //
+    //                  FIR_ERROR on failure                                //
+    // Description:     As FIR_init_from_desc                               //
+    // ==================================================================== //
+    FIRReturnCodes_t                FIR_f32_init_from_desc(FIRCtrlF32_t* psFIRCtrl, FIRDescriptor_t* psFIRDescriptor);
+
+    // ==================================================================== //
+    // Function:        FIR_f32_init_from_coefs                             //
+    // Arguments:       FIRCtrlF32_t *psFIRCtrl: Ctrl strct.                //
+    //                  FIRDescriptor_t *psFIRDescriptor: Desc. strct.      //
+    //                  float *pfCoefs: Float32 coefficients, in the order  //
+    //                               of FIR_f32_coefs                       //
+    // Return values:   FIR_NO_ERROR on success                             //
+    //                  FIR_ERROR on failure                                //
+    // Description:     As FIR_f32_init_from_desc, for coefficients that    //
+    //                  are not in the tables                               //
+    // ==================================================================== //
+    FIRReturnCodes_t                FIR_f32_init_from_coefs(FIRCtrlF32_t* psFIRCtrl, FIRDescriptor_t* psFIRDescriptor, float* pfCoefs);
+
+    // ==================================================================== //
+    // Function:        FIR_f32_sync                                        //
+    // Arguments:       FIRCtrlF32_t *psFIRCtrl: Ctrl strct.                //
+    // Return values:   FIR_NO_ERROR on success                             //
+    // Description:     Clears the delay line                               //
+    // ==================================================================== //
+    FIRReturnCodes_t                FIR_f32_sync(FIRCtrlF32_t* psFIRCtrl);
+
+    // ==================================================================== //
+    // Function:        FIR_f32_proc_os2, FIR_f32_proc_sync, FIR_f32_proc_ds2 //
+    // Arguments:       FIRCtrlF32_t *psFIRCtrl: Ctrl strct.                //
+    // Return values:   FIR_NO_ERROR on success                             //
+    // Description:     As FIR_proc_os2, FIR_proc_sync and FIR_proc_ds2     //
+    // ==================================================================== //
+    FIRReturnCodes_t                FIR_f32_proc_os2(FIRCtrlF32_t* psFIRCtrl);
+    FIRReturnCodes_t                FIR_f32_proc_sync(FIRCtrlF32_t* psFIRCtrl);
+    FIRReturnCodes_t                FIR_f32_proc_ds2(FIRCtrlF32_t* psFIRCtrl);
+
+    // ==================================================================== //
+    // Function:        ADFIR_f32_init_from_desc                            //
+    // Arguments:       ADFIRCtrlF32_t *psADFIRCtrl: Ctrl strct.            //
+    //                  ADFIRDescriptor_t *psADFIRDescriptor: Desc. strct.  //
+    // Return values:   FIR_NO_ERROR on success                             //
+    //                  FIR_ERROR on failure                                //
+    // Description:     As ADFIR_init_from_desc. The adaptive coefficients  //
+    //                  are passed to ADFIR_f32_proc_macc                   //
+    // ==================================================================== //
+    FIRReturnCodes_t                ADFIR_f32_init_from_desc(ADFIRCtrlF32_t* psADFIRCtrl, ADFIRDescriptor_t* psADFIRDescriptor);
+
+    // ==================================================================== //
+    // Function:        ADFIR_f32_sync                                      //
+    // Arguments:       ADFIRCtrlF32_t *psADFIRCtrl: Ctrl strct.            //
+    // Return values:   FIR_NO_ERROR on success                             //
+    // Description:     Clears the delay line                               //
+    // ==================================================================== //
+    FIRReturnCodes_t                ADFIR_f32_sync(ADFIRCtrlF32_t* psADFIRCtrl);
+
+    // ==================================================================== //
+    // Function:        ADFIR_f32_proc_in_spl                               //
+    // Arguments:       ADFIRCtrlF32_t *psADFIRCtrl: Ctrl strct.            //
+    //                  float fIn: New input sample                         //
+    // Return values:   None                                                //
+    // Description:     Writes a new input sample to the delay line         //
+    // ==================================================================== //
+    static inline void              ADFIR_f32_proc_in_spl(ADFIRCtrlF32_t* psADFIRCtrl, float fIn)
+    {
+        // Double write to simulate circular buffer
+        *psADFIRCtrl->pfDelayI                              = fIn;
+        *(psADFIRCtrl->pfDelayI + psADFIRCtrl->uiDelayO)    = fIn;
+        // Step delay (with circular simulation)
+        if(++psADFIRCtrl->pfDelayI >= psADFIRCtrl->pfDelayW)
+            psADFIRCtrl->pfDelayI                           = psADFIRCtrl->pfDelayB;
+    }
+
+    // ==================================================================== //
+    // Function:        ADFIR_f32_proc_macc                                 //
+    // Arguments:       ADFIRCtrlF32_t *psADFIRCtrl: Ctrl strct.            //
+    //                  const float *pfADCoefs: Adaptive coefficients       //
+    // Return values:   The output sample                                   //
+    // Description:     Processes the macc loop for the ADFIR filter        //
+    // ==================================================================== //
+    static inline float             ADFIR_f32_proc_macc(ADFIRCtrlF32_t* psADFIRCtrl, const float* pfADCoefs)
+    {
+        return psADFIRCtrl->pfInnerLoop(psADFIRCtrl->pfDelayI, pfADCoefs, psADFIRCtrl->uiNTaps);
+    }
+
+    // ==================================================================== //
+    // Function:        PPFIR_f32_init_from_desc                            //
+    // Arguments:       PPFIRCtrlF32_t *psPPFIRCtrl: Ctrl strct.            //
+    //                  PPFIRDescriptor_t *psPPFIRDescriptor: Desc. strct.  //
+    // Return values:   FIR_NO_ERROR on success                             //
+    //                  FIR_ERROR on failure                                //
+    // Description:     As PPFIR_init_from_desc                             //
+    // ==================================================================== //
+    FIRReturnCodes_t                PPFIR_f32_init_from_desc(PPFIRCtrlF32_t* psPPFIRCtrl, PPFIRDescriptor_t* psPPFIRDescriptor);
+
+    // ==================================================================== //
+    // Function:        PPFIR_f32_sync                                      //
+    // Arguments:       PPFIRCtrlF32_t *psPPFIRCtrl: Ctrl strct.            //
+    // Return values:   FIR_NO_ERROR on success                             //
+    // Description:     Clears the delay line and phase                     //
+    // ==================================================================== //
+    FIRReturnCodes_t                PPFIR_f32_sync(PPFIRCtrlF32_t* psPPFIRCtrl);
+
+    // ==================================================================== //
+    // Function:        PPFIR_f32_proc                                      //
+    // Arguments:       PPFIRCtrlF32_t *psPPFIRCtrl: Ctrl strct.            //
+    // Return values:   FIR_NO_ERROR on success                             //
+    // Description:     As PPFIR_proc                                       //
+    // ==================================================================== //
+    FIRReturnCodes_t                PPFIR_f32_proc(PPFIRCtrlF32_t* psPPFIRCtrl);
+
+#endif // !__xcore__
+
+#endif // _SRC_MRHF_FIR_F32_H
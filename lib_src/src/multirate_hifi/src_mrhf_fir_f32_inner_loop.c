@@ -0,0 +1,78 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Float32 FIR, FIR OS2 and ADFIR spline inner loops in portable C, for the
+// host float32 ASRC and SSRC. The sums are split four ways, which the
+// compiler may not do for floats by itself.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+#include "src_mrhf_fir_f32_inner_loop.h"
+
+#define     SRC_MRHF_SPLINE_N_TAPS      16      // As src_mrhf_spline_coeff_gen_inner_loop.c
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_f32_inner_loop                         //
+// Arguments:       const float *pfData: Delay line, oldest tap first   //
+//                  const float *pfCoefs: Coefficients                  //
+//                  unsigned uiNTaps: Number of taps (multiple of 8)    //
+// Return values:   The output sample                                   //
+// Description:     Computes one FIR output sample                      //
+// ==================================================================== //
+float src_mrhf_fir_f32_inner_loop(const float *pfData, const float *pfCoefs, unsigned uiNTaps)
+{
+    float           fAcc[4]     = {0.0f, 0.0f, 0.0f, 0.0f};
+    unsigned        ui;
+
+    for(ui = 0; ui < uiNTaps; ui += 4)
+    {
+        fAcc[0]    += pfData[ui] * pfCoefs[ui];
+        fAcc[1]    += pfData[ui + 1] * pfCoefs[ui + 1];
+        fAcc[2]    += pfData[ui + 2] * pfCoefs[ui + 2];
+        fAcc[3]    += pfData[ui + 3] * pfCoefs[ui + 3];
+    }
+    return (fAcc[0] + fAcc[1]) + (fAcc[2] + fAcc[3]);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_os_f32_inner_loop                      //
+// Arguments:       const float *pfData: Delay line, oldest tap first   //
+//                  const float *pfCoefs: Coefficients of the first     //
+//                               output, then those of the second       //
+//                  float fData[2]: The two output samples, in order    //
+//                  unsigned uiNTaps: Taps per output (multiple of 8)   //
+// Return values:   None                                                //
+// Description:     Computes two OS2 FIR output samples                 //
+// ==================================================================== //
+void src_mrhf_fir_os_f32_inner_loop(const float *pfData, const float *pfCoefs, float fData[2], unsigned uiNTaps)
+{
+    fData[0]        = src_mrhf_fir_f32_inner_loop(pfData, pfCoefs, uiNTaps);
+    fData[1]        = src_mrhf_fir_f32_inner_loop(pfData, pfCoefs + uiNTaps, uiNTaps);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_spline_coeff_gen_f32                       //
+// Arguments:       const float *pfPhase0: First of three adjacent      //
+//                               phases of 16 taps                      //
+//                  const float fH[3]: Spline weights (fH[2] applies    //
+//                               to phase 0)                            //
+//                  float *pfADCoefs: Adaptive coefficients (output)    //
+// Return values:   None                                                //
+// Description:     Builds the 16 adaptive filter coefficients          //
+// ==================================================================== //
+void src_mrhf_spline_coeff_gen_f32(const float *pfPhase0, const float fH[3], float *pfADCoefs)
+{
+    const float*    pfPhase1    = pfPhase0 + SRC_MRHF_SPLINE_N_TAPS;
+    const float*    pfPhase2    = pfPhase1 + SRC_MRHF_SPLINE_N_TAPS;
+    unsigned        ui;
+
+    for(ui = 0; ui < SRC_MRHF_SPLINE_N_TAPS; ui++)
+        pfADCoefs[ui]   = fH[2] * pfPhase0[ui] + fH[1] * pfPhase1[ui] + fH[0] * pfPhase2[ui];
+}
+
+#endif // !__xcore__
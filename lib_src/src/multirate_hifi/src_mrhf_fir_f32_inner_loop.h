@@ -0,0 +1,20 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+#ifndef _SRC_MRHF_FIR_F32_INNER_LOOP_H_
+#define _SRC_MRHF_FIR_F32_INNER_LOOP_H_
+
+#if !defined(__xcore__)
+// Float32 inner loops of the host float32 ASRC and SSRC, see SRCKernelsF32_t in src_mrhf_isa.h
+float src_mrhf_fir_f32_inner_loop(const float *pfData, const float *pfCoefs, unsigned uiNTaps);
+void src_mrhf_fir_os_f32_inner_loop(const float *pfData, const float *pfCoefs, float fData[2], unsigned uiNTaps);
+void src_mrhf_spline_coeff_gen_f32(const float *pfPhase0, const float fH[3], float *pfADCoefs);
+
+#if defined(__x86_64__) || defined(__i386__)
+// x86 versions, only to be called when src_isa_detect() reports AVX2 and CPUID reports FMA
+float src_mrhf_fir_f32_inner_loop_avx2(const float *pfData, const float *pfCoefs, unsigned uiNTaps);
+void src_mrhf_fir_os_f32_inner_loop_avx2(const float *pfData, const float *pfCoefs, float fData[2], unsigned uiNTaps);
+void src_mrhf_spline_coeff_gen_f32_avx2(const float *pfPhase0, const float fH[3], float *pfADCoefs);
+#endif
+#endif
+
+#endif // _SRC_MRHF_FIR_F32_INNER_LOOP_H_
@@ -0,0 +1,103 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// AVX2 + FMA float32 FIR, FIR OS2 and ADFIR spline inner loops for x86
+// hosts, as src_mrhf_fir_f32_inner_loop.c. Eight taps per FMA, where the
+// integer kernels only get four 32x32->64 products per AVX2 instruction.
+//
+// The functions are compiled with target attributes so the library does
+// not need -mavx2 -mfma; src_isa_get_kernels_f32 only selects them when
+// CPUID reports both (see src_mrhf_isa.h).
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <immintrin.h>
+
+#include "src_mrhf_fir_f32_inner_loop.h"
+
+__attribute__((target("avx2,fma")))
+static inline float src_mrhf_f32_hsum_avx2(__m256 vAcc)
+{
+    __m128          vSum        = _mm_add_ps(_mm256_castps256_ps128(vAcc), _mm256_extractf128_ps(vAcc, 1));
+
+    vSum = _mm_add_ps(vSum, _mm_movehl_ps(vSum, vSum));
+    vSum = _mm_add_ss(vSum, _mm_movehdup_ps(vSum));
+    return _mm_cvtss_f32(vSum);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_f32_inner_loop_avx2                    //
+// Description:     As src_mrhf_fir_f32_inner_loop, 2 x 8 lanes         //
+// ==================================================================== //
+__attribute__((target("avx2,fma")))
+float src_mrhf_fir_f32_inner_loop_avx2(const float *pfData, const float *pfCoefs, unsigned uiNTaps)
+{
+    __m256          vAcc0       = _mm256_setzero_ps();
+    __m256          vAcc1       = _mm256_setzero_ps();
+    unsigned        ui;
+
+    for(ui = 0; ui + 16 <= uiNTaps; ui += 16)
+    {
+        vAcc0 = _mm256_fmadd_ps(_mm256_loadu_ps(&pfData[ui]), _mm256_loadu_ps(&pfCoefs[ui]), vAcc0);
+        vAcc1 = _mm256_fmadd_ps(_mm256_loadu_ps(&pfData[ui + 8]), _mm256_loadu_ps(&pfCoefs[ui + 8]), vAcc1);
+    }
+    // Tap counts are multiples of 8, not always of 16
+    if(ui < uiNTaps)
+        vAcc0 = _mm256_fmadd_ps(_mm256_loadu_ps(&pfData[ui]), _mm256_loadu_ps(&pfCoefs[ui]), vAcc0);
+
+    return src_mrhf_f32_hsum_avx2(_mm256_add_ps(vAcc0, vAcc1));
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_os_f32_inner_loop_avx2                 //
+// Description:     As src_mrhf_fir_os_f32_inner_loop, each data load   //
+//                  is used for both outputs                            //
+// ==================================================================== //
+__attribute__((target("avx2,fma")))
+void src_mrhf_fir_os_f32_inner_loop_avx2(const float *pfData, const float *pfCoefs, float fData[2], unsigned uiNTaps)
+{
+    const float*    pfCoefs1    = pfCoefs + uiNTaps;
+    __m256          vAcc0       = _mm256_setzero_ps();
+    __m256          vAcc1       = _mm256_setzero_ps();
+    unsigned        ui;
+
+    for(ui = 0; ui < uiNTaps; ui += 8)
+    {
+        __m256      vData       = _mm256_loadu_ps(&pfData[ui]);
+
+        vAcc0 = _mm256_fmadd_ps(vData, _mm256_loadu_ps(&pfCoefs[ui]), vAcc0);
+        vAcc1 = _mm256_fmadd_ps(vData, _mm256_loadu_ps(&pfCoefs1[ui]), vAcc1);
+    }
+
+    fData[0]        = src_mrhf_f32_hsum_avx2(vAcc0);
+    fData[1]        = src_mrhf_f32_hsum_avx2(vAcc1);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_spline_coeff_gen_f32_avx2                  //
+// Description:     As src_mrhf_spline_coeff_gen_f32, 2 x 8 lanes       //
+// ==================================================================== //
+__attribute__((target("avx2,fma")))
+void src_mrhf_spline_coeff_gen_f32_avx2(const float *pfPhase0, const float fH[3], float *pfADCoefs)
+{
+    __m256          vH0         = _mm256_set1_ps(fH[0]);
+    __m256          vH1         = _mm256_set1_ps(fH[1]);
+    __m256          vH2         = _mm256_set1_ps(fH[2]);
+    unsigned        ui;
+
+    for(ui = 0; ui < 16; ui += 8)
+    {
+        __m256      vCoefs      = _mm256_mul_ps(vH2, _mm256_loadu_ps(&pfPhase0[ui]));
+
+        vCoefs = _mm256_fmadd_ps(vH1, _mm256_loadu_ps(&pfPhase0[ui + 16]), vCoefs);
+        vCoefs = _mm256_fmadd_ps(vH0, _mm256_loadu_ps(&pfPhase0[ui + 32]), vCoefs);
+        _mm256_storeu_ps(&pfADCoefs[ui], vCoefs);
+    }
+}
+
+#endif // !__xcore__ && x86
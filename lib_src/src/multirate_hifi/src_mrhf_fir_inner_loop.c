@@ -0,0 +1,58 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// FIR inner loop C implementation for non-xcore (host) targets.
+// Bit-exact with src_mrhf_fir_inner_loop_asm.S: 32x32->64 MACCS accumulation
+// followed by LSATS/LEXTRACT at bit 31.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+#include <stdint.h>
+
+#include "src_mrhf_int_arithmetic.h"
+#include "src_mrhf_fir_inner_loop_asm.h"
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_inner_loop_asm                         //
+// Arguments:       int *piData: Pointer to delay line                  //
+//                  int *piCoefs: Pointer to coefficients               //
+//                  int iData[]: Result (iData[0])                      //
+//                  int count: Number of 2-tap loops (multiple of 8)    //
+// Return values:   None                                                //
+// Description:     Computes one FIR output sample                      //
+// ==================================================================== //
+void src_mrhf_fir_inner_loop_asm(int *piData, int *piCoefs, int iData[], int count)
+{
+    // Wrapping 64 bit accumulation, as MACCS does not saturate
+    uint64_t        u64Acc      = 0;
+    int             iNTaps      = (count >> 3) << 4;
+    long long       i64Acc;
+    int             i;
+
+    for(i = 0; i < iNTaps; i++)
+        u64Acc += (uint64_t)((long long)piData[i] * (long long)piCoefs[i]);
+
+    i64Acc = (long long)u64Acc;
+    if(i64Acc > MAX_VAL64_30)
+        i64Acc = MAX_VAL64_30;
+    if(i64Acc < MIN_VAL64_30)
+        i64Acc = MIN_VAL64_30;
+    iData[0]        = (int)(i64Acc >> 31);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_inner_loop_asm_odd                     //
+// Description:     As src_mrhf_fir_inner_loop_asm. The even/odd split  //
+//                  only matters for xcore double-word loads            //
+// ==================================================================== //
+void src_mrhf_fir_inner_loop_asm_odd(int *piData, int *piCoefs, int iData[], int count)
+{
+    src_mrhf_fir_inner_loop_asm(piData, piCoefs, iData, count);
+}
+
+#endif // !__xcore__
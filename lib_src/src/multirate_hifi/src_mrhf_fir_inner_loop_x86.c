@@ -0,0 +1,163 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// SSE4.1 and AVX2 FIR and FIR OS2 inner loops for x86 hosts.
+// Bit-exact with src_mrhf_fir_inner_loop.c / src_mrhf_fir_os_inner_loop.c:
+// the 32x32->64 products are summed with wrapping 64 bit adds, which gives
+// the same total in any order, then saturated and extracted at bit 31.
+//
+// The functions are compiled with target attributes so the library does
+// not need -mavx2; FIR_init_from_desc only selects them when CPUID reports
+// the extension (see src_mrhf_isa.h).
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "src_mrhf_int_arithmetic.h"
+#include "src_mrhf_fir_inner_loop_asm.h"
+#include "src_mrhf_fir_os_inner_loop_asm.h"
+
+static inline int src_mrhf_fir_sat_extract(uint64_t u64Acc)
+{
+    long long       i64Acc      = (long long)u64Acc;
+
+    if(i64Acc > MAX_VAL64_30)
+        i64Acc = MAX_VAL64_30;
+    if(i64Acc < MIN_VAL64_30)
+        i64Acc = MIN_VAL64_30;
+    return (int)(i64Acc >> 31);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_inner_loop_sse41                       //
+// Description:     As src_mrhf_fir_inner_loop_asm, 2 x 64 bit lanes    //
+// ==================================================================== //
+__attribute__((target("sse4.1")))
+void src_mrhf_fir_inner_loop_sse41(int *piData, int *piCoefs, int iData[], int count)
+{
+    int             iNTaps      = (count >> 3) << 4;
+    __m128i         vAcc0       = _mm_setzero_si128();
+    __m128i         vAcc1       = _mm_setzero_si128();
+    uint64_t        u64Acc[2];
+    int             i;
+
+    for(i = 0; i < iNTaps; i += 4)
+    {
+        __m128i     vData       = _mm_loadu_si128((const __m128i *)&piData[i]);
+        __m128i     vCoefs      = _mm_loadu_si128((const __m128i *)&piCoefs[i]);
+
+        // PMULDQ multiplies the even 32 bit elements, shift the odd ones down for the second product
+        vAcc0 = _mm_add_epi64(vAcc0, _mm_mul_epi32(vData, vCoefs));
+        vAcc1 = _mm_add_epi64(vAcc1, _mm_mul_epi32(_mm_srli_epi64(vData, 32), _mm_srli_epi64(vCoefs, 32)));
+    }
+
+    _mm_storeu_si128((__m128i *)u64Acc, _mm_add_epi64(vAcc0, vAcc1));
+    iData[0]        = src_mrhf_fir_sat_extract(u64Acc[0] + u64Acc[1]);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_inner_loop_avx2                        //
+// Description:     As src_mrhf_fir_inner_loop_asm, 4 x 64 bit lanes    //
+// ==================================================================== //
+__attribute__((target("avx2")))
+void src_mrhf_fir_inner_loop_avx2(int *piData, int *piCoefs, int iData[], int count)
+{
+    int             iNTaps      = (count >> 3) << 4;
+    __m256i         vAcc0       = _mm256_setzero_si256();
+    __m256i         vAcc1       = _mm256_setzero_si256();
+    __m256i         vAcc2       = _mm256_setzero_si256();
+    __m256i         vAcc3       = _mm256_setzero_si256();
+    uint64_t        u64Acc[4];
+    int             i;
+
+    // Number of taps is always a multiple of 16, two vectors per iteration to hide the multiply latency
+    for(i = 0; i < iNTaps; i += 16)
+    {
+        __m256i     vData0      = _mm256_loadu_si256((const __m256i *)&piData[i]);
+        __m256i     vCoefs0     = _mm256_loadu_si256((const __m256i *)&piCoefs[i]);
+        __m256i     vData1      = _mm256_loadu_si256((const __m256i *)&piData[i + 8]);
+        __m256i     vCoefs1     = _mm256_loadu_si256((const __m256i *)&piCoefs[i + 8]);
+
+        vAcc0 = _mm256_add_epi64(vAcc0, _mm256_mul_epi32(vData0, vCoefs0));
+        vAcc1 = _mm256_add_epi64(vAcc1, _mm256_mul_epi32(_mm256_srli_epi64(vData0, 32), _mm256_srli_epi64(vCoefs0, 32)));
+        vAcc2 = _mm256_add_epi64(vAcc2, _mm256_mul_epi32(vData1, vCoefs1));
+        vAcc3 = _mm256_add_epi64(vAcc3, _mm256_mul_epi32(_mm256_srli_epi64(vData1, 32), _mm256_srli_epi64(vCoefs1, 32)));
+    }
+
+    vAcc0 = _mm256_add_epi64(_mm256_add_epi64(vAcc0, vAcc1), _mm256_add_epi64(vAcc2, vAcc3));
+    _mm256_storeu_si256((__m256i *)u64Acc, vAcc0);
+    iData[0]        = src_mrhf_fir_sat_extract(u64Acc[0] + u64Acc[1] + u64Acc[2] + u64Acc[3]);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_os_inner_loop_sse41                    //
+// Description:     As src_mrhf_fir_os_inner_loop_asm, 2 data per step  //
+// ==================================================================== //
+__attribute__((target("sse4.1")))
+void src_mrhf_fir_os_inner_loop_sse41(int *piData, int *piCoefs, int iData[], int count)
+{
+    int             iNData      = (count >> 2) << 3;
+    __m128i         vAccEven    = _mm_setzero_si128();
+    __m128i         vAccOdd     = _mm_setzero_si128();
+    uint64_t        u64Even[2], u64Odd[2];
+    int             i;
+
+    for(i = 0; i < iNData; i += 2)
+    {
+        // d[i], d[i+1] sign extended to 64 bits line up with the even coefficients c[2i], c[2i+2]
+        __m128i     vData       = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)&piData[i]));
+        __m128i     vCoefs      = _mm_loadu_si128((const __m128i *)&piCoefs[2*i]);
+
+        vAccEven = _mm_add_epi64(vAccEven, _mm_mul_epi32(vData, vCoefs));
+        vAccOdd  = _mm_add_epi64(vAccOdd, _mm_mul_epi32(vData, _mm_srli_epi64(vCoefs, 32)));
+    }
+
+    _mm_storeu_si128((__m128i *)u64Even, vAccEven);
+    _mm_storeu_si128((__m128i *)u64Odd, vAccOdd);
+    iData[1]        = src_mrhf_fir_sat_extract(u64Odd[0] + u64Odd[1]);
+    iData[0]        = src_mrhf_fir_sat_extract(u64Even[0] + u64Even[1]);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_os_inner_loop_avx2                     //
+// Description:     As src_mrhf_fir_os_inner_loop_asm, 4 data per step  //
+// ==================================================================== //
+__attribute__((target("avx2")))
+void src_mrhf_fir_os_inner_loop_avx2(int *piData, int *piCoefs, int iData[], int count)
+{
+    int             iNData      = (count >> 2) << 3;
+    __m256i         vAccEven0   = _mm256_setzero_si256();
+    __m256i         vAccOdd0    = _mm256_setzero_si256();
+    __m256i         vAccEven1   = _mm256_setzero_si256();
+    __m256i         vAccOdd1    = _mm256_setzero_si256();
+    uint64_t        u64Even[4], u64Odd[4];
+    int             i;
+
+    // Number of data is always a multiple of 8
+    for(i = 0; i < iNData; i += 8)
+    {
+        __m256i     vData0      = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&piData[i]));
+        __m256i     vCoefs0     = _mm256_loadu_si256((const __m256i *)&piCoefs[2*i]);
+        __m256i     vData1      = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&piData[i + 4]));
+        __m256i     vCoefs1     = _mm256_loadu_si256((const __m256i *)&piCoefs[2*i + 8]);
+
+        vAccEven0 = _mm256_add_epi64(vAccEven0, _mm256_mul_epi32(vData0, vCoefs0));
+        vAccOdd0  = _mm256_add_epi64(vAccOdd0, _mm256_mul_epi32(vData0, _mm256_srli_epi64(vCoefs0, 32)));
+        vAccEven1 = _mm256_add_epi64(vAccEven1, _mm256_mul_epi32(vData1, vCoefs1));
+        vAccOdd1  = _mm256_add_epi64(vAccOdd1, _mm256_mul_epi32(vData1, _mm256_srli_epi64(vCoefs1, 32)));
+    }
+
+    _mm256_storeu_si256((__m256i *)u64Even, _mm256_add_epi64(vAccEven0, vAccEven1));
+    _mm256_storeu_si256((__m256i *)u64Odd, _mm256_add_epi64(vAccOdd0, vAccOdd1));
+    iData[1]        = src_mrhf_fir_sat_extract(u64Odd[0] + u64Odd[1] + u64Odd[2] + u64Odd[3]);
+    iData[0]        = src_mrhf_fir_sat_extract(u64Even[0] + u64Even[1] + u64Even[2] + u64Even[3]);
+}
+
+#endif // !__xcore__ && x86
@@ -0,0 +1,70 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Over-sample by 2 FIR inner loop C implementation for non-xcore (host) targets.
+// Bit-exact with src_mrhf_fir_os_inner_loop_asm.S: two interleaved 32x32->64
+// MACCS accumulations followed by LSATS/LEXTRACT at bit 31.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+#include <stdint.h>
+
+#include "src_mrhf_int_arithmetic.h"
+#include "src_mrhf_fir_os_inner_loop_asm.h"
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_os_inner_loop_asm                      //
+// Arguments:       int *piData: Pointer to delay line                  //
+//                  int *piCoefs: Pointer to coefficients               //
+//                  int iData[]: Results (odd phase in iData[1],        //
+//                               even phase in iData[0])                //
+//                  int count: Number of 4-coef loops (multiple of 4)   //
+// Return values:   None                                                //
+// Description:     Computes two OS2 FIR output samples                 //
+// ==================================================================== //
+void src_mrhf_fir_os_inner_loop_asm(int *piData, int *piCoefs, int iData[], int count)
+{
+    // Wrapping 64 bit accumulation, as MACCS does not saturate
+    uint64_t        u64Acc0     = 0;
+    uint64_t        u64Acc1     = 0;
+    int             iNData      = (count >> 2) << 3;
+    long long       i64Acc;
+    int             i;
+
+    for(i = 0; i < iNData; i++)
+    {
+        u64Acc0 += (uint64_t)((long long)piData[i] * (long long)piCoefs[2*i + 1]);
+        u64Acc1 += (uint64_t)((long long)piData[i] * (long long)piCoefs[2*i]);
+    }
+
+    i64Acc = (long long)u64Acc0;
+    if(i64Acc > MAX_VAL64_30)
+        i64Acc = MAX_VAL64_30;
+    if(i64Acc < MIN_VAL64_30)
+        i64Acc = MIN_VAL64_30;
+    iData[1]        = (int)(i64Acc >> 31);
+
+    i64Acc = (long long)u64Acc1;
+    if(i64Acc > MAX_VAL64_30)
+        i64Acc = MAX_VAL64_30;
+    if(i64Acc < MIN_VAL64_30)
+        i64Acc = MIN_VAL64_30;
+    iData[0]        = (int)(i64Acc >> 31);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_fir_os_inner_loop_asm_odd                  //
+// Description:     As src_mrhf_fir_os_inner_loop_asm. The even/odd     //
+//                  split only matters for xcore double-word loads      //
+// ==================================================================== //
+void src_mrhf_fir_os_inner_loop_asm_odd(int *piData, int *piCoefs, int iData[], int count)
+{
+    src_mrhf_fir_os_inner_loop_asm(piData, piCoefs, iData, count);
+}
+
+#endif // !__xcore__
@@ -7,4 +7,10 @@ void src_mrhf_fir_os_inner_loop_asm_odd(int *piData, int *piCoefs, int iData[],
 void src_mrhf_fir_os_inner_loop_asm(int *piData, int *piCoefs, int iData[], int count);
 void src_mrhf_fir_os_inner_loop_asm_xs3(int *piData, int *piCoefs, int iData[], int count);
 
+#if !defined(__xcore__) && (defined(__x86_64__) || defined(__i386__))
+// x86 SIMD versions, only to be called when src_isa_detect() reports the extension
+void src_mrhf_fir_os_inner_loop_sse41(int *piData, int *piCoefs, int iData[], int count);
+void src_mrhf_fir_os_inner_loop_avx2(int *piData, int *piCoefs, int iData[], int count);
+#endif
+
 #endif // SRC_MRHF_FIR_OS_INNER_LOOP_ASM_H_
@@ -0,0 +1,161 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Run time detection of the instruction set extensions available to the
+// host (non-xcore) inner loops, and the kernel tables the FIR, ADFIR, PPFIR
+// and FF3 control blocks and the ASRC F3 stage are initialised from. The
+// voice functions have no control block and look theirs up at each call.
+// New SIMD backends are added to sKernels.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+#include "src_mrhf_isa.h"
+#include "src_mrhf_fir_inner_loop_asm.h"
+#include "src_mrhf_fir_os_inner_loop_asm.h"
+#include "src_mrhf_adfir_inner_loop_asm.h"
+#include "src_ff3_fir_inner_loop_asm.h"
+#include "src_mrhf_spline_coeff_gen_inner_loop_asm.h"
+#include "src_mrhf_fir_f32_inner_loop.h"
+#include "src_low_level.h"
+#include "src_ff3v_fir_impl.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define     SRC_ISA_X86(pfSSE41, pfAVX2, pfAVX512)      { pfSSE41, pfSSE41 }, { pfAVX2, pfAVX2 }, { pfAVX512, pfAVX512 }
+#endif
+
+// Kernel tables per kernel and ISA, indexed by SRC_ISA_PARITY(). A NULL entry means
+// that kernel has no implementation for that ISA, and the next lower ISA is used.
+static const SRCInnerLoop_t     sKernels[SRC_KERNEL_N][SRC_ISA_N][2] =
+{
+    [SRC_KERNEL_FIR] =
+    {
+        { src_mrhf_fir_inner_loop_asm, src_mrhf_fir_inner_loop_asm_odd },
+#if defined(__x86_64__) || defined(__i386__)
+        SRC_ISA_X86(src_mrhf_fir_inner_loop_sse41, src_mrhf_fir_inner_loop_avx2, 0)
+#endif
+    },
+    [SRC_KERNEL_FIR_OS] =
+    {
+        { src_mrhf_fir_os_inner_loop_asm, src_mrhf_fir_os_inner_loop_asm_odd },
+#if defined(__x86_64__) || defined(__i386__)
+        SRC_ISA_X86(src_mrhf_fir_os_inner_loop_sse41, src_mrhf_fir_os_inner_loop_avx2, 0)
+#endif
+    },
+    [SRC_KERNEL_ADFIR] =
+    {
+        { src_mrhf_adfir_inner_loop_asm, src_mrhf_adfir_inner_loop_asm_odd },
+    },
+    [SRC_KERNEL_FF3] =
+    {
+        { src_ff3_fir_inner_loop_asm, src_ff3_fir_inner_loop_asm_odd },
+    },
+    [SRC_KERNEL_SPLINE] =
+    {
+        // The phase table alignment does not matter here, both entries are the same
+        { src_mrhf_spline_coeff_gen_inner_loop_asm, src_mrhf_spline_coeff_gen_inner_loop_asm },
+#if defined(__x86_64__) || defined(__i386__)
+        SRC_ISA_X86(0, src_mrhf_spline_coeff_gen_inner_loop_avx2, src_mrhf_spline_coeff_gen_inner_loop_avx512)
+#endif
+    },
+};
+
+// Float32 kernels per ISA, a NULL entry falls back as above. These only come in one flavour
+// whatever the alignment of the delay line
+static const SRCKernelsF32_t    sKernelsF32[SRC_ISA_N] =
+{
+    [SRC_ISA_SCALAR]    = { src_mrhf_fir_f32_inner_loop, src_mrhf_fir_os_f32_inner_loop, src_mrhf_spline_coeff_gen_f32 },
+#if defined(__x86_64__) || defined(__i386__)
+    [SRC_ISA_AVX2]      = { src_mrhf_fir_f32_inner_loop_avx2, src_mrhf_fir_os_f32_inner_loop_avx2, src_mrhf_spline_coeff_gen_f32_avx2 },
+#endif
+};
+
+// Voice kernels per ISA, a NULL entry falls back as above
+static const SRCKernelsVoice_t  sKernelsVoice[SRC_ISA_N] =
+{
+    [SRC_ISA_SCALAR]    = { conv_s32_nt_c, src_ff3v_fir_dot_c },
+#if defined(__x86_64__) || defined(__i386__)
+    [SRC_ISA_AVX2]      = { conv_s32_nt_avx2, src_ff3v_fir_dot_avx2 },
+#endif
+};
+
+static SRCISA_t     eIsaLimit       = SRC_ISA_N;
+
+// Voice kernels for the current limit, resolved at the first call after a src_isa_force(). Racing
+// callers resolve the same entry, so relaxed atomics are enough
+static const SRCKernelsVoice_t*     psKernelsVoice  = 0;
+
+SRCISA_t src_isa_detect(void)
+{
+    SRCISA_t        eIsa            = SRC_ISA_SCALAR;
+
+#if defined(__x86_64__) || defined(__i386__)
+    // __builtin_cpu_supports() runs CPUID once, at constructor time, so this is cheap and thread safe
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2"))
+        eIsa = SRC_ISA_AVX512;
+    else if(__builtin_cpu_supports("avx2"))
+        eIsa = SRC_ISA_AVX2;
+    else if(__builtin_cpu_supports("sse4.1"))
+        eIsa = SRC_ISA_SSE41;
+#endif
+    return (eIsa < eIsaLimit) ? eIsa : eIsaLimit;
+}
+
+void src_isa_force(SRCISA_t eIsa)
+{
+    eIsaLimit = eIsa;
+    __atomic_store_n(&psKernelsVoice, 0, __ATOMIC_RELAXED);
+}
+
+SRCISA_t src_isa_get_kernels(SRCKernel_t eKernel, SRCInnerLoop_t pfInnerLoop[2])
+{
+    int             iIsa            = (int)src_isa_detect();
+
+    // Fall back to the best ISA this kernel has been implemented for, the scalar kernels always exist
+    while(sKernels[eKernel][iIsa][0] == 0)
+        iIsa--;
+    pfInnerLoop[0]      = sKernels[eKernel][iIsa][0];
+    pfInnerLoop[1]      = sKernels[eKernel][iIsa][1];
+
+    return (SRCISA_t)iIsa;
+}
+
+SRCISA_t src_isa_get_kernels_f32(SRCKernelsF32_t* psKernels)
+{
+    int             iIsa            = (int)src_isa_detect();
+
+#if defined(__x86_64__) || defined(__i386__)
+    // The AVX2 float kernels are built on FMA, which is a separate CPUID flag
+    if(iIsa >= SRC_ISA_AVX2 && !__builtin_cpu_supports("fma"))
+        iIsa = SRC_ISA_SSE41;
+#endif
+    while(sKernelsF32[iIsa].pfFir == 0)
+        iIsa--;
+    *psKernels          = sKernelsF32[iIsa];
+
+    return (SRCISA_t)iIsa;
+}
+
+const SRCKernelsVoice_t* src_isa_get_kernels_voice(void)
+{
+    const SRCKernelsVoice_t*    psKernels   = __atomic_load_n(&psKernelsVoice, __ATOMIC_RELAXED);
+    int                         iIsa;
+
+    if(psKernels == 0)
+    {
+        iIsa        = (int)src_isa_detect();
+        while(sKernelsVoice[iIsa].pfConvS32 == 0)
+            iIsa--;
+        psKernels   = &sKernelsVoice[iIsa];
+        __atomic_store_n(&psKernelsVoice, psKernels, __ATOMIC_RELAXED);
+    }
+
+    return psKernels;
+}
+
+#endif // !__xcore__
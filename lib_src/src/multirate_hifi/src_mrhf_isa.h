@@ -0,0 +1,111 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+#ifndef _SRC_MRHF_ISA_H_
+#define _SRC_MRHF_ISA_H_
+
+#include <stdint.h>
+
+    // Instruction set extensions the host (non-xcore) inner loops can use, in increasing order of preference.
+    // On xcore the assembly inner loops are always used and this is not relevant.
+    typedef enum _SRCISA
+    {
+        SRC_ISA_SCALAR            = 0,            // Portable C
+        SRC_ISA_SSE41             = 1,            // x86 SSE4.1
+        SRC_ISA_AVX2              = 2,            // x86 AVX2
+        SRC_ISA_AVX512            = 3,            // x86 AVX-512F (implies AVX2)
+        SRC_ISA_N                 = 4
+    } SRCISA_t;
+
+    // Inner loop kernels with a host kernel table
+    typedef enum _SRCKernel
+    {
+        SRC_KERNEL_FIR            = 0,            // src_mrhf_fir_inner_loop (FIR sync/DS2 and PPFIR)
+        SRC_KERNEL_FIR_OS         = 1,            // src_mrhf_fir_os_inner_loop (FIR OS2)
+        SRC_KERNEL_ADFIR          = 2,            // src_mrhf_adfir_inner_loop (ADFIR)
+        SRC_KERNEL_FF3            = 3,            // src_ff3_fir_inner_loop (DS3/OS3)
+        SRC_KERNEL_SPLINE         = 4,            // src_mrhf_spline_coeff_gen_inner_loop (ASRC F3 coefficients)
+        SRC_KERNEL_N              = 5
+    } SRCKernel_t;
+
+    // Inner loop kernel signature, shared by all the kernels above
+    typedef void (*SRCInnerLoop_t)(int *piData, int *piCoefs, int iData[], int count);
+
+    // Float32 kernels (host only, used by the float32 ASRC and SSRC). The tap counts are multiples of 8
+    typedef float (*SRCInnerLoopF32_t)(const float *pfData, const float *pfCoefs, unsigned uiNTaps);
+    typedef void (*SRCInnerLoopOSF32_t)(const float *pfData, const float *pfCoefs, float fData[2], unsigned uiNTaps);
+    typedef void (*SRCSplineF32_t)(const float *pfPhase0, const float fH[3], float *pfADCoefs);
+
+    typedef struct _SRCKernelsF32
+    {
+        SRCInnerLoopF32_t         pfFir;          // Dot product of uiNTaps data and coefficients (FIR sync/DS2, PPFIR and ADFIR)
+        SRCInnerLoopOSF32_t       pvFirOS;        // Two dot products of the same data, with the coefficients at pfCoefs and pfCoefs + uiNTaps (FIR OS2)
+        SRCSplineF32_t            pvSpline;       // ASRC F3 adaptive coefficients from three adjacent phases
+    } SRCKernelsF32_t;
+
+    // Voice kernels (host only): the VPU dot product behind src_low_level.h and the MACCS dot product
+    // of the XS2 voice DS3 and US3. These have no control block, so they are looked up at each call
+    typedef int32_t (*SRCConvS32_t)(const int32_t *piSamples, const int32_t *piCoefs, unsigned uiNTaps);
+    typedef int64_t (*SRCFF3VDot_t)(int64_t iSum, const int32_t iData[], const int32_t iCoefs[]);
+
+    typedef struct _SRCKernelsVoice
+    {
+        SRCConvS32_t              pfConvS32;      // VLMACCR rounded dot product of uiNTaps, a multiple of 8
+        SRCFF3VDot_t              pfFF3VDot;      // Wrapping 64 bit dot product of one phase of the voice FF3 filter
+    } SRCKernelsVoice_t;
+
+    // Index into a kernel table from the delay line pointer: 0 if double word aligned, 1 if not.
+    // This replaces the per call alignment test that picks the _odd variant of the xcore assembler.
+    #define SRC_ISA_PARITY(p)           ((((uintptr_t)(p)) >> 2) & 1)
+
+    // ==================================================================== //
+    // Function:        src_isa_detect                                      //
+    // Arguments:       None                                                //
+    // Return values:   Best instruction set extension supported by the CPU //
+    //                  and not above the src_isa_force() limit             //
+    // Description:     CPUID is only run once, by the compiler runtime     //
+    // ==================================================================== //
+    SRCISA_t src_isa_detect(void);
+
+    // ==================================================================== //
+    // Function:        src_isa_force                                       //
+    // Arguments:       SRCISA_t eIsa: Highest extension to use, or         //
+    //                                 SRC_ISA_N to remove the limit        //
+    // Return values:   None                                                //
+    // Description:     Limits the kernels picked by later init calls and   //
+    //                  by the voice functions, e.g. to benchmark or test a //
+    //                  specific backend. Not thread safe, call before      //
+    //                  initialising any instance                           //
+    // ==================================================================== //
+    void src_isa_force(SRCISA_t eIsa);
+
+    // ==================================================================== //
+    // Function:        src_isa_get_kernels                                 //
+    // Arguments:       SRCKernel_t eKernel: Kernel to look up              //
+    //                  SRCInnerLoop_t pfInnerLoop[2]: Table to fill,       //
+    //                                  indexed by SRC_ISA_PARITY()         //
+    // Return values:   ISA of the kernels written to the table             //
+    // Description:     Resolves the kernel table of a control block, for   //
+    //                  use by the init functions                           //
+    // ==================================================================== //
+    SRCISA_t src_isa_get_kernels(SRCKernel_t eKernel, SRCInnerLoop_t pfInnerLoop[2]);
+
+    // ==================================================================== //
+    // Function:        src_isa_get_kernels_f32                             //
+    // Arguments:       SRCKernelsF32_t *psKernels: Kernels to fill         //
+    // Return values:   ISA of the kernels written                          //
+    // Description:     As src_isa_get_kernels, for the float32 kernels.    //
+    //                  The AVX2 kernels also need FMA                      //
+    // ==================================================================== //
+    SRCISA_t src_isa_get_kernels_f32(SRCKernelsF32_t* psKernels);
+
+    // ==================================================================== //
+    // Function:        src_isa_get_kernels_voice                           //
+    // Arguments:       None                                                //
+    // Return values:   Voice kernels for the ISA src_isa_detect() gives    //
+    // Description:     Used by the voice functions at every call, so a     //
+    //                  later src_isa_force() applies to them at once. The  //
+    //                  kernels are resolved once per src_isa_force()       //
+    // ==================================================================== //
+    const SRCKernelsVoice_t* src_isa_get_kernels_voice(void);
+
+#endif // _SRC_MRHF_ISA_H_
@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+# Copyright 2024 XMOS LIMITED.
+# This Software is subject to the terms of the XMOS Public Licence: Version 1.
+#
+# Generates the minimum phase F1/F2 FIR and SSRC F3 PPFIR coefficient files
+# FilterData/*_mp.dat (and *_mp_xs3.dat for the OS2 filters) from the linear
+# phase ones, those of the low quality ASRC tier included, and the ASRC F3
+# phase tables FilterData/ADFirPhases_mp.dat and ADFirPhases_low_mp.dat (host
+# only) from a minimum phase version of the ADFIR prototype. They have the
+# same numbers of taps and the same magnitude responses, so they can replace
+# the linear phase filters of any rate pair. They are included by
+# src_mrhf_filter_defs.c, so run this again whenever a linear phase file
+# changes.
+#
+# The minimum phase filter is found by the folded real cepstrum of the
+# magnitude response. The coefficient files hold the taps in reverse time
+# order, as the inner loops take the delay line oldest sample first, and the
+# PPFIR files hold one row of taps per phase. The VPU OS2 files split each
+# block of 16 taps into its even and then its odd taps.
+import cmath
+import math
+import os.path
+
+from src_mrhf_adfir_phases_generator import build_phases, read_prototype, write_table as write_phases
+from src_mrhf_asrc_quality_generator import LOW_N_PHASES
+
+FFT_LENGTH = 65536
+MAGNITUDE_FLOOR = 1e-9      # Relative to the peak, in place of the zeros on the unit circle
+
+FIR_FILES = ["BL", "BL9644", "BL8848", "BLF", "BL19288", "BL17696", "UP", "UP4844", "UPF", "UP192176", "DS", "OS",
+             "BL_low", "BL9644_low", "BL8848_low", "BLF_low", "BL19288_low", "BL17696_low",
+             "UP_low", "UP4844_low", "UPF_low", "UP192176_low"]
+FIR_XS3_FILES = ["UP", "UP4844", "UPF", "UP192176", "OS"]
+PPFIR_FILES = {"HS294": 147, "HS320": 160}
+
+
+def read_table(path):
+    with open(path) as f:
+        return [int(c) for c in f.read().replace("\n", " ").split(",") if c.strip()]
+
+
+def write_table(path, coefs):
+    with open(path, "w") as f:
+        f.write("".join("    %d,\n" % c for c in coefs))
+
+
+def fft(x, inverse=False):
+    n = len(x)
+    a = list(x)
+    j = 0
+    for i in range(1, n):
+        bit = n >> 1
+        while j & bit:
+            j ^= bit
+            bit >>= 1
+        j |= bit
+        if i < j:
+            a[i], a[j] = a[j], a[i]
+    length = 2
+    while length <= n:
+        half = length // 2
+        w = [cmath.exp((2j if inverse else -2j) * math.pi * k / length) for k in range(half)]
+        for s in range(0, n, length):
+            for k in range(half):
+                u = a[s + k]
+                v = a[s + k + half] * w[k]
+                a[s + k] = u + v
+                a[s + k + half] = u - v
+        length <<= 1
+    if inverse:
+        a = [c / n for c in a]
+    return a
+
+
+def min_phase(h):
+    """Minimum phase filter of the same length and magnitude response as h, with the same DC gain"""
+    n = len(h)
+    spectrum = fft([float(c) for c in h] + [0.0] * (FFT_LENGTH - n))
+    floor = max(abs(c) for c in spectrum) * MAGNITUDE_FLOOR
+    cepstrum = [c.real for c in fft([math.log(max(abs(c), floor)) for c in spectrum], True)]
+    folded = [cepstrum[0]] + [2 * c for c in cepstrum[1:FFT_LENGTH // 2]] + [cepstrum[FFT_LENGTH // 2]]
+    folded += [0.0] * (FFT_LENGTH - len(folded))
+    h_mp = [c.real for c in fft([cmath.exp(c) for c in fft(folded)], True)][:n]
+    gain = sum(h) / sum(h_mp)
+    h_mp = [int(round(c * gain)) for c in h_mp]
+    assert max(abs(c) for c in h_mp) < 2**31
+    return h_mp
+
+
+def min_phase_coefs(coefs):
+    """Coefficients in reverse time order, as in the files"""
+    return min_phase(coefs[::-1])[::-1]
+
+
+def xs3_layout(coefs):
+    out = []
+    for k in range(0, len(coefs), 16):
+        out += coefs[k:k + 16:2] + coefs[k + 1:k + 16:2]
+    return out
+
+
+def ppfir_min_phase_coefs(coefs, n_phases):
+    n_taps = len(coefs) // n_phases
+    prototype = [0] * len(coefs)
+    for p in range(n_phases):
+        for t in range(n_taps):
+            prototype[t * n_phases + n_phases - 1 - p] = coefs[p * n_taps + t]
+    prototype = min_phase_coefs(prototype)
+    return [prototype[t * n_phases + n_phases - 1 - p] for p in range(n_phases) for t in range(n_taps)]
+
+
+if __name__ == "__main__":
+    data_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "FilterData")
+
+    for name in FIR_FILES:
+        coefs = min_phase_coefs(read_table(os.path.join(data_dir, name + ".dat")))
+        write_table(os.path.join(data_dir, name + "_mp.dat"), coefs)
+        if name in FIR_XS3_FILES:
+            write_table(os.path.join(data_dir, name + "_mp_xs3.dat"), xs3_layout(coefs))
+
+    for name, n_phases in PPFIR_FILES.items():
+        coefs = ppfir_min_phase_coefs(read_table(os.path.join(data_dir, name + ".dat")), n_phases)
+        write_table(os.path.join(data_dir, name + "_mp.dat"), coefs)
+
+    # The ADFIR prototype is in time order, as build_phases() reads it. The low tier takes every other
+    # tap of the prototype, as the linear phase one
+    prototype = min_phase(read_prototype(os.path.join(data_dir, "ADFir.dat")))
+    write_phases(os.path.join(data_dir, "ADFirPhases_mp.dat"), build_phases(prototype))
+    write_phases(os.path.join(data_dir, "ADFirPhases_low_mp.dat"), build_phases(prototype[::2], LOW_N_PHASES))
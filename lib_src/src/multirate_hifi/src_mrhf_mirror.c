@@ -0,0 +1,173 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Mirrored ring buffers for the host delay lines: a memfd is mapped twice
+// into an address range reserved for both copies. Where memfd_create() is
+// not available the functions fail and the delay lines stay as they are.
+// The rings that are mapped are listed, so that an init can unmap a ring
+// its control block was left with without trusting a stale pointer.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+#if defined(__linux__)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <sys/mman.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdlib.h>
+#endif
+#include <string.h>
+#include <stdint.h>
+
+#include "src_mrhf_mirror.h"
+
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+// A mapped ring, in the list of rings
+typedef struct _SRCMirrorRing
+{
+    int*                        piRing;         // Base of the ring
+    unsigned int                uiLength;       // Its ring length R
+    struct _SRCMirrorRing*      psNext;
+} SRCMirrorRing_t;
+
+static SRCMirrorRing_t*         psRings         = 0;
+static pthread_mutex_t          sRingsMutex     = PTHREAD_MUTEX_INITIALIZER;
+
+// Unlinks a ring from the list, returns its length or 0 if it is not a mapped ring
+static unsigned int src_mirror_unlink(int* piRing)
+{
+    SRCMirrorRing_t**   ppsRing;
+    SRCMirrorRing_t*    psRing;
+    unsigned int        uiLength    = 0;
+
+    pthread_mutex_lock(&sRingsMutex);
+    for(ppsRing = &psRings; *ppsRing != 0; ppsRing = &(*ppsRing)->psNext)
+        if((*ppsRing)->piRing == piRing)
+        {
+            psRing      = *ppsRing;
+            uiLength    = psRing->uiLength;
+            *ppsRing    = psRing->psNext;
+            free(psRing);
+            break;
+        }
+    pthread_mutex_unlock(&sRingsMutex);
+
+    return uiLength;
+}
+
+static int* src_mirror_map(unsigned int uiMinLength, unsigned int* puiLength)
+{
+    size_t          uiPage      = (size_t)sysconf(_SC_PAGESIZE);
+    size_t          uiBytes     = ((uiMinLength * sizeof(int) + uiPage - 1) / uiPage) * uiPage;
+    uint8_t*        pucBase;
+    SRCMirrorRing_t* psRing;
+    int             iFd;
+
+    iFd = memfd_create("lib_src_delay", MFD_CLOEXEC);
+    if(iFd < 0)
+        return 0;
+    if(ftruncate(iFd, (off_t)uiBytes) != 0)
+    {
+        close(iFd);
+        return 0;
+    }
+
+    // Reserve both copies, then map the memfd over each half
+    pucBase = mmap(0, 2 * uiBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(pucBase == MAP_FAILED)
+    {
+        close(iFd);
+        return 0;
+    }
+    if((mmap(pucBase, uiBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFd, 0) == MAP_FAILED) ||
+       (mmap(pucBase + uiBytes, uiBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFd, 0) == MAP_FAILED))
+    {
+        munmap(pucBase, 2 * uiBytes);
+        close(iFd);
+        return 0;
+    }
+    // The mappings keep the pages alive
+    close(iFd);
+
+    psRing = malloc(sizeof(SRCMirrorRing_t));
+    if(psRing == 0)
+    {
+        munmap(pucBase, 2 * uiBytes);
+        return 0;
+    }
+    psRing->piRing      = (int*)pucBase;
+    psRing->uiLength    = (unsigned int)(uiBytes / sizeof(int));
+    pthread_mutex_lock(&sRingsMutex);
+    psRing->psNext      = psRings;
+    psRings             = psRing;
+    pthread_mutex_unlock(&sRingsMutex);
+
+    *puiLength  = psRing->uiLength;
+    return (int*)pucBase;
+}
+
+static void src_mirror_unmap(int* piRing, unsigned int uiLength)
+{
+    (void)uiLength;
+    src_mirror_release(piRing);
+}
+
+int src_mirror_release(int* piRing)
+{
+    unsigned int        uiLength    = src_mirror_unlink(piRing);
+
+    if(uiLength == 0)
+        return 0;
+    munmap(piRing, 2 * (size_t)uiLength * sizeof(int));
+    return 1;
+}
+#else
+static int* src_mirror_map(unsigned int uiMinLength, unsigned int* puiLength)
+{
+    (void)uiMinLength;
+    (void)puiLength;
+    return 0;
+}
+
+static void src_mirror_unmap(int* piRing, unsigned int uiLength)
+{
+    (void)piRing;
+    (void)uiLength;
+}
+
+int src_mirror_release(int* piRing)
+{
+    (void)piRing;
+    return 0;
+}
+#endif
+
+int* src_mirror_delay_line(int* piDelayI, unsigned int uiRingLength, unsigned int* puiLength)
+{
+    int*            piRing      = src_mirror_map(uiRingLength, puiLength);
+
+    if(piRing == 0)
+        return 0;
+
+    // The taps go to the start of the ring, the rest of it is only read after it has been written
+    memcpy(piRing, piDelayI, uiRingLength * sizeof(int));
+
+    return piRing;
+}
+
+void src_unmirror_delay_line(int* piRing, unsigned int uiLength, int* piDelayI, unsigned int uiRingLength, int* piDelayB)
+{
+    memcpy(piDelayB, piDelayI, uiRingLength * sizeof(int));
+    memcpy(piDelayB + uiRingLength, piDelayI, uiRingLength * sizeof(int));
+
+    src_mirror_unmap(piRing, uiLength);
+}
+
+#endif // !__xcore__
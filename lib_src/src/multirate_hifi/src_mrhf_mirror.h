@@ -0,0 +1,57 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+#ifndef _SRC_MRHF_MIRROR_H_
+#define _SRC_MRHF_MIRROR_H_
+
+    // Mirrored ring buffers for the host (non-xcore) delay lines. The same pages are mapped twice,
+    // back to back, so a filter reads its taps linearly across the wrap and each input sample is
+    // written once rather than twice. On xcore, and on hosts without memfd_create(), the delay
+    // lines keep the double write circular buffer simulation.
+    //
+    // A double write delay line of ring length N (the uiDelayO / delay_offset of its control
+    // block) has its taps, oldest first, at [piDelayI, piDelayI + N) and writes the next sample
+    // at piDelayI and piDelayI + N. A mirrored ring of length R >= N keeps exactly that: the
+    // sample is written at piDelayI + N only (which is also piDelayI + N - R), piDelayI wraps at
+    // R rather than N, and the taps are still at [piDelayI, piDelayI + N).
+
+    // ==================================================================== //
+    // Function:        src_mirror_delay_line                               //
+    // Arguments:       int *piDelayI: Taps of the double write delay line  //
+    //                  unsigned int uiRingLength: Its ring length N        //
+    //                  unsigned int *puiLength: Ring length R of the       //
+    //                                  mirrored ring, a whole number of    //
+    //                                  pages                               //
+    // Return values:   Base of the mirrored ring, or 0 if mirrored         //
+    //                  mappings are not available                          //
+    // Description:     Maps a mirrored ring and copies the taps to its     //
+    //                  start, so the delay line continues at the base      //
+    // ==================================================================== //
+    int*    src_mirror_delay_line(int* piDelayI, unsigned int uiRingLength, unsigned int* puiLength);
+
+    // ==================================================================== //
+    // Function:        src_unmirror_delay_line                             //
+    // Arguments:       int *piRing: Base of the mirrored ring              //
+    //                  unsigned int uiLength: Its ring length R            //
+    //                  int *piDelayI: Taps in the mirrored ring            //
+    //                  unsigned int uiRingLength: Ring length N            //
+    //                  int *piDelayB: Double write delay line, 2N words    //
+    // Return values:   None                                                //
+    // Description:     Copies the taps back twice, so the double write     //
+    //                  delay line continues at piDelayB, then unmaps the   //
+    //                  mirrored ring                                       //
+    // ==================================================================== //
+    void    src_unmirror_delay_line(int* piRing, unsigned int uiLength, int* piDelayI, unsigned int uiRingLength, int* piDelayB);
+
+    // ==================================================================== //
+    // Function:        src_mirror_release                                  //
+    // Arguments:       int *piRing: Base of a mirrored ring, or any other  //
+    //                                  pointer                             //
+    // Return values:   1 if piRing was a mapped ring, 0 if not             //
+    // Description:     Unmaps the ring, without copying its taps back. The //
+    //                  inits call it for the ring a control block was left //
+    //                  with, which may be a stale pointer: only rings that //
+    //                  are mapped are unmapped                             //
+    // ==================================================================== //
+    int     src_mirror_release(int* piRing);
+
+#endif // _SRC_MRHF_MIRROR_H_
@@ -0,0 +1,46 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// ADFIR spline coefficient generation C implementation for non-xcore (host)
+// targets. Bit-exact with src_mrhf_spline_coeff_gen_inner_loop_asm.S: three
+// 32x32->64 MACCS per tap, keeping the top 32 bits without saturation.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+#include <stdint.h>
+
+#include "src_mrhf_spline_coeff_gen_inner_loop_asm.h"
+
+#define     SRC_MRHF_SPLINE_N_TAPS      16      // Hard coded in the asm version too
+
+// ==================================================================== //
+// Function:        src_mrhf_spline_coeff_gen_inner_loop_asm            //
+// Arguments:       int *piPhase0: First of three adjacent phases       //
+//                  int *iH: Spline weights (iH[2] applies to phase 0)  //
+//                  int *piADCoefs: Adaptive coefficients (output)      //
+//                  const int n_taps: Stride between phases             //
+// Return values:   None                                                //
+// Description:     Builds the 16 adaptive filter coefficients          //
+// ==================================================================== //
+void src_mrhf_spline_coeff_gen_inner_loop_asm(int *piPhase0, int *iH, int* piADCoefs, const int n_taps)
+{
+    int*            piPhase1    = piPhase0 + n_taps;
+    int*            piPhase2    = piPhase1 + n_taps;
+    uint64_t        u64Acc;
+    int             i;
+
+    for(i = 0; i < SRC_MRHF_SPLINE_N_TAPS; i++)
+    {
+        u64Acc  = (uint64_t)((long long)iH[2] * (long long)piPhase0[i]);
+        u64Acc += (uint64_t)((long long)iH[1] * (long long)piPhase1[i]);
+        u64Acc += (uint64_t)((long long)iH[0] * (long long)piPhase2[i]);
+        piADCoefs[i]    = (int)((long long)u64Acc >> 32);
+    }
+}
+
+#endif // !__xcore__
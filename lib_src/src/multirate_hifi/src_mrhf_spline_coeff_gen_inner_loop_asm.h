@@ -6,4 +6,10 @@
 void src_mrhf_spline_coeff_gen_inner_loop_asm(int *piPhase0, int *iH, int* piADCoefs, const int n_taps);
 void src_mrhf_spline_coeff_gen_inner_loop_asm_xs3(int *piPhase0, int *iH, int* piADCoefs, const int n_taps);
 
+#if !defined(__xcore__) && (defined(__x86_64__) || defined(__i386__))
+// x86 versions, only to be called when src_isa_detect() reports the corresponding ISA
+void src_mrhf_spline_coeff_gen_inner_loop_avx2(int *piPhase0, int *iH, int* piADCoefs, const int n_taps);
+void src_mrhf_spline_coeff_gen_inner_loop_avx512(int *piPhase0, int *iH, int* piADCoefs, const int n_taps);
+#endif
+
 #endif // SRC_MRHF_SPLINE_COEFF_GEN_INNER_LOOP_ASM_H_
@@ -0,0 +1,89 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// AVX2 and AVX-512 ADFIR spline coefficient generation for x86 hosts.
+// The 16 taps of each phase are one ZMM (two YMM) register. PMULDQ gives
+// the 64 bit products of the even taps, the odd taps are shifted down for a
+// second product, and the top words of the sums are blended back into tap
+// order. Bit-exact with src_mrhf_spline_coeff_gen_inner_loop.c.
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "src_mrhf_spline_coeff_gen_inner_loop_asm.h"
+
+// Top 32 bits of iH2 * p0 + iH1 * p1 + iH0 * p2 for 8 taps
+__attribute__((target("avx2")))
+static inline __m256i spline_8_avx2(const int *piPhase0, int n_taps, __m256i vH2, __m256i vH1, __m256i vH0)
+{
+    __m256i         vP0     = _mm256_loadu_si256((const __m256i *)piPhase0);
+    __m256i         vP1     = _mm256_loadu_si256((const __m256i *)(piPhase0 + n_taps));
+    __m256i         vP2     = _mm256_loadu_si256((const __m256i *)(piPhase0 + 2 * n_taps));
+    __m256i         vEven, vOdd;
+
+    vEven   = _mm256_mul_epi32(vP0, vH2);
+    vEven   = _mm256_add_epi64(vEven, _mm256_mul_epi32(vP1, vH1));
+    vEven   = _mm256_add_epi64(vEven, _mm256_mul_epi32(vP2, vH0));
+    vOdd    = _mm256_mul_epi32(_mm256_srli_epi64(vP0, 32), vH2);
+    vOdd    = _mm256_add_epi64(vOdd, _mm256_mul_epi32(_mm256_srli_epi64(vP1, 32), vH1));
+    vOdd    = _mm256_add_epi64(vOdd, _mm256_mul_epi32(_mm256_srli_epi64(vP2, 32), vH0));
+
+    return _mm256_blend_epi32(_mm256_srli_epi64(vEven, 32), vOdd, 0xAA);
+}
+
+__attribute__((target("avx512f")))
+static inline __m512i spline_16_avx512(const int *piPhase0, int n_taps, __m512i vH2, __m512i vH1, __m512i vH0)
+{
+    __m512i         vP0     = _mm512_loadu_si512((const void *)piPhase0);
+    __m512i         vP1     = _mm512_loadu_si512((const void *)(piPhase0 + n_taps));
+    __m512i         vP2     = _mm512_loadu_si512((const void *)(piPhase0 + 2 * n_taps));
+    __m512i         vEven, vOdd;
+
+    vEven   = _mm512_mul_epi32(vP0, vH2);
+    vEven   = _mm512_add_epi64(vEven, _mm512_mul_epi32(vP1, vH1));
+    vEven   = _mm512_add_epi64(vEven, _mm512_mul_epi32(vP2, vH0));
+    vOdd    = _mm512_mul_epi32(_mm512_srli_epi64(vP0, 32), vH2);
+    vOdd    = _mm512_add_epi64(vOdd, _mm512_mul_epi32(_mm512_srli_epi64(vP1, 32), vH1));
+    vOdd    = _mm512_add_epi64(vOdd, _mm512_mul_epi32(_mm512_srli_epi64(vP2, 32), vH0));
+
+    return _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(vEven, 32), vOdd);
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_spline_coeff_gen_inner_loop_avx2           //
+// Arguments:       As src_mrhf_spline_coeff_gen_inner_loop_asm         //
+// Return values:   None                                                //
+// Description:     Builds the 16 adaptive filter coefficients          //
+// ==================================================================== //
+__attribute__((target("avx2")))
+void src_mrhf_spline_coeff_gen_inner_loop_avx2(int *piPhase0, int *iH, int* piADCoefs, const int n_taps)
+{
+    __m256i         vH2     = _mm256_set1_epi32(iH[2]);
+    __m256i         vH1     = _mm256_set1_epi32(iH[1]);
+    __m256i         vH0     = _mm256_set1_epi32(iH[0]);
+
+    _mm256_storeu_si256((__m256i *)piADCoefs,       spline_8_avx2(piPhase0,     n_taps, vH2, vH1, vH0));
+    _mm256_storeu_si256((__m256i *)(piADCoefs + 8), spline_8_avx2(piPhase0 + 8, n_taps, vH2, vH1, vH0));
+}
+
+// ==================================================================== //
+// Function:        src_mrhf_spline_coeff_gen_inner_loop_avx512         //
+// Arguments:       As src_mrhf_spline_coeff_gen_inner_loop_asm         //
+// Return values:   None                                                //
+// Description:     Builds the 16 adaptive filter coefficients          //
+// ==================================================================== //
+__attribute__((target("avx512f")))
+void src_mrhf_spline_coeff_gen_inner_loop_avx512(int *piPhase0, int *iH, int* piADCoefs, const int n_taps)
+{
+    _mm512_storeu_si512((void *)piADCoefs, spline_16_avx512(piPhase0, n_taps,
+                        _mm512_set1_epi32(iH[2]), _mm512_set1_epi32(iH[1]), _mm512_set1_epi32(iH[0])));
+}
+
+#endif // !__xcore__ && x86
@@ -24,7 +24,9 @@
 // Integer arithmetic include
 #include "src_mrhf_int_arithmetic.h"
 // XMOS built in functions
+#ifdef __xcore__
 #include <xs1.h>
+#endif
 // SSRC include
 #include "src.h"
 
@@ -159,8 +161,8 @@ SSRCReturnCodes_t                SSRC_init(ssrc_ctrl_t* pssrc_ctrl)
     PPFIRDescriptor_t*            psPPFIRDescriptor;
 
 
-    // Check if state is allocated
-    if(pssrc_ctrl->psState == 0)
+    // Check if state is allocated, unless the delay lines come from an arena
+    if((pssrc_ctrl->psState == 0) && (pssrc_ctrl->piDelays == 0))
         return SSRC_ERROR;
 
     // Check if stack is allocated
@@ -192,7 +194,9 @@ SSRCReturnCodes_t                SSRC_init(ssrc_ctrl_t* pssrc_ctrl)
     pssrc_ctrl->sFIRF1Ctrl.uiInStep            = pssrc_ctrl->uiNchannels;
 
     // Set delay line base pointer
-    if( (psFiltersID->uiFID[SSRC_F1_INDEX] == FILTER_DEFS_SSRC_FIR_DS_ID) || (psFiltersID->uiFID[SSRC_F1_INDEX] == FILTER_DEFS_SSRC_FIR_OS_ID) )
+    if( pssrc_ctrl->piDelays != 0 )
+        pssrc_ctrl->sFIRF1Ctrl.piDelayB        = pssrc_ctrl->piDelays;
+    else if( (psFiltersID->uiFID[SSRC_F1_INDEX] == FILTER_DEFS_SSRC_FIR_DS_ID) || (psFiltersID->uiFID[SSRC_F1_INDEX] == FILTER_DEFS_SSRC_FIR_OS_ID) )
         pssrc_ctrl->sFIRF1Ctrl.piDelayB        = pssrc_ctrl->psState->iDelayFIRShort;
     else
         pssrc_ctrl->sFIRF1Ctrl.piDelayB        = pssrc_ctrl->psState->iDelayFIRLong;
@@ -218,7 +222,9 @@ SSRCReturnCodes_t                SSRC_init(ssrc_ctrl_t* pssrc_ctrl)
     pssrc_ctrl->sFIRF2Ctrl.uiInStep            = pssrc_ctrl->sFIRF1Ctrl.uiOutStep;
 
     // Set delay line base pointer
-    if( (psFiltersID->uiFID[SSRC_F2_INDEX] == FILTER_DEFS_SSRC_FIR_DS_ID) || (psFiltersID->uiFID[SSRC_F2_INDEX] == FILTER_DEFS_SSRC_FIR_OS_ID) )
+    if( pssrc_ctrl->piDelays != 0 )
+        pssrc_ctrl->sFIRF2Ctrl.piDelayB        = pssrc_ctrl->sFIRF1Ctrl.piDelayB + FIR_delay_length(&sSSRCFirDescriptor[psFiltersID->uiFID[SSRC_F1_INDEX]]);
+    else if( (psFiltersID->uiFID[SSRC_F2_INDEX] == FILTER_DEFS_SSRC_FIR_DS_ID) || (psFiltersID->uiFID[SSRC_F2_INDEX] == FILTER_DEFS_SSRC_FIR_OS_ID) )
         pssrc_ctrl->sFIRF2Ctrl.piDelayB        = pssrc_ctrl->psState->iDelayFIRShort;
     else
         pssrc_ctrl->sFIRF2Ctrl.piDelayB        = pssrc_ctrl->psState->iDelayFIRLong;
@@ -242,8 +248,17 @@ SSRCReturnCodes_t                SSRC_init(ssrc_ctrl_t* pssrc_ctrl)
         pssrc_ctrl->sPPFIRF3Ctrl.uiNInSamples    = pssrc_ctrl->sFIRF2Ctrl.uiNOutSamples;
     pssrc_ctrl->sPPFIRF3Ctrl.uiInStep        = pssrc_ctrl->sFIRF2Ctrl.uiOutStep;
 
-    // Set delay line base pointer
-    pssrc_ctrl->sPPFIRF3Ctrl.piDelayB        = pssrc_ctrl->psState->iDelayPPFIR;
+    // Set delay line base pointer, the dither seed follows the delay lines of an arena
+    if( pssrc_ctrl->piDelays != 0 )
+    {
+        pssrc_ctrl->sPPFIRF3Ctrl.piDelayB        = pssrc_ctrl->sFIRF2Ctrl.piDelayB + FIR_delay_length(psFIRDescriptor);
+        pssrc_ctrl->puiRndSeed                   = (unsigned int*)(pssrc_ctrl->sPPFIRF3Ctrl.piDelayB + PPFIR_delay_length(psPPFIRDescriptor));
+    }
+    else
+    {
+        pssrc_ctrl->sPPFIRF3Ctrl.piDelayB        = pssrc_ctrl->psState->iDelayPPFIR;
+        pssrc_ctrl->puiRndSeed                   = &pssrc_ctrl->psState->uiRndSeed;
+    }
 
     // Set output buffer step
     pssrc_ctrl->sPPFIRF3Ctrl.uiOutStep        = pssrc_ctrl->uiNchannels;
@@ -300,6 +315,11 @@ SSRCReturnCodes_t                SSRC_init(ssrc_ctrl_t* pssrc_ctrl)
         }
     }
 
+#ifndef __xcore__
+    // Interleaved input and output buffers
+    pssrc_ctrl->uiIOStep                = pssrc_ctrl->uiNchannels;
+#endif
+
     // Call sync function
     if(SSRC_sync(pssrc_ctrl) != SSRC_NO_ERROR)
         return SSRC_ERROR;
@@ -308,6 +328,91 @@ SSRCReturnCodes_t                SSRC_init(ssrc_ctrl_t* pssrc_ctrl)
 }
 
 
+#ifndef __xcore__
+// ==================================================================== //
+// Function:        SSRC_set_io_step                                    //
+// Arguments:       ssrc_ctrl_t *pssrc_ctrl: Ctrl strct.                //
+//                  unsigned int uiIOStep: Sample step in the input and //
+//                               output buffers                         //
+// Return values:   None                                                //
+// Description:     Sets the input and output sample step of the SSRC   //
+// ==================================================================== //
+void                            SSRC_set_io_step(ssrc_ctrl_t* pssrc_ctrl, unsigned int uiIOStep)
+{
+    pssrc_ctrl->uiIOStep                = uiIOStep;
+    pssrc_ctrl->sFIRF1Ctrl.uiInStep     = uiIOStep;
+
+    // Steps between the filters are on the stack and stay as they are
+    if(pssrc_ctrl->ppiOut == &pssrc_ctrl->sPPFIRF3Ctrl.piOut)
+        pssrc_ctrl->sPPFIRF3Ctrl.uiOutStep  = uiIOStep;
+    else if(pssrc_ctrl->ppiOut == &pssrc_ctrl->sFIRF2Ctrl.piOut)
+        pssrc_ctrl->sFIRF2Ctrl.uiOutStep    = uiIOStep;
+    else
+        pssrc_ctrl->sFIRF1Ctrl.uiOutStep    = uiIOStep;
+}
+#endif
+
+
+// ==================================================================== //
+// Function:        SSRC_arena_length                                   //
+// Arguments:       ssrc_ctrl_t *pssrc_ctrl: Ctrl strct.                //
+//                  unsigned int *puiStackLength: Stack words           //
+// Return values:   Arena words of the channel, 0 on failure            //
+// Description:     Length of the stack, delay lines and dither seed    //
+//                  of a channel for its filters                        //
+// ==================================================================== //
+unsigned int                    SSRC_arena_length(ssrc_ctrl_t* pssrc_ctrl, unsigned int* puiStackLength)
+{
+    SSRCFiltersIDs_t*           psFiltersID;
+    FIRDescriptor_t*            psF1Descriptor;
+    FIRDescriptor_t*            psF2Descriptor;
+    unsigned int                uiF1OutStep, uiNF1OutSamples, uiNF2OutSamples;
+
+    if( (pssrc_ctrl->eInFs < SSRC_FS_MIN) || (pssrc_ctrl->eInFs > SSRC_FS_MAX))
+        return 0;
+    if( (pssrc_ctrl->eOutFs < SSRC_FS_MIN) || (pssrc_ctrl->eOutFs > SSRC_FS_MAX))
+        return 0;
+    psFiltersID         = &sFiltersIDs[pssrc_ctrl->eInFs][pssrc_ctrl->eOutFs];
+    psF1Descriptor      = &sSSRCFirDescriptor[psFiltersID->uiFID[SSRC_F1_INDEX]];
+    psF2Descriptor      = &sSSRCFirDescriptor[psFiltersID->uiFID[SSRC_F2_INDEX]];
+
+    // F1 and F2 write the stack with a step of uiNchannels, F1 with twice that if F2 over-samples. Padded to 64 bits
+    uiF1OutStep         = (psFiltersID->uiFID[SSRC_F2_INDEX] == FILTER_DEFS_SSRC_FIR_OS_ID) ? 2 * pssrc_ctrl->uiNchannels : pssrc_ctrl->uiNchannels;
+    uiNF1OutSamples     = (psF1Descriptor->uiNCoefs != 0) ? FIR_n_out_samples(psF1Descriptor, pssrc_ctrl->uiNInSamples) : 0;
+    uiNF2OutSamples     = (psF2Descriptor->uiNCoefs != 0) ? FIR_n_out_samples(psF2Descriptor, uiNF1OutSamples) : 0;
+    *puiStackLength     = uiNF1OutSamples * uiF1OutStep;
+    if(uiNF2OutSamples * pssrc_ctrl->uiNchannels > *puiStackLength)
+        *puiStackLength = uiNF2OutSamples * pssrc_ctrl->uiNchannels;
+    *puiStackLength     = (*puiStackLength + 1) & ~1;
+
+    // The delay lines have even lengths, the dither seed is padded to 64 bits
+    return *puiStackLength + FIR_delay_length(psF1Descriptor) + FIR_delay_length(psF2Descriptor) +
+           PPFIR_delay_length(&sPPFirDescriptor[psFiltersID->uiFID[SSRC_F3_INDEX]]) + 2;
+}
+
+
+// ==================================================================== //
+// Function:        SSRC_set_min_phase                                  //
+// Arguments:       ssrc_ctrl_t *pssrc_ctrl: Ctrl strct.                //
+//                  unsigned int uiMinPhase: 1 for the minimum phase    //
+//                               filters, 0 for the linear phase ones   //
+// Return values:   None                                                //
+// Description:     Selects the coefficients of the F1, F2 and F3       //
+//                  filters of an initialized SSRC. The minimum phase   //
+//                  filters have the same numbers of taps               //
+// ==================================================================== //
+void                            SSRC_set_min_phase(ssrc_ctrl_t* pssrc_ctrl, unsigned int uiMinPhase)
+{
+    SSRCFiltersIDs_t*           psFiltersID     = &sFiltersIDs[pssrc_ctrl->eInFs][pssrc_ctrl->eOutFs];
+    FIRDescriptor_t*            psFIRDescriptors    = uiMinPhase ? sSSRCFirMPDescriptor : sSSRCFirDescriptor;
+    PPFIRDescriptor_t*          psPPFIRDescriptors  = uiMinPhase ? sPPFirMPDescriptor : sPPFirDescriptor;
+
+    pssrc_ctrl->sFIRF1Ctrl.piCoefs      = psFIRDescriptors[psFiltersID->uiFID[SSRC_F1_INDEX]].piCoefs;
+    pssrc_ctrl->sFIRF2Ctrl.piCoefs      = psFIRDescriptors[psFiltersID->uiFID[SSRC_F2_INDEX]].piCoefs;
+    pssrc_ctrl->sPPFIRF3Ctrl.piCoefs    = psPPFIRDescriptors[psFiltersID->uiFID[SSRC_F3_INDEX]].piCoefs;
+}
+
+
 // ==================================================================== //
 // Function:        SSRC_sync                                            //
 // Arguments:        ssrc_ctrl_t     *pssrc_ctrl: Ctrl strct.                //
@@ -326,7 +431,7 @@ SSRCReturnCodes_t                SSRC_sync(ssrc_ctrl_t* pssrc_ctrl)
         return SSRC_ERROR;
 
     // Reset random seeds to initial values
-    pssrc_ctrl->psState->uiRndSeed    = pssrc_ctrl->uiRndSeedInit;
+    *pssrc_ctrl->puiRndSeed    = pssrc_ctrl->uiRndSeedInit;
 
     return SSRC_NO_ERROR;
 }
@@ -339,7 +444,7 @@ SSRCReturnCodes_t                SSRC_sync(ssrc_ctrl_t* pssrc_ctrl)
 //                    SSRC_ERROR on failure                                //
 // Description:        Processes the SSRC passed as argument                //
 // ==================================================================== //
-#if (XCC_VERSION_MAJOR < 1402) //Beyond 14.2.0 we have proper function pointer support for C
+#if defined(__xcore__) && (XCC_VERSION_MAJOR < 1402) //Beyond 14.2.0 we have proper function pointer support for C
 #pragma stackfunction 64  //Generous stack allocation (probably needs just a handful through F1_F2, ASM etc).
 #endif
 SSRCReturnCodes_t                SSRC_proc(ssrc_ctrl_t* pssrc_ctrl)
@@ -386,14 +491,14 @@ SSRCReturnCodes_t                SSRC_proc_F1_F2(ssrc_ctrl_t* pssrc_ctrl)
     if(pssrc_ctrl->sFIRF1Ctrl.eEnable == FIR_OFF)
     {
         // F1 is not enabled, which means that we are in 1:1 rate, so just copy input to output
-        for(ui = 0; ui < pssrc_ctrl->uiNInSamples * pssrc_ctrl->uiNchannels; ui+= pssrc_ctrl->uiNchannels)
+        for(ui = 0; ui < pssrc_ctrl->uiNInSamples * SSRC_IO_STEP(pssrc_ctrl); ui+= SSRC_IO_STEP(pssrc_ctrl))
             piOut[ui]        = piIn[ui];
 
         return SSRC_NO_ERROR;
     }
 
     // F1 is enabled, so call F1
-    __attribute__((fptrgroup("MRHF_G1")))
+    MRHF_FPTRGROUP
     FIRReturnCodes_t ret = pssrc_ctrl->sFIRF1Ctrl.pvProc((int *)&pssrc_ctrl->sFIRF1Ctrl);
     if(ret != FIR_NO_ERROR)
         return SSRC_ERROR;
@@ -403,7 +508,7 @@ SSRCReturnCodes_t                SSRC_proc_F1_F2(ssrc_ctrl_t* pssrc_ctrl)
     if(pssrc_ctrl->sFIRF2Ctrl.eEnable == FIR_ON)
     {
         // F2 is enabled, so call F2
-        __attribute__((fptrgroup("MRHF_G1")))
+        MRHF_FPTRGROUP
         FIRReturnCodes_t ret = pssrc_ctrl->sFIRF2Ctrl.pvProc((int *)&pssrc_ctrl->sFIRF2Ctrl);
         if(ret != FIR_NO_ERROR)
             return SSRC_ERROR;
@@ -447,7 +552,7 @@ SSRCReturnCodes_t                SSRC_proc_dither(ssrc_ctrl_t* pssrc_ctrl)
     int*            piData;
     unsigned int    uiR;
     int                iDither;
-    __int64_t            i64Acc;
+    __int64              i64Acc;
     unsigned int    ui;
 
 
@@ -457,10 +562,10 @@ SSRCReturnCodes_t                SSRC_proc_dither(ssrc_ctrl_t* pssrc_ctrl)
         // Get data buffer
         piData    = pssrc_ctrl->piOut;
         // Get random seed
-        uiR        = pssrc_ctrl->psState->uiRndSeed;
+        uiR        = *pssrc_ctrl->puiRndSeed;
 
         // Loop through samples
-        for(ui = 0; ui < *(pssrc_ctrl->puiNOutSamples) * pssrc_ctrl->uiNchannels; ui += pssrc_ctrl->uiNchannels)
+        for(ui = 0; ui < *(pssrc_ctrl->puiNOutSamples) * SSRC_IO_STEP(pssrc_ctrl); ui += SSRC_IO_STEP(pssrc_ctrl))
         {
             // Compute dither sample (TPDF)
             iDither        = SSRC_DITHER_BIAS;
@@ -475,7 +580,7 @@ SSRCReturnCodes_t                SSRC_proc_dither(ssrc_ctrl_t* pssrc_ctrl)
 
                         //TODO - optimise this and remove IntArithmetic
             // Use MACC instruction to saturate and dither + signal
-            i64Acc        = ((__int64_t)iDither <<32);    // On XMOS this is not necessary, just load dither in the top word of the ACC register
+            i64Acc        = ((__int64)iDither <<32);    // On XMOS this is not necessary, just load dither in the top word of the ACC register
             MACC(&i64Acc, piData[ui], 0x7FFFFFFF);
 
                         // Saturate to 31 bits
@@ -490,7 +595,7 @@ SSRCReturnCodes_t                SSRC_proc_dither(ssrc_ctrl_t* pssrc_ctrl)
         }
 
         // Write random seed back
-        pssrc_ctrl->psState->uiRndSeed    = uiR;
+        *pssrc_ctrl->puiRndSeed    = uiR;
     }
 
     return SSRC_NO_ERROR;
@@ -33,6 +33,13 @@
     // ---------------
     #define        SSRC_STACK_LENGTH_MULT                (SSRC_N_CHANNELS * SSRC_N_IN_SAMPLES)    // Multiplier for stack length (stack length = this value x the number of input samples to process)
 
+    // Sample step in the input and output buffers: uiNchannels for interleaved buffers, 1 for planar ones (host only)
+#ifndef __xcore__
+    #define        SSRC_IO_STEP(psCtrl)                  ((psCtrl)->uiIOStep)
+#else
+    #define        SSRC_IO_STEP(psCtrl)                  ((psCtrl)->uiNchannels)
+#endif
+
 
     // Parameter values
     // ----------------
@@ -137,6 +144,8 @@
 
             ssrc_state_t* unsafe                        psState;                            // Pointer to state structure
             int* unsafe                                piStack;                            // Pointer to stack buffer
+            int* unsafe                             piDelays;                           // Delay lines of F1, F2 and F3 in turn from an arena (0 to use those of the state structure)
+            unsigned int* unsafe                    puiRndSeed;                         // Dither random seed current value, in the state structure or after the delay lines
 #else
             long long                               pad_to_64b_alignment;               //Force compiler to 64b align
             unsigned int                            uiNchannels;                        // Number of channels in this instance
@@ -159,10 +168,24 @@
 
             ssrc_state_t*                              psState;                            // Pointer to state structure
             int*                                    piStack;                            // Pointer to stack buffer
+            int*                                    piDelays;                           // Delay lines of F1, F2 and F3 in turn from an arena (0 to use those of the state structure)
+            unsigned int*                           puiRndSeed;                         // Dither random seed current value, in the state structure or after the delay lines
+#ifndef __xcore__
+            unsigned int                            uiIOStep;                           // Sample step in the input and output buffers, set by SSRC_set_io_step
+#endif
 #endif
         } ssrc_ctrl_t;
 
 
+        // ===========================================================================
+        //
+        // Variables
+        //
+        // ===========================================================================
+
+        // Filter configuration table [Fsin][Fsout]
+        extern SSRCFiltersIDs_t                 sFiltersIDs[SSRC_N_FS][SSRC_N_FS];
+
         // ===========================================================================
         //
         // Function prototypes
@@ -187,6 +210,30 @@
         // ==================================================================== //
         SSRCReturnCodes_t                SSRC_sync(ssrc_ctrl_t* pssrc_ctrl);
 
+        // ==================================================================== //
+        // Function:        SSRC_arena_length                                   //
+        // Arguments:       ssrc_ctrl_t *pssrc_ctrl: Ctrl strct.                //
+        //                  unsigned int *puiStackLength: Stack words           //
+        // Return values:   Arena words of the channel, 0 on failure            //
+        // Description:     Length of the stack (piStack), then the delay lines //
+        //                  (piDelays) and dither seed of a channel, all an     //
+        //                  even number of words. The rates, uiNchannels and    //
+        //                  uiNInSamples must be set                            //
+        // ==================================================================== //
+        unsigned int                    SSRC_arena_length(ssrc_ctrl_t* pssrc_ctrl, unsigned int* puiStackLength);
+
+        // ==================================================================== //
+        // Function:        SSRC_set_min_phase                                  //
+        // Arguments:       ssrc_ctrl_t *pssrc_ctrl: Ctrl strct.                //
+        //                  unsigned int uiMinPhase: 1 for the minimum phase    //
+        //                               filters, 0 for the linear phase ones   //
+        // Return values:   None                                                //
+        // Description:     Selects the coefficients of the F1, F2 and F3       //
+        //                  filters of an initialized SSRC. The minimum phase   //
+        //                  filters have the same numbers of taps               //
+        // ==================================================================== //
+        void                            SSRC_set_min_phase(ssrc_ctrl_t* pssrc_ctrl, unsigned int uiMinPhase);
+
         // ==================================================================== //
         // Function:        SSRC_proc                                            //
         // Arguments:        ssrc_ctrl_t     *pssrc_ctrl: Ctrl strct.                //
@@ -196,6 +243,21 @@
         // ==================================================================== //
         SSRCReturnCodes_t                SSRC_proc(ssrc_ctrl_t* pssrc_ctrl);
 
+#ifndef __xcore__
+        // ==================================================================== //
+        // Function:        SSRC_set_io_step                                    //
+        // Arguments:       ssrc_ctrl_t *pssrc_ctrl: Ctrl strct.                //
+        //                  unsigned int uiIOStep: Sample step in the input and //
+        //                               output buffers                         //
+        // Return values:   None                                                //
+        // Description:     Sets the step of F1 input and of the output of the  //
+        //                  last filter in the chain. SSRC_init sets it to      //
+        //                  uiNchannels (interleaved buffers), planar buffers   //
+        //                  have a step of 1                                    //
+        // ==================================================================== //
+        void                            SSRC_set_io_step(ssrc_ctrl_t* pssrc_ctrl, unsigned int uiIOStep);
+#endif
+
     #endif // nINCLUDE_FROM_ASM
 
 #endif // _SRC_MRHF_SSRC_H_
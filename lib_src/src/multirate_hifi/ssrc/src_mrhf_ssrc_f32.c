@@ -0,0 +1,192 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// SSRC float32 implementation file (host only), as src_mrhf_ssrc.c
+//
+// ===========================================================================
+// ===========================================================================
+
+#if !defined(__xcore__)
+
+// ===========================================================================
+//
+// Includes
+//
+// ===========================================================================
+#include "src.h"
+
+
+// ===========================================================================
+//
+// Functions implementations
+//
+// ===========================================================================
+
+// ==================================================================== //
+// Function:        SSRC_f32_init                                       //
+// Arguments:       ssrc_f32_ctrl_t *pssrc_ctrl: Ctrl strct.            //
+// Return values:   SSRC_NO_ERROR on success                            //
+//                  SSRC_ERROR on failure                               //
+// Description:     Inits the SSRC passed as argument                   //
+// ==================================================================== //
+SSRCReturnCodes_t               SSRC_f32_init(ssrc_f32_ctrl_t* pssrc_ctrl)
+{
+    SSRCFiltersIDs_t*           psFiltersID;
+
+    // Check if state and stack are allocated
+    if(pssrc_ctrl->psState == 0)
+        return SSRC_ERROR;
+    if(pssrc_ctrl->pfStack == 0)
+        return SSRC_ERROR;
+
+    // Check if valid Fsin and Fsout have been provided
+    if( (pssrc_ctrl->eInFs < SSRC_FS_MIN) || (pssrc_ctrl->eInFs > SSRC_FS_MAX))
+        return SSRC_ERROR;
+    if( (pssrc_ctrl->eOutFs < SSRC_FS_MIN) || (pssrc_ctrl->eOutFs > SSRC_FS_MAX))
+        return SSRC_ERROR;
+
+    // Check that number of input samples is allocated and is a multiple of 4
+    if(pssrc_ctrl->uiNInSamples == 0)
+        return SSRC_ERROR;
+    if((pssrc_ctrl->uiNInSamples & 0x3) != 0x0)
+        return SSRC_ERROR;
+
+    psFiltersID         = &sFiltersIDs[pssrc_ctrl->eInFs][pssrc_ctrl->eOutFs];
+
+    // Filter F1
+    // ---------
+    pssrc_ctrl->sFIRF1Ctrl.uiNInSamples     = pssrc_ctrl->uiNInSamples;
+    pssrc_ctrl->sFIRF1Ctrl.uiInStep         = pssrc_ctrl->uiNchannels;
+    if( (psFiltersID->uiFID[SSRC_F1_INDEX] == FILTER_DEFS_SSRC_FIR_DS_ID) || (psFiltersID->uiFID[SSRC_F1_INDEX] == FILTER_DEFS_SSRC_FIR_OS_ID) )
+        pssrc_ctrl->sFIRF1Ctrl.pfDelayB     = pssrc_ctrl->psState->fDelayFIRShort;
+    else
+        pssrc_ctrl->sFIRF1Ctrl.pfDelayB     = pssrc_ctrl->psState->fDelayFIRLong;
+    if(psFiltersID->uiFID[SSRC_F2_INDEX] == FILTER_DEFS_SSRC_FIR_OS_ID)
+        // F2 in use in over-sampling by 2 mode
+        pssrc_ctrl->sFIRF1Ctrl.uiOutStep    = 2 * pssrc_ctrl->uiNchannels;
+    else
+        pssrc_ctrl->sFIRF1Ctrl.uiOutStep    = pssrc_ctrl->uiNchannels;
+
+    if(FIR_f32_init_from_desc(&pssrc_ctrl->sFIRF1Ctrl, &sSSRCFirDescriptor[psFiltersID->uiFID[SSRC_F1_INDEX]]) != FIR_NO_ERROR)
+        return SSRC_ERROR;
+
+    // Filter F2
+    // ---------
+    pssrc_ctrl->sFIRF2Ctrl.uiNInSamples     = pssrc_ctrl->sFIRF1Ctrl.uiNOutSamples;
+    pssrc_ctrl->sFIRF2Ctrl.uiInStep         = pssrc_ctrl->sFIRF1Ctrl.uiOutStep;
+    if( (psFiltersID->uiFID[SSRC_F2_INDEX] == FILTER_DEFS_SSRC_FIR_DS_ID) || (psFiltersID->uiFID[SSRC_F2_INDEX] == FILTER_DEFS_SSRC_FIR_OS_ID) )
+        pssrc_ctrl->sFIRF2Ctrl.pfDelayB     = pssrc_ctrl->psState->fDelayFIRShort;
+    else
+        pssrc_ctrl->sFIRF2Ctrl.pfDelayB     = pssrc_ctrl->psState->fDelayFIRLong;
+    pssrc_ctrl->sFIRF2Ctrl.uiOutStep        = pssrc_ctrl->uiNchannels;
+
+    if(FIR_f32_init_from_desc(&pssrc_ctrl->sFIRF2Ctrl, &sSSRCFirDescriptor[psFiltersID->uiFID[SSRC_F2_INDEX]]) != FIR_NO_ERROR)
+        return SSRC_ERROR;
+
+    // Filter F3
+    // ---------
+    if(psFiltersID->uiFID[SSRC_F2_INDEX] == FILTER_DEFS_SSRC_FIR_NONE_ID)
+        pssrc_ctrl->sPPFIRF3Ctrl.uiNInSamples   = pssrc_ctrl->sFIRF1Ctrl.uiNOutSamples;
+    else
+        pssrc_ctrl->sPPFIRF3Ctrl.uiNInSamples   = pssrc_ctrl->sFIRF2Ctrl.uiNOutSamples;
+    pssrc_ctrl->sPPFIRF3Ctrl.uiInStep       = pssrc_ctrl->sFIRF2Ctrl.uiOutStep;
+    pssrc_ctrl->sPPFIRF3Ctrl.pfDelayB       = pssrc_ctrl->psState->fDelayPPFIR;
+    pssrc_ctrl->sPPFIRF3Ctrl.uiOutStep      = pssrc_ctrl->uiNchannels;
+    pssrc_ctrl->sPPFIRF3Ctrl.uiPhaseStep    = psFiltersID->uiPPFIRPhaseStep;
+
+    if(PPFIR_f32_init_from_desc(&pssrc_ctrl->sPPFIRF3Ctrl, &sPPFirDescriptor[psFiltersID->uiFID[SSRC_F3_INDEX]]) != FIR_NO_ERROR)
+        return SSRC_ERROR;
+
+    // Setup input/output buffers, all to stack base first. F1 input is never from stack, F3 output never to it
+    pssrc_ctrl->sFIRF2Ctrl.pfIn             = pssrc_ctrl->pfStack;
+    pssrc_ctrl->sPPFIRF3Ctrl.pfIn           = pssrc_ctrl->pfStack;
+    pssrc_ctrl->sFIRF1Ctrl.pfOut            = pssrc_ctrl->pfStack;
+    pssrc_ctrl->sFIRF2Ctrl.pfOut            = pssrc_ctrl->pfStack;
+
+    // The last filter in the chain writes the output
+    if(psFiltersID->uiFID[SSRC_F3_INDEX] != FILTER_DEFS_PPFIR_NONE_ID)
+    {
+        pssrc_ctrl->ppfOut                  = &pssrc_ctrl->sPPFIRF3Ctrl.pfOut;
+        pssrc_ctrl->puiNOutSamples          = &pssrc_ctrl->sPPFIRF3Ctrl.uiNOutSamples;
+    }
+    else if(psFiltersID->uiFID[SSRC_F2_INDEX] != FILTER_DEFS_SSRC_FIR_NONE_ID)
+    {
+        pssrc_ctrl->ppfOut                  = &pssrc_ctrl->sFIRF2Ctrl.pfOut;
+        pssrc_ctrl->puiNOutSamples          = &pssrc_ctrl->sFIRF2Ctrl.uiNOutSamples;
+    }
+    else
+    {
+        // Also F1 output if F1 is not in use (Fsin = Fsout), the input is then copied there
+        pssrc_ctrl->ppfOut                  = &pssrc_ctrl->sFIRF1Ctrl.pfOut;
+        if(psFiltersID->uiFID[SSRC_F1_INDEX] != FILTER_DEFS_SSRC_FIR_NONE_ID)
+            pssrc_ctrl->puiNOutSamples      = &pssrc_ctrl->sFIRF1Ctrl.uiNOutSamples;
+        else
+            pssrc_ctrl->puiNOutSamples      = &pssrc_ctrl->uiNInSamples;
+    }
+
+    return SSRC_f32_sync(pssrc_ctrl);
+}
+
+// ==================================================================== //
+// Function:        SSRC_f32_sync                                       //
+// Arguments:       ssrc_f32_ctrl_t *pssrc_ctrl: Ctrl strct.            //
+// Return values:   SSRC_NO_ERROR on success                            //
+//                  SSRC_ERROR on failure                               //
+// Description:     Syncs the SSRC passed as argument                   //
+// ==================================================================== //
+SSRCReturnCodes_t               SSRC_f32_sync(ssrc_f32_ctrl_t* pssrc_ctrl)
+{
+    if(FIR_f32_sync(&pssrc_ctrl->sFIRF1Ctrl) != FIR_NO_ERROR)
+        return SSRC_ERROR;
+    if(FIR_f32_sync(&pssrc_ctrl->sFIRF2Ctrl) != FIR_NO_ERROR)
+        return SSRC_ERROR;
+    if(PPFIR_f32_sync(&pssrc_ctrl->sPPFIRF3Ctrl) != FIR_NO_ERROR)
+        return SSRC_ERROR;
+
+    return SSRC_NO_ERROR;
+}
+
+// ==================================================================== //
+// Function:        SSRC_f32_proc                                       //
+// Arguments:       ssrc_f32_ctrl_t *pssrc_ctrl: Ctrl strct.            //
+// Return values:   SSRC_NO_ERROR on success                            //
+//                  SSRC_ERROR on failure                               //
+// Description:     Processes the SSRC passed as argument               //
+// ==================================================================== //
+SSRCReturnCodes_t               SSRC_f32_proc(ssrc_f32_ctrl_t* pssrc_ctrl)
+{
+    unsigned int    ui;
+
+    // Setup input / output buffers
+    pssrc_ctrl->sFIRF1Ctrl.pfIn         = pssrc_ctrl->pfIn;
+    *(pssrc_ctrl->ppfOut)               = pssrc_ctrl->pfOut;
+
+    // F1 is not enabled at 1:1 rate, then just copy input to output
+    if(pssrc_ctrl->sFIRF1Ctrl.eEnable == FIR_OFF)
+    {
+        for(ui = 0; ui < pssrc_ctrl->uiNInSamples * pssrc_ctrl->uiNchannels; ui += pssrc_ctrl->uiNchannels)
+            pssrc_ctrl->pfOut[ui]       = pssrc_ctrl->pfIn[ui];
+        return SSRC_NO_ERROR;
+    }
+
+    if(pssrc_ctrl->sFIRF1Ctrl.pvProc(&pssrc_ctrl->sFIRF1Ctrl) != FIR_NO_ERROR)
+        return SSRC_ERROR;
+
+    if(pssrc_ctrl->sFIRF2Ctrl.eEnable == FIR_ON)
+    {
+        if(pssrc_ctrl->sFIRF2Ctrl.pvProc(&pssrc_ctrl->sFIRF2Ctrl) != FIR_NO_ERROR)
+            return SSRC_ERROR;
+    }
+
+    if(pssrc_ctrl->sPPFIRF3Ctrl.eEnable == FIR_ON)
+    {
+        if(PPFIR_f32_proc(&pssrc_ctrl->sPPFIRF3Ctrl) != FIR_NO_ERROR)
+            return SSRC_ERROR;
+    }
+
+    return SSRC_NO_ERROR;
+}
+
+#endif // !__xcore__
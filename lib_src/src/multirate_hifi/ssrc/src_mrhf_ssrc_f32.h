@@ -0,0 +1,101 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Definition file for the host float32 SSRC. It has the filters of the
+// SSRC in src_mrhf_ssrc.h, with float32 samples (1.0 is full scale) and
+// coefficients. There is no dither.
+//
+// ===========================================================================
+// ===========================================================================
+
+#ifndef _SRC_MRHF_SSRC_F32_H_
+#define _SRC_MRHF_SSRC_F32_H_
+
+#if !defined(__xcore__)
+
+    // ===========================================================================
+    //
+    // Includes
+    //
+    // ===========================================================================
+    #include "src_mrhf_ssrc.h"
+    #include "src_mrhf_fir_f32.h"
+
+    // ===========================================================================
+    //
+    // TypeDefs
+    //
+    // ===========================================================================
+
+    #ifndef INCLUDE_FROM_ASM
+
+        // SSRC float32 State structure
+        // ----------------------------
+        typedef struct _SSRCStateF32
+        {
+            float                                   fDelayFIRLong[2 * FILTER_DEFS_FIR_MAX_TAPS_LONG] __attribute__((aligned(32)));     // Doubled length for circular buffer simulation
+            float                                   fDelayFIRShort[2 * FILTER_DEFS_FIR_MAX_TAPS_SHORT] __attribute__((aligned(32)));   // Doubled length for circular buffer simulation
+            float                                   fDelayPPFIR[2 * FILTER_DEFS_PPFIR_PHASE_MAX_TAPS] __attribute__((aligned(32)));    // Doubled length for circular buffer simulation
+        } ssrc_f32_state_t;
+
+        // SSRC float32 Control structure
+        // ------------------------------
+        typedef struct _SSRCCtrlF32
+        {
+            unsigned int                            uiNchannels;                        // Number of channels in this instance
+            float*                                  pfIn;                               // Input buffer pointer (channels time domain interleaved)
+            unsigned int                            uiNInSamples;                       // Number of input samples to process in one call to the processing function
+            SSRCFs_t                                eInFs;                              // Input sampling rate code
+            float*                                  pfOut;                              // Output buffer pointer (channels time domain interleaved)
+            unsigned int*                           puiNOutSamples;                     // Pointer to number of output samples produced during last call to the processing function
+            SSRCFs_t                                eOutFs;                             // Output sampling rate code
+            float**                                 ppfOut;                             // Pointer to (PP)FIR output data pointer for last filter in the chain
+
+            FIRCtrlF32_t                            sFIRF1Ctrl;                         // F1 FIR controller
+            FIRCtrlF32_t                            sFIRF2Ctrl;                         // F2 FIR controller
+            PPFIRCtrlF32_t                          sPPFIRF3Ctrl;                       // F3 PPFIR controller
+
+            ssrc_f32_state_t*                       psState;                            // Pointer to state structure
+            float*                                  pfStack;                            // Pointer to stack buffer
+        } ssrc_f32_ctrl_t;
+
+        // ===========================================================================
+        //
+        // Function prototypes
+        //
+        // ===========================================================================
+
+        // ==================================================================== //
+        // Function:        SSRC_f32_init                                       //
+        // Arguments:       ssrc_f32_ctrl_t *pssrc_ctrl: Ctrl strct.            //
+        // Return values:   SSRC_NO_ERROR on success                            //
+        //                  SSRC_ERROR on failure                               //
+        // Description:     As SSRC_init                                        //
+        // ==================================================================== //
+        SSRCReturnCodes_t               SSRC_f32_init(ssrc_f32_ctrl_t* pssrc_ctrl);
+
+        // ==================================================================== //
+        // Function:        SSRC_f32_sync                                       //
+        // Arguments:       ssrc_f32_ctrl_t *pssrc_ctrl: Ctrl strct.            //
+        // Return values:   SSRC_NO_ERROR on success                            //
+        //                  SSRC_ERROR on failure                               //
+        // Description:     As SSRC_sync                                        //
+        // ==================================================================== //
+        SSRCReturnCodes_t               SSRC_f32_sync(ssrc_f32_ctrl_t* pssrc_ctrl);
+
+        // ==================================================================== //
+        // Function:        SSRC_f32_proc                                       //
+        // Arguments:       ssrc_f32_ctrl_t *pssrc_ctrl: Ctrl strct.            //
+        // Return values:   SSRC_NO_ERROR on success                            //
+        //                  SSRC_ERROR on failure                               //
+        // Description:     As SSRC_proc                                        //
+        // ==================================================================== //
+        SSRCReturnCodes_t               SSRC_f32_proc(ssrc_f32_ctrl_t* pssrc_ctrl);
+
+    #endif // nINCLUDE_FROM_ASM
+
+#endif // !__xcore__
+
+#endif // _SRC_MRHF_SSRC_F32_H_
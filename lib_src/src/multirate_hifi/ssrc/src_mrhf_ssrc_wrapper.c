@@ -5,8 +5,13 @@
 #include <stdio.h>
 #include <time.h>
 #include <math.h>
+#ifdef __xcore__
 #include <timer.h>
 #include "debug_print.h"
+#else
+#define debug_printf(...)       fprintf(stderr, __VA_ARGS__)
+#define delay_milliseconds(x)
+#endif
 
 // SSRC includes
 #include "src.h"
@@ -19,7 +24,8 @@ static void ssrc_error(int code)
 }
 
 
-void ssrc_init(const fs_code_t sr_in, const fs_code_t sr_out, ssrc_ctrl_t *ssrc_ctrl,
+// Inits the channels of an instance, whose delay lines are in their state structures or arena
+static void ssrc_init_channels(const fs_code_t sr_in, const fs_code_t sr_out, ssrc_ctrl_t *ssrc_ctrl,
         const unsigned n_channels_per_instance, const unsigned n_in_samples, const dither_flag_t dither_on_off)
 {
     SSRCReturnCodes_t ret_code;
@@ -51,16 +57,116 @@ void ssrc_init(const fs_code_t sr_in, const fs_code_t sr_out, ssrc_ctrl_t *ssrc_
     }
 }
 
+void ssrc_init(const fs_code_t sr_in, const fs_code_t sr_out, ssrc_ctrl_t *ssrc_ctrl,
+        const unsigned n_channels_per_instance, const unsigned n_in_samples, const dither_flag_t dither_on_off)
+{
+    // The delay lines are in the state structures
+    for(unsigned ui = 0; ui < n_channels_per_instance; ui++)
+        ssrc_ctrl[ui].piDelays                  = 0;
+
+    ssrc_init_channels(sr_in, sr_out, ssrc_ctrl, n_channels_per_instance, n_in_samples, dither_on_off);
+}
+
+unsigned ssrc_get_memory_requirements(const fs_code_t sr_in, const fs_code_t sr_out, const unsigned n_channels_per_instance,
+        const unsigned n_in_samples)
+{
+    ssrc_ctrl_t     sCtrl;
+    unsigned        uiStackLength;
+    unsigned        uiLength;
+
+    sCtrl.eInFs                 = (int)sr_in;
+    sCtrl.eOutFs                = (int)sr_out;
+    sCtrl.uiNchannels           = n_channels_per_instance;
+    sCtrl.uiNInSamples          = n_in_samples;
+    uiLength                    = SSRC_arena_length(&sCtrl, &uiStackLength);
+    if (uiLength == 0) ssrc_error(102);
+
+    // The stack, delay lines and seed of each channel
+    return n_channels_per_instance * uiLength * sizeof(int);
+}
+
+void ssrc_init_arena(const fs_code_t sr_in, const fs_code_t sr_out, ssrc_ctrl_t *ssrc_ctrl,
+        const unsigned n_channels_per_instance, const unsigned n_in_samples, const dither_flag_t dither_on_off, uint64_t arena[])
+{
+    int*            piArena     = (int*)arena;
+    unsigned        uiStackLength;
+    unsigned        uiLength;
+
+    if (((uintptr_t)arena & 0x7) != 0) ssrc_error(102);
+
+    for(unsigned ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        ssrc_ctrl[ui].eInFs                     = (int)sr_in;
+        ssrc_ctrl[ui].eOutFs                    = (int)sr_out;
+        ssrc_ctrl[ui].uiNchannels               = n_channels_per_instance;
+        ssrc_ctrl[ui].uiNInSamples              = n_in_samples;
+        uiLength                                = SSRC_arena_length(&ssrc_ctrl[ui], &uiStackLength);
+        if (uiLength == 0) ssrc_error(102);
+
+        // Carved as sized by ssrc_get_memory_requirements()
+        ssrc_ctrl[ui].psState                   = 0;
+        ssrc_ctrl[ui].piStack                   = piArena + ui * uiLength;
+        ssrc_ctrl[ui].piDelays                  = ssrc_ctrl[ui].piStack + uiStackLength;
+    }
+
+    ssrc_init_channels(sr_in, sr_out, ssrc_ctrl, n_channels_per_instance, n_in_samples, dither_on_off);
+}
+
+void ssrc_init_filter_phase(ssrc_ctrl_t ssrc_ctrl[], const src_filter_phase_t filter_phase)
+{
+    for(unsigned ui = 0; ui < ssrc_ctrl[0].uiNchannels; ui++)
+        SSRC_set_min_phase(&ssrc_ctrl[ui], filter_phase == SRC_MINIMUM_PHASE);
+}
+
+#ifndef __xcore__
+int ssrc_init_mirrored_delays(ssrc_ctrl_t ssrc_ctrl[])
+{
+    const unsigned  n_channels_per_instance = ssrc_ctrl[0].uiNchannels;
+    unsigned        ui;
+
+    for(ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        if((FIR_mirror(&ssrc_ctrl[ui].sFIRF1Ctrl) != FIR_NO_ERROR) ||
+           (FIR_mirror(&ssrc_ctrl[ui].sFIRF2Ctrl) != FIR_NO_ERROR) ||
+           (PPFIR_mirror(&ssrc_ctrl[ui].sPPFIRF3Ctrl) != FIR_NO_ERROR))
+        {
+            // All or nothing, so the instance is as it was
+            ssrc_exit_mirrored_delays(ssrc_ctrl);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void ssrc_exit_mirrored_delays(ssrc_ctrl_t ssrc_ctrl[])
+{
+    const unsigned  n_channels_per_instance = ssrc_ctrl[0].uiNchannels;
+    unsigned        ui;
+
+    for(ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        FIR_unmirror(&ssrc_ctrl[ui].sFIRF1Ctrl);
+        FIR_unmirror(&ssrc_ctrl[ui].sFIRF2Ctrl);
+        PPFIR_unmirror(&ssrc_ctrl[ui].sPPFIRF3Ctrl);
+    }
+}
+#endif
+
 unsigned ssrc_process(int in_buff[], int out_buff[], ssrc_ctrl_t *ssrc_ctrl){
 
     unsigned ui;
-    unsigned n_samps_out;
+    unsigned n_samps_out = 0;
 
     // Get the number of channels per instance from first channel
     const unsigned n_channels_per_instance = ssrc_ctrl[0].uiNchannels;
 
     for(ui = 0; ui < n_channels_per_instance; ui++)
     {
+#ifndef __xcore__
+        // Back to interleaved buffers after ssrc_process_planar()
+        if(ssrc_ctrl[ui].uiIOStep != n_channels_per_instance)
+            SSRC_set_io_step(&ssrc_ctrl[ui], n_channels_per_instance);
+#endif
         ssrc_ctrl[ui].piIn = in_buff + ui;
         ssrc_ctrl[ui].piOut = out_buff + ui;
         if(SSRC_proc(&ssrc_ctrl[ui]) != SSRC_NO_ERROR) ssrc_error(0);
@@ -68,3 +174,74 @@ unsigned ssrc_process(int in_buff[], int out_buff[], ssrc_ctrl_t *ssrc_ctrl){
     }
     return n_samps_out;
 }
+
+#ifndef __xcore__
+unsigned ssrc_process_planar(int *in_buff[], int *out_buff[], ssrc_ctrl_t *ssrc_ctrl){
+
+    unsigned ui;
+    unsigned n_samps_out = 0;
+
+    // Get the number of channels per instance from first channel
+    const unsigned n_channels_per_instance = ssrc_ctrl[0].uiNchannels;
+
+    for(ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        // Each channel has its own buffers, read and written with a step of one sample
+        if(ssrc_ctrl[ui].uiIOStep != 1)
+            SSRC_set_io_step(&ssrc_ctrl[ui], 1);
+        ssrc_ctrl[ui].piIn = in_buff[ui];
+        ssrc_ctrl[ui].piOut = out_buff[ui];
+        if(SSRC_proc(&ssrc_ctrl[ui]) != SSRC_NO_ERROR) ssrc_error(0);
+        n_samps_out = (*ssrc_ctrl[ui].puiNOutSamples);
+    }
+    return n_samps_out;
+}
+#endif
+
+#ifndef __xcore__
+void ssrc_f32_init(const fs_code_t sr_in, const fs_code_t sr_out, ssrc_f32_ctrl_t *ssrc_ctrl,
+        const unsigned n_channels_per_instance, const unsigned n_in_samples)
+{
+    SSRCReturnCodes_t ret_code;
+    unsigned ui;
+
+    //Check to see if n_channels_per_instance, n_in_samples are reasonable
+    if ((n_in_samples & 0x1) || (n_in_samples < 4)) ssrc_error(100);
+    if (n_channels_per_instance < 1) ssrc_error(101);
+
+    for(ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        // Set number of channels per instance
+        ssrc_ctrl[ui].uiNchannels               = n_channels_per_instance;
+
+        // Set number of samples
+        ssrc_ctrl[ui].uiNInSamples              = n_in_samples;
+
+        // Set the sample rate codes
+        ssrc_ctrl[ui].eInFs                     = (int)sr_in;
+        ssrc_ctrl[ui].eOutFs                    = (int)sr_out;
+
+        // Init SSRC instances
+        ret_code = SSRC_f32_init(&ssrc_ctrl[ui]) ;
+        if(ret_code != SSRC_NO_ERROR) ssrc_error(ret_code);
+    }
+}
+
+unsigned ssrc_f32_process(float in_buff[], float out_buff[], ssrc_f32_ctrl_t *ssrc_ctrl){
+
+    unsigned ui;
+    unsigned n_samps_out = 0;
+
+    // Get the number of channels per instance from first channel
+    const unsigned n_channels_per_instance = ssrc_ctrl[0].uiNchannels;
+
+    for(ui = 0; ui < n_channels_per_instance; ui++)
+    {
+        ssrc_ctrl[ui].pfIn = in_buff + ui;
+        ssrc_ctrl[ui].pfOut = out_buff + ui;
+        if(SSRC_f32_proc(&ssrc_ctrl[ui]) != SSRC_NO_ERROR) ssrc_error(0);
+        n_samps_out = (*ssrc_ctrl[ui].puiNOutSamples);
+    }
+    return n_samps_out;
+}
+#endif
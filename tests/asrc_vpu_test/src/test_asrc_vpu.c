@@ -322,7 +322,7 @@ int expected_wave_96_48[] = {
 int unit_test_spline() {
 //    int DWORD_ALIGNED iH[3] = {0x12345678, 0x87654321, -12314516};
     int DWORD_ALIGNED iH[3] = { -12314516, 0x87654321,0x12345678};
-    int           *piPhase0 = &iADFirCoefs[0][63];
+    int           *piPhase0 = (int *)&iADFirCoefs[0][63];
     int DWORD_ALIGNED piADCoefs1[16];
     int out63[16] = {
         0xffffde68,
@@ -342,7 +342,6 @@ int unit_test_spline() {
         0xffffdd51,
         0x00000000        
     };
-    ASRC_prepare_coefs();
     src_mrhf_spline_coeff_gen_inner_loop_asm_xs3(piPhase0, iH, piADCoefs1, FILTER_DEFS_ADFIR_PHASE_N_TAPS);
 //    src_mrhf_spline_coeff_gen_inner_loop_asm(piPhase0, iH, piADCoefs2, FILTER_DEFS_ADFIR_PHASE_N_TAPS);
 
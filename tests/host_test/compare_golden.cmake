@@ -0,0 +1,69 @@
+# Runs the test vectors in tests/src_input through the golden model and through the host
+# build of lib_src (test_host_dut) with identical options, and requires bit-exact outputs.
+# Mirrors gen_golden()/run_dut() in tests/src_test_utils.py.
+#
+# Inputs: SRC_TYPE (asrc, ssrc, ds3 or os3), DUT, GOLDEN, INPUT_DIR, WORK_DIR
+# Optional: DUT_MODE, the test_host_dut mode when it differs from SRC_TYPE (e.g. asrc_mc)
+
+set(SR_NAMES 44 48 88 96 176 192)
+set(ASRC_DEVIATIONS 1.000000 0.990099 1.009999)
+set(NUM_SAMPLES_TO_PROCESS 256)
+
+if(NOT DEFINED DUT_MODE)
+    set(DUT_MODE ${SRC_TYPE})
+endif()
+
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+function(run_and_compare NAME GOLDEN_ARGS DUT_ARGS OUT_FILES)
+    execute_process(COMMAND ${GOLDEN} ${GOLDEN_ARGS} WORKING_DIRECTORY ${WORK_DIR}
+                    INPUT_FILE /dev/null OUTPUT_QUIET RESULT_VARIABLE GOLDEN_RESULT)
+    if(NOT GOLDEN_RESULT EQUAL 0)
+        message(FATAL_ERROR "${NAME}: golden model failed (${GOLDEN_RESULT})")
+    endif()
+    foreach(OUT_FILE ${OUT_FILES})
+        file(RENAME ${WORK_DIR}/${OUT_FILE} ${WORK_DIR}/${OUT_FILE}.golden)
+    endforeach()
+
+    execute_process(COMMAND ${DUT} ${DUT_MODE} ${DUT_ARGS} WORKING_DIRECTORY ${WORK_DIR}
+                    RESULT_VARIABLE DUT_RESULT)
+    if(NOT DUT_RESULT EQUAL 0)
+        message(FATAL_ERROR "${NAME}: host DUT failed (${DUT_RESULT})")
+    endif()
+
+    foreach(OUT_FILE ${OUT_FILES})
+        file(READ ${WORK_DIR}/${OUT_FILE}.golden GOLDEN_DATA)
+        file(READ ${WORK_DIR}/${OUT_FILE} DUT_DATA)
+        if(NOT GOLDEN_DATA STREQUAL DUT_DATA)
+            message(FATAL_ERROR "${NAME}: ${OUT_FILE} differs from golden reference")
+        endif()
+    endforeach()
+endfunction()
+
+if(SRC_TYPE STREQUAL "asrc" OR SRC_TYPE STREQUAL "ssrc")
+    foreach(K RANGE 5)
+        list(GET SR_NAMES ${K} IN_NAME)
+        set(IN_ARGS -i${INPUT_DIR}/s1k_0dB_${IN_NAME}.dat -j${INPUT_DIR}/im10k11k_m6dB_${IN_NAME}.dat -k${K})
+        foreach(Q RANGE 5)
+            if(SRC_TYPE STREQUAL "asrc")
+                set(DEVIATIONS ${ASRC_DEVIATIONS})
+            else()
+                set(DEVIATIONS 1.0)
+            endif()
+            foreach(DEV ${DEVIATIONS})
+                set(ARGS ${IN_ARGS} -q${Q} -d0 -l${NUM_SAMPLES_TO_PROCESS} -n4 -ooutput_0.dat -poutput_1.dat)
+                if(SRC_TYPE STREQUAL "asrc")
+                    list(APPEND ARGS -e${DEV})
+                endif()
+                run_and_compare("${SRC_TYPE} ${K}->${Q} (${DEV})" "${ARGS}" "${ARGS}" "output_0.dat;output_1.dat")
+            endforeach()
+        endforeach()
+    endforeach()
+else()
+    foreach(SIGNAL s1k_0dB_48 im5k6k_m6dB_48)
+        set(ARGS -i${INPUT_DIR}/${SIGNAL}.dat -ooutput_0.dat)
+        run_and_compare("${SRC_TYPE} ${SIGNAL}" "${ARGS}" "${ARGS}" "output_0.dat")
+    endforeach()
+endif()
+
+message(STATUS "${DUT_MODE}: host build matches golden reference")
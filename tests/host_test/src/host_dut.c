@@ -0,0 +1,283 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Host DUT application. Runs the test vectors through the host build of
+// lib_src, taking the same command line options as the golden models
+// (asrc_golden, ssrc_golden, ds3_golden, os3_golden) so the outputs can be
+// compared file for file. Set SRC_HOST_ISA to an SRCISA_t value to limit
+// the inner loop backend.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#define     ASRC_N_CHANNELS             2       // Max channels per ASRC instance (sizes the stack)
+#define     SSRC_N_CHANNELS             2       // Channels per SSRC instance, as in the golden model
+#define     SSRC_N_IN_SAMPLES           4
+#include "src.h"
+#include "src_mrhf_isa.h"
+
+#define     N_IO_CHANNELS               2
+#define     N_TOTAL_IN_SAMPLES_MAX      65536
+#define     N_IN_SAMPLES_MAX            64
+#define     N_OUT_IN_RATIO_MAX          5
+
+static char*            pzInFileName[N_IO_CHANNELS];
+static char*            pzOutFileName[N_IO_CHANNELS];
+static unsigned int     uiInFs                  = FS_CODE_44;
+static unsigned int     uiOutFs                 = FS_CODE_48;
+static unsigned int     uiNTotalInSamples       = 1024;
+static unsigned int     uiNInSamples            = 4;
+static unsigned int     uiDitherOnOff           = 0;
+static double           fFsRatioDeviation       = 1.0;
+
+static int              iIn[N_IO_CHANNELS][N_TOTAL_IN_SAMPLES_MAX];
+static int              iOut[N_IO_CHANNELS][N_TOTAL_IN_SAMPLES_MAX * N_OUT_IN_RATIO_MAX * 3];
+static unsigned int     uiNOut[N_IO_CHANNELS];
+
+static void dut_error(const char *pzMsg, const char *pzArg)
+{
+    fprintf(stderr, "ERROR: %s %s\n", pzMsg, pzArg ? pzArg : "");
+    exit(1);
+}
+
+static void parse_args(int argc, char *argv[])
+{
+    for(int i = 2; i < argc; i++)
+    {
+        char *a = argv[i];
+        if(a[0] != '-')
+            dut_error("unexpected argument", a);
+        switch(a[1])
+        {
+            case 'i': pzInFileName[0]       = a + 2;                        break;
+            case 'j': pzInFileName[1]       = a + 2;                        break;
+            case 'o': pzOutFileName[0]      = a + 2;                        break;
+            case 'p': pzOutFileName[1]      = a + 2;                        break;
+            case 'k': uiInFs                = (unsigned)atoi(a + 2);        break;
+            case 'q': uiOutFs               = (unsigned)atoi(a + 2);        break;
+            case 'l': uiNTotalInSamples     = (unsigned)atoi(a + 2);        break;
+            case 'n': uiNInSamples          = (unsigned)atoi(a + 2);        break;
+            case 'd': uiDitherOnOff         = (unsigned)atoi(a + 2);        break;
+            case 'e': fFsRatioDeviation     = atof(a + 2);                  break;
+            default:  dut_error("unknown option", a);
+        }
+    }
+    if(uiNTotalInSamples > N_TOTAL_IN_SAMPLES_MAX || uiNInSamples > N_IN_SAMPLES_MAX)
+        dut_error("too many samples", NULL);
+}
+
+static unsigned read_input(int ch)
+{
+    FILE *f = fopen(pzInFileName[ch], "rt");
+    unsigned n = 0;
+    if(f == NULL)
+        dut_error("cannot open input file", pzInFileName[ch]);
+    while(n < N_TOTAL_IN_SAMPLES_MAX && fscanf(f, "%i\n", &iIn[ch][n]) == 1)
+        n++;
+    fclose(f);
+    return n;
+}
+
+static void write_output(int ch)
+{
+    FILE *f = fopen(pzOutFileName[ch], "wt");
+    if(f == NULL)
+        dut_error("cannot create output file", pzOutFileName[ch]);
+    for(unsigned i = 0; i < uiNOut[ch]; i++)
+        fprintf(f, "%i\n", iOut[ch][i]);
+    fclose(f);
+}
+
+// One single channel instance per I/O channel, as the golden model does
+static void run_asrc(void)
+{
+    static asrc_state_t         sState[N_IO_CHANNELS];
+    static int                  iStack[N_IO_CHANNELS][ASRC_STACK_LENGTH_MULT * N_IN_SAMPLES_MAX];
+    static asrc_ctrl_t          sCtrl[N_IO_CHANNELS];
+    static asrc_adfir_coefs_t   sCoefs[N_IO_CHANNELS];
+    uint64_t                    u64NominalRatio = 0;
+    int                         iOutBlock[N_IN_SAMPLES_MAX * N_OUT_IN_RATIO_MAX];
+
+    for(int ch = 0; ch < N_IO_CHANNELS; ch++)
+    {
+        read_input(ch);
+        sCtrl[ch].psState       = &sState[ch];
+        sCtrl[ch].piStack       = iStack[ch];
+        sCtrl[ch].piADCoefs     = sCoefs[ch].iASRCADFIRCoefs;
+        u64NominalRatio         = asrc_init(uiInFs, uiOutFs, &sCtrl[ch], 1, uiNInSamples, uiDitherOnOff);
+    }
+
+    uint64_t u64Ratio = (unsigned long long)(u64NominalRatio * fFsRatioDeviation);
+
+    for(unsigned i = 0; i + uiNInSamples <= uiNTotalInSamples; i += uiNInSamples)
+    {
+        for(int ch = 0; ch < N_IO_CHANNELS; ch++)
+        {
+            unsigned n = asrc_process(&iIn[ch][i], iOutBlock, u64Ratio, &sCtrl[ch]);
+            memcpy(&iOut[ch][uiNOut[ch]], iOutBlock, n * sizeof(int));
+            uiNOut[ch] += n;
+        }
+    }
+}
+
+// One stereo instance. The channels are independent and share the ratio, so the
+// output must match the single channel instances of the golden model.
+// With interleaved set the F3 delay lines of both channels are interleaved tap by tap
+static void run_asrc_mc(int interleaved)
+{
+    static asrc_state_t         sState[N_IO_CHANNELS];
+    static int                  iStack[N_IO_CHANNELS][ASRC_STACK_LENGTH_MULT * N_IN_SAMPLES_MAX];
+    static asrc_ctrl_t          sCtrl[N_IO_CHANNELS];
+    static asrc_adfir_coefs_t   sCoefs;
+    static int                  iF3Delay[ASRC_F3_INTERLEAVED_DELAY_LENGTH(N_IO_CHANNELS)] __attribute__((aligned(64)));
+    int                         iInBlock[N_IO_CHANNELS * N_IN_SAMPLES_MAX];
+    int                         iOutBlock[N_IO_CHANNELS * N_IN_SAMPLES_MAX * N_OUT_IN_RATIO_MAX];
+
+    for(int ch = 0; ch < N_IO_CHANNELS; ch++)
+    {
+        read_input(ch);
+        sCtrl[ch].psState       = &sState[ch];
+        sCtrl[ch].piStack       = iStack[ch];
+        sCtrl[ch].piADCoefs     = sCoefs.iASRCADFIRCoefs;
+    }
+    uint64_t u64NominalRatio    = asrc_init(uiInFs, uiOutFs, sCtrl, N_IO_CHANNELS, uiNInSamples, uiDitherOnOff);
+    if(interleaved)
+        asrc_init_f3_interleaved(sCtrl, iF3Delay);
+    uint64_t u64Ratio           = (unsigned long long)(u64NominalRatio * fFsRatioDeviation);
+
+    for(unsigned i = 0; i + uiNInSamples <= uiNTotalInSamples; i += uiNInSamples)
+    {
+        for(unsigned j = 0; j < uiNInSamples; j++)
+            for(int ch = 0; ch < N_IO_CHANNELS; ch++)
+                iInBlock[j * N_IO_CHANNELS + ch] = iIn[ch][i + j];
+
+        unsigned n = asrc_process(iInBlock, iOutBlock, u64Ratio, sCtrl);
+
+        for(unsigned j = 0; j < n; j++)
+            for(int ch = 0; ch < N_IO_CHANNELS; ch++)
+                iOut[ch][uiNOut[ch]++] = iOutBlock[j * N_IO_CHANNELS + ch];
+    }
+}
+
+// One stereo instance, as the golden model does
+static void run_ssrc(void)
+{
+    static ssrc_state_t         sState[N_IO_CHANNELS];
+    static int                  iStack[N_IO_CHANNELS][SSRC_STACK_LENGTH_MULT * N_IN_SAMPLES_MAX];
+    static ssrc_ctrl_t          sCtrl[N_IO_CHANNELS];
+    int                         iInBlock[N_IO_CHANNELS * N_IN_SAMPLES_MAX];
+    int                         iOutBlock[N_IO_CHANNELS * N_IN_SAMPLES_MAX * N_OUT_IN_RATIO_MAX];
+
+    for(int ch = 0; ch < N_IO_CHANNELS; ch++)
+    {
+        read_input(ch);
+        sCtrl[ch].psState       = &sState[ch];
+        sCtrl[ch].piStack       = iStack[ch];
+    }
+    ssrc_init(uiInFs, uiOutFs, sCtrl, N_IO_CHANNELS, uiNInSamples, uiDitherOnOff);
+
+    for(unsigned i = 0; i + uiNInSamples <= uiNTotalInSamples; i += uiNInSamples)
+    {
+        for(unsigned j = 0; j < uiNInSamples; j++)
+            for(int ch = 0; ch < N_IO_CHANNELS; ch++)
+                iInBlock[j * N_IO_CHANNELS + ch] = iIn[ch][i + j];
+
+        unsigned n = ssrc_process(iInBlock, iOutBlock, sCtrl);
+
+        for(unsigned j = 0; j < n; j++)
+            for(int ch = 0; ch < N_IO_CHANNELS; ch++)
+                iOut[ch][uiNOut[ch]++] = iOutBlock[j * N_IO_CHANNELS + ch];
+    }
+}
+
+static void run_ds3(void)
+{
+    static int                  iDelay[SRC_FF3_DS3_N_COEFS << 1];
+    src_ds3_ctrl_t              sCtrl;
+    int                         iOutSample;
+    int                         iTriple[3] = {0, 0, 0};
+    unsigned                    n = read_input(0);
+
+    sCtrl.delay_base            = iDelay;
+    if(src_ds3_init(&sCtrl) != SRC_FF3_NO_ERROR || src_ds3_sync(&sCtrl) != SRC_FF3_NO_ERROR)
+        dut_error("ds3 init", NULL);
+
+    // Like the golden model, a trailing partial triple is processed with the stale samples of the previous one
+    for(unsigned i = 0; i < n; i += 3)
+    {
+        for(unsigned j = 0; j < 3 && i + j < n; j++)
+            iTriple[j]          = iIn[0][i + j];
+        sCtrl.in_data           = iTriple;
+        sCtrl.out_data          = &iOutSample;
+        if(src_ds3_proc(&sCtrl) != SRC_FF3_NO_ERROR)
+            dut_error("ds3 proc", NULL);
+        iOut[0][uiNOut[0]++]    = iOutSample;
+    }
+}
+
+static void run_os3(void)
+{
+    static int                  iDelay[(SRC_FF3_OS3_N_COEFS / SRC_FF3_OS3_N_PHASES) << 1];
+    src_os3_ctrl_t              sCtrl;
+    unsigned                    n = read_input(0);
+    unsigned                    i = 0;
+
+    sCtrl.delay_base            = iDelay;
+    if(src_os3_init(&sCtrl) != SRC_FF3_NO_ERROR || src_os3_sync(&sCtrl) != SRC_FF3_NO_ERROR)
+        dut_error("os3 init", NULL);
+
+    for(;;)
+    {
+        if(sCtrl.phase == 0)
+        {
+            if(i == n)
+                break;
+            sCtrl.in_data       = iIn[0][i++];
+            if(src_os3_input(&sCtrl) != SRC_FF3_NO_ERROR)
+                dut_error("os3 input", NULL);
+        }
+        if(src_os3_proc(&sCtrl) != SRC_FF3_NO_ERROR)
+            dut_error("os3 proc", NULL);
+        iOut[0][uiNOut[0]++]    = sCtrl.out_data;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2)
+        dut_error("usage: host_dut asrc|asrc_mc|asrc_interleaved|ssrc|ds3|os3 [golden model options]", NULL);
+
+    parse_args(argc, argv);
+
+    // Limit the inner loop backend, to check every kernel table against the golden models
+    if(getenv("SRC_HOST_ISA") != NULL)
+        src_isa_force((SRCISA_t)atoi(getenv("SRC_HOST_ISA")));
+
+    if(strcmp(argv[1], "asrc") == 0)
+        run_asrc();
+    else if(strcmp(argv[1], "asrc_mc") == 0)
+        run_asrc_mc(0);
+    else if(strcmp(argv[1], "asrc_interleaved") == 0)
+        run_asrc_mc(1);
+    else if(strcmp(argv[1], "ssrc") == 0)
+        run_ssrc();
+    else if(strcmp(argv[1], "ds3") == 0)
+        run_ds3();
+    else if(strcmp(argv[1], "os3") == 0)
+        run_os3();
+    else
+        dut_error("unknown SRC type", argv[1]);
+
+    write_output(0);
+    if(pzOutFileName[1] != NULL)
+        write_output(1);
+
+    return 0;
+}
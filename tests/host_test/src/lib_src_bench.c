@@ -0,0 +1,847 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Host benchmark. Times the inner loop kernels for every ISA the CPU runs
+// (FIR sync/ds2/os2, PPFIR, ADFIR, spline, FF3, voice) and the top level
+// APIs: ASRC (also with interleaved F3 delay lines) and SSRC, both also
+// with mirrored delay lines, over all 36 rate pairs, channel counts and
+// block sizes, ASRC of many channels on a
+// pool of threads, DS3/OS3, the XS2 voice and the src_poly.h voice
+// functions.
+//
+// Every case is run a number of repetitions, 21 by default and 5 with -q.
+// Reported per case are the median and the maximum time per sample over the
+// repetitions and the samples per second one core sustains at the median.
+// With so few repetitions a high percentile would be the maximum anyway, so
+// the maximum is reported as such. A sample is one kernel output for the
+// kernels, and one input sample of one channel for the APIs. The results
+// are written as JSON so they can be compared across releases.
+//
+//   lib_src_bench [-o file.json] [-q] [-f filter] [-r reps] [-i isa]
+//
+//   -o  write the JSON to a file rather than stdout
+//   -q  quick run: fewer cases and repetitions, used by the smoke test
+//   -f  only run the cases whose name contains filter
+//   -r  number of repetitions per case
+//   -i  limit the host ISA, as SRC_HOST_ISA for the golden tests
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define     ASRC_N_CHANNELS             8       // Max channels per ASRC instance (sizes the stack)
+#define     SSRC_N_CHANNELS             8       // Max channels per SSRC instance (sizes the stack)
+#define     SSRC_N_IN_SAMPLES           4
+#include "src.h"
+#include "src_mrhf_isa.h"
+#include "src_mrhf_filter_defs.h"
+#include "src_mrhf_fir_inner_loop_asm.h"
+#include "src_mrhf_adfir_inner_loop_asm.h"
+#include "src_mrhf_spline_coeff_gen_inner_loop_asm.h"
+#include "src_ff3_fir_inner_loop_asm.h"
+#include "src_ff3v_fir_impl.h"
+#include "src_low_level.h"
+#include "src_ff3_fir_coefs.h"
+#include "src_rat_fir_coefs.h"
+
+#ifndef LIB_SRC_VERSION
+#define     LIB_SRC_VERSION             "unknown"
+#endif
+
+#define     BENCH_MAX_REPS              1001
+#define     BENCH_MAX_CHANNELS          16
+#define     BENCH_MAX_BLOCK             256
+#define     BENCH_OUT_IN_RATIO_MAX      5
+#define     BENCH_DATA_LENGTH           4096
+#define     BENCH_MT_MAX_CHANNELS       64      // Channels of the thread pool cases, a block of BENCH_MT_BLOCK fits iIn
+#define     BENCH_MT_BLOCK              64
+
+static const char*      pzIsaNames[SRC_ISA_N]   = { "scalar", "sse41", "avx2", "avx512" };
+static const unsigned   uiFsHz[ASRC_N_FS]       = { 44100, 48000, 88200, 96000, 176400, 192000 };
+
+static const unsigned   uiChannelsFull[]        = { 1, 2, 4, 8, 16 };
+static const unsigned   uiChannelsQuick[]       = { 2 };
+static const unsigned   uiBlocksFull[]          = { 4, 16, 64, 256 };
+static const unsigned   uiBlocksQuick[]         = { 16 };
+
+static FILE*            pfJson;
+static const char*      pzFilter                = NULL;
+static unsigned         uiQuick                 = 0;
+static unsigned         uiNReps                 = 21;
+static unsigned         uiNCases                = 0;
+static SRCISA_t         eIsaDetected;
+
+static int              iData[BENCH_DATA_LENGTH] __attribute__((aligned(64)));
+static int              iCoefs[BENCH_DATA_LENGTH] __attribute__((aligned(64)));
+static int              iIn[BENCH_MAX_CHANNELS * BENCH_MAX_BLOCK];
+static int              iOut[BENCH_MAX_CHANNELS * BENCH_MAX_BLOCK * BENCH_OUT_IN_RATIO_MAX];
+static float            fIn[BENCH_MAX_CHANNELS * BENCH_MAX_BLOCK];
+static float            fOut[BENCH_MAX_CHANNELS * BENCH_MAX_BLOCK * BENCH_OUT_IN_RATIO_MAX];
+static volatile int     iSink;
+
+typedef struct
+{
+    const char*     pzName;         // Kernel or API name
+    const char*     pzGroup;        // "kernel" or "api"
+    const char*     pzIsa;          // ISA the case ran with
+    unsigned        uiFsIn;         // Input rate in Hz, 0 if fixed
+    unsigned        uiFsOut;        // Output rate in Hz, 0 if fixed
+    unsigned        uiNChannels;    // Channels per instance
+    unsigned        uiBlock;        // Input samples per channel per call
+    unsigned        uiNTaps;        // Kernel taps, 0 for the APIs
+} bench_case_t;
+
+// Runs uiNCalls calls of the code under test
+typedef void (*bench_fn_t)(void *pvCtx, unsigned uiNCalls);
+
+static void bench_error(const char *pzMsg, const char *pzArg)
+{
+    fprintf(stderr, "ERROR: %s %s\n", pzMsg, pzArg ? pzArg : "");
+    exit(1);
+}
+
+static double now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+static int compare_double(const void *pvA, const void *pvB)
+{
+    double a = *(const double *)pvA, b = *(const double *)pvB;
+    return (a > b) - (a < b);
+}
+
+static int bench_selected(const char *pzName)
+{
+    return pzFilter == NULL || strstr(pzName, pzFilter) != NULL;
+}
+
+// Times one case and appends its result to the JSON. fSamplesPerCall is the
+// number of samples one call of the code under test produces or consumes
+static void bench_run(const bench_case_t *psCase, bench_fn_t pfRun, void *pvCtx,
+                      unsigned uiNCalls, double fSamplesPerCall)
+{
+    static double   fNsPerSample[BENCH_MAX_REPS];
+    double          fMedian, fMax;
+    unsigned        ui;
+
+    pfRun(pvCtx, uiNCalls);     // Warm up caches and branch predictors
+    for(ui = 0; ui < uiNReps; ui++)
+    {
+        double t0 = now_ns();
+        pfRun(pvCtx, uiNCalls);
+        fNsPerSample[ui] = (now_ns() - t0) / (uiNCalls * fSamplesPerCall);
+    }
+    qsort(fNsPerSample, uiNReps, sizeof(double), compare_double);
+    fMedian     = fNsPerSample[uiNReps / 2];
+    fMax        = fNsPerSample[uiNReps - 1];
+
+    fprintf(stderr, "%-8s %-16s %-7s %6u %6u %2u ch %3u blk %3u taps %10.2f ns/sample %12.0f samples/s\n",
+            psCase->pzGroup, psCase->pzName, psCase->pzIsa, psCase->uiFsIn, psCase->uiFsOut,
+            psCase->uiNChannels, psCase->uiBlock, psCase->uiNTaps, fMedian, 1e9 / fMedian);
+    fprintf(pfJson, "%s\n    { \"name\": \"%s\", \"group\": \"%s\", \"isa\": \"%s\", "
+                    "\"fs_in\": %u, \"fs_out\": %u, \"channels\": %u, \"block\": %u, \"taps\": %u, "
+                    "\"ns_per_sample_median\": %.3f, \"ns_per_sample_max\": %.3f, \"samples_per_s_per_core\": %.0f }",
+            uiNCases++ ? "," : "", psCase->pzName, psCase->pzGroup, psCase->pzIsa, psCase->uiFsIn, psCase->uiFsOut,
+            psCase->uiNChannels, psCase->uiBlock, psCase->uiNTaps, fMedian, fMax, 1e9 / fMedian);
+}
+
+// ===========================================================================
+//
+// Kernels
+//
+// ===========================================================================
+
+typedef struct
+{
+    SRCInnerLoop_t  pfInnerLoop[2];
+    int             iCount;
+    int             iOut[2];
+} inner_loop_ctx_t;
+
+// Steps the delay line pointer by one sample per call, so both alignments are timed as in the filters
+static void run_inner_loop(void *pvCtx, unsigned uiNCalls)
+{
+    inner_loop_ctx_t   *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+    {
+        int *piData = iData + (ui & 7);
+        psCtx->pfInnerLoop[SRC_ISA_PARITY(piData)](piData, iCoefs, psCtx->iOut, psCtx->iCount);
+    }
+    iSink = psCtx->iOut[0];
+}
+
+typedef struct
+{
+    int             iCount;
+    unsigned        uiNChannels;
+    int             iOut[SRC_MRHF_ADFIR_MULTI_MAX_CH];
+} adfir_multi_ctx_t;
+
+#if defined(__x86_64__) || defined(__i386__)
+static void run_adfir_multi(void *pvCtx, unsigned uiNCalls)
+{
+    adfir_multi_ctx_t  *psCtx   = pvCtx;
+    int                *ppiData[SRC_MRHF_ADFIR_MULTI_MAX_CH];
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+    {
+        for(unsigned uj = 0; uj < psCtx->uiNChannels; uj++)
+            ppiData[uj] = iData + 64 * uj + (ui & 7);
+        src_mrhf_adfir_inner_loop_multi_avx512(ppiData, iCoefs, psCtx->iOut, psCtx->uiNChannels, psCtx->iCount);
+    }
+    iSink = psCtx->iOut[0];
+}
+#endif
+
+typedef struct
+{
+    SRCInnerLoop_t  pfSpline;
+    int             iADCoefs[FILTER_DEFS_ADFIR_PHASE_N_TAPS] __attribute__((aligned(64)));
+} spline_ctx_t;
+
+static void run_spline(void *pvCtx, unsigned uiNCalls)
+{
+    spline_ctx_t       *psCtx   = pvCtx;
+    int                 iH[3]   = { 0x12345678, 0x2468ACE0, 0x0FEDCBA9 };
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        psCtx->pfSpline((int*)&iADFirCoefs[(ui * 37) % FILTER_DEFS_ADFIR_N_PHASES][0], iH, psCtx->iADCoefs, FILTER_DEFS_ADFIR_PHASE_N_TAPS);
+    iSink = psCtx->iADCoefs[0];
+}
+
+typedef struct
+{
+    int64_t     (*pfDot)(int64_t sum, const int32_t data[], const int32_t coefs[]);
+    int32_t     (*pfConv)(const int32_t *samples, const int32_t *coef, unsigned n_taps);
+    unsigned    uiNTaps;
+} dot_ctx_t;
+
+static void run_ff3v_dot(void *pvCtx, unsigned uiNCalls)
+{
+    dot_ctx_t          *psCtx   = pvCtx;
+    int64_t             sum     = 0;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        sum = psCtx->pfDot(sum, iData + (ui & 7), iCoefs);
+    iSink = (int)sum;
+}
+
+static void run_conv(void *pvCtx, unsigned uiNCalls)
+{
+    dot_ctx_t          *psCtx   = pvCtx;
+    int32_t             iAcc    = 0;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        iAcc += psCtx->pfConv(iData + (ui & 7), iCoefs, psCtx->uiNTaps);
+    iSink = iAcc;
+}
+
+// Times one inner loop table entry per ISA; ISAs a kernel falls back from are skipped
+static void bench_inner_loop(const char *pzName, SRCKernel_t eKernel, unsigned uiNTaps, int iCount, unsigned uiNCalls)
+{
+    inner_loop_ctx_t    sCtx;
+    bench_case_t        sCase   = { pzName, "kernel", NULL, 0, 0, 1, 1, uiNTaps };
+
+    if(!bench_selected(pzName))
+        return;
+    for(int iIsa = SRC_ISA_SCALAR; iIsa <= (int)eIsaDetected; iIsa++)
+    {
+        src_isa_force((SRCISA_t)iIsa);
+        if((int)src_isa_get_kernels(eKernel, sCtx.pfInnerLoop) != iIsa)
+            continue;
+        sCtx.iCount     = iCount;
+        sCase.pzIsa     = pzIsaNames[iIsa];
+        bench_run(&sCase, run_inner_loop, &sCtx, uiNCalls, 1.0);
+    }
+    src_isa_force(SRC_ISA_N);
+}
+
+static void bench_kernels(void)
+{
+    unsigned            uiNCalls    = uiQuick ? 2000 : 50000;
+    bench_case_t        sCase       = { NULL, "kernel", NULL, 0, 0, 1, 1, 0 };
+
+    for(unsigned ui = 0; ui < BENCH_DATA_LENGTH; ui++)
+    {
+        iData[ui]       = (int)(ui * 2654435761u);
+        iCoefs[ui]      = (int)(ui * 40503u << 12);
+    }
+
+    // Inner loop counts as set up by FIR_init_from_desc(), ADFIR_init_from_desc(), PPFIR_init_from_desc() and src_ds3_init()
+    bench_inner_loop("fir_sync",     SRC_KERNEL_FIR,    FILTER_DEFS_FIR_BL_N_TAPS,       FILTER_DEFS_FIR_BL_N_TAPS >> 1,      uiNCalls);
+    bench_inner_loop("fir_ds2",      SRC_KERNEL_FIR,    FILTER_DEFS_FIR_DS_N_TAPS,       FILTER_DEFS_FIR_DS_N_TAPS >> 1,      uiNCalls);
+    bench_inner_loop("fir_os2",      SRC_KERNEL_FIR_OS, FILTER_DEFS_FIR_OS_N_TAPS,       FILTER_DEFS_FIR_OS_N_TAPS >> 2,      uiNCalls);
+    bench_inner_loop("ppfir",        SRC_KERNEL_FIR,    FILTER_DEFS_PPFIR_PHASE_MAX_TAPS, FILTER_DEFS_PPFIR_PHASE_MAX_TAPS >> 1, uiNCalls);
+    bench_inner_loop("adfir",        SRC_KERNEL_ADFIR,  FILTER_DEFS_ADFIR_PHASE_N_TAPS,  FILTER_DEFS_ADFIR_PHASE_N_TAPS >> 1, uiNCalls);
+    bench_inner_loop("ff3",          SRC_KERNEL_FF3,    SRC_FF3_DS3_N_COEFS,
+                     (SRC_FF3_DS3_N_COEFS >> 1) / SRC_FF3_N_LOOPS_PER_ASM, uiNCalls);
+
+#if defined(__x86_64__) || defined(__i386__)
+    // Outputs of all channels of an ASRC instance from one load of the coefficients, one sample per channel
+    if(eIsaDetected >= SRC_ISA_AVX512 && bench_selected("adfir_multi"))
+    {
+        adfir_multi_ctx_t   sMulti  = { FILTER_DEFS_ADFIR_PHASE_N_TAPS >> 1, SRC_MRHF_ADFIR_MULTI_MAX_CH };
+        sCase.pzName        = "adfir_multi";
+        sCase.pzIsa         = pzIsaNames[SRC_ISA_AVX512];
+        sCase.uiNChannels   = SRC_MRHF_ADFIR_MULTI_MAX_CH;
+        sCase.uiNTaps       = FILTER_DEFS_ADFIR_PHASE_N_TAPS;
+        bench_run(&sCase, run_adfir_multi, &sMulti, uiNCalls, SRC_MRHF_ADFIR_MULTI_MAX_CH);
+        sCase.uiNChannels   = 1;
+    }
+#endif
+
+    // Spline coefficient generation, one sample is the 16 coefficients of one output instant
+    for(int iIsa = SRC_ISA_SCALAR; iIsa <= (int)eIsaDetected; iIsa++)
+    {
+        static spline_ctx_t sSpline;
+        SRCInnerLoop_t      pfSpline[2];
+
+        src_isa_force((SRCISA_t)iIsa);
+        if((int)src_isa_get_kernels(SRC_KERNEL_SPLINE, pfSpline) != iIsa)
+            continue;
+        sSpline.pfSpline        = pfSpline[0];
+        sCase.pzIsa             = pzIsaNames[iIsa];
+        sCase.uiNTaps           = FILTER_DEFS_ADFIR_PHASE_N_TAPS;
+        sCase.uiBlock           = 1;
+        if(bench_selected("spline"))
+        {
+            sCase.pzName        = "spline";
+            bench_run(&sCase, run_spline, &sSpline, uiNCalls, 1.0);
+        }
+    }
+    src_isa_force(SRC_ISA_N);
+
+    // The voice dot products have a C and an AVX2 version each
+    for(int iIsa = SRC_ISA_SCALAR; iIsa <= (int)eIsaDetected; iIsa++)
+    {
+        dot_ctx_t           sDot;
+
+        if(iIsa == SRC_ISA_SCALAR)
+        {
+            sDot.pfDot      = src_ff3v_fir_dot_c;
+            sDot.pfConv     = conv_s32_nt_c;
+        }
+#if defined(__x86_64__) || defined(__i386__)
+        else if(iIsa == SRC_ISA_AVX2)
+        {
+            sDot.pfDot      = src_ff3v_fir_dot_avx2;
+            sDot.pfConv     = conv_s32_nt_avx2;
+        }
+#endif
+        else
+            continue;
+        sCase.pzIsa         = pzIsaNames[iIsa];
+        sCase.uiBlock       = 1;
+        if(bench_selected("ff3v_dot"))
+        {
+            sCase.pzName    = "ff3v_dot";
+            sCase.uiNTaps   = SRC_FF3V_FIR_TAPS_PER_PHASE;
+            bench_run(&sCase, run_ff3v_dot, &sDot, uiNCalls, 1.0);
+        }
+        if(bench_selected("vpu_conv"))
+        {
+            sCase.pzName    = "vpu_conv";
+            sCase.uiNTaps   = sDot.uiNTaps = SRC_FF3_FIR_TAPS_PER_PHASE;
+            bench_run(&sCase, run_conv, &sDot, uiNCalls, 1.0);
+        }
+    }
+}
+
+// ===========================================================================
+//
+// Top level APIs
+//
+// ===========================================================================
+
+typedef struct
+{
+    asrc_ctrl_t     sCtrl[BENCH_MAX_CHANNELS];
+    ssrc_ctrl_t     sSsrcCtrl[BENCH_MAX_CHANNELS];
+    asrc_f32_ctrl_t sCtrlF32[BENCH_MAX_CHANNELS];
+    ssrc_f32_ctrl_t sSsrcCtrlF32[BENCH_MAX_CHANNELS];
+    int*            piIn[BENCH_MAX_CHANNELS];
+    int*            piOut[BENCH_MAX_CHANNELS];
+    uint64_t        u64Ratio;
+} mrhf_ctx_t;
+
+static void run_asrc(void *pvCtx, unsigned uiNCalls)
+{
+    mrhf_ctx_t     *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        iSink = asrc_process(iIn, iOut, psCtx->u64Ratio, psCtx->sCtrl);
+}
+
+static void run_ssrc(void *pvCtx, unsigned uiNCalls)
+{
+    mrhf_ctx_t     *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        iSink = ssrc_process(iIn, iOut, psCtx->sSsrcCtrl);
+}
+
+static void run_asrc_planar(void *pvCtx, unsigned uiNCalls)
+{
+    mrhf_ctx_t     *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        iSink = asrc_process_planar(psCtx->piIn, psCtx->piOut, psCtx->u64Ratio, psCtx->sCtrl);
+}
+
+static void run_ssrc_planar(void *pvCtx, unsigned uiNCalls)
+{
+    mrhf_ctx_t     *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        iSink = ssrc_process_planar(psCtx->piIn, psCtx->piOut, psCtx->sSsrcCtrl);
+}
+
+static void run_asrc_f32(void *pvCtx, unsigned uiNCalls)
+{
+    mrhf_ctx_t     *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        iSink = asrc_f32_process(fIn, fOut, psCtx->u64Ratio, psCtx->sCtrlF32);
+}
+
+static void run_ssrc_f32(void *pvCtx, unsigned uiNCalls)
+{
+    mrhf_ctx_t     *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        iSink = ssrc_f32_process(fIn, fOut, psCtx->sSsrcCtrlF32);
+}
+
+static void bench_mrhf(void)
+{
+    static mrhf_ctx_t           sCtx;
+    static asrc_state_t         sAsrcState[BENCH_MAX_CHANNELS];
+    static ssrc_state_t         sSsrcState[BENCH_MAX_CHANNELS];
+    static int                  iStack[BENCH_MAX_CHANNELS][ASRC_STACK_LENGTH_MULT * BENCH_MAX_BLOCK];
+    static int                  iSsrcStack[BENCH_MAX_CHANNELS][SSRC_STACK_LENGTH_MULT * BENCH_MAX_BLOCK];
+    static asrc_adfir_coefs_t   sCoefs;
+    static int                  iF3Delay[ASRC_F3_INTERLEAVED_DELAY_LENGTH(BENCH_MAX_CHANNELS)] __attribute__((aligned(64)));
+    static asrc_f32_state_t     sAsrcStateF32[BENCH_MAX_CHANNELS];
+    static ssrc_f32_state_t     sSsrcStateF32[BENCH_MAX_CHANNELS];
+    static float                fStack[BENCH_MAX_CHANNELS][ASRC_STACK_LENGTH_MULT * BENCH_MAX_BLOCK];
+    static float                fSsrcStack[BENCH_MAX_CHANNELS][SSRC_STACK_LENGTH_MULT * BENCH_MAX_BLOCK];
+    SRCKernelsF32_t             sKernelsF32;
+    const char                 *pzIsaF32        = pzIsaNames[src_isa_get_kernels_f32(&sKernelsF32)];
+    const unsigned             *puiChannels     = uiQuick ? uiChannelsQuick : uiChannelsFull;
+    const unsigned             *puiBlocks       = uiQuick ? uiBlocksQuick : uiBlocksFull;
+    unsigned                    uiNChannelSets  = uiQuick ? 1 : sizeof(uiChannelsFull) / sizeof(unsigned);
+    unsigned                    uiNBlockSets    = uiQuick ? 1 : sizeof(uiBlocksFull) / sizeof(unsigned);
+    unsigned                    uiFramesPerRep  = uiQuick ? 256 : 4096;
+    bench_case_t                sCase           = { NULL, "api", pzIsaNames[src_isa_detect()], 0, 0, 0, 0, 0 };
+
+    for(unsigned ui = 0; ui < BENCH_MAX_CHANNELS * BENCH_MAX_BLOCK; ui++)
+    {
+        iIn[ui] = (int)(ui * 2654435761u) >> 2;
+        fIn[ui] = (float)iIn[ui] * (1.0f / 2147483648.0f);
+    }
+    for(unsigned ch = 0; ch < BENCH_MAX_CHANNELS; ch++)
+    {
+        sCtx.piIn[ch]   = &iIn[ch * BENCH_MAX_BLOCK];
+        sCtx.piOut[ch]  = &iOut[ch * BENCH_MAX_BLOCK * BENCH_OUT_IN_RATIO_MAX];
+    }
+
+    for(unsigned uiFsIn = 0; uiFsIn < ASRC_N_FS; uiFsIn++)
+        for(unsigned uiFsOut = 0; uiFsOut < ASRC_N_FS; uiFsOut++)
+            for(unsigned uc = 0; uc < uiNChannelSets; uc++)
+                for(unsigned ub = 0; ub < uiNBlockSets; ub++)
+                {
+                    unsigned uiNChannels    = puiChannels[uc];
+                    unsigned uiBlock        = puiBlocks[ub];
+                    unsigned uiNCalls       = uiFramesPerRep / uiBlock;
+
+                    sCase.uiFsIn            = uiFsHz[uiFsIn];
+                    sCase.uiFsOut           = uiFsHz[uiFsOut];
+                    sCase.uiNChannels       = uiNChannels;
+                    sCase.uiBlock           = uiBlock;
+
+                    for(unsigned ch = 0; ch < uiNChannels; ch++)
+                    {
+                        sCtx.sCtrl[ch].psState      = &sAsrcState[ch];
+                        sCtx.sCtrl[ch].piStack      = iStack[ch];
+                        sCtx.sCtrl[ch].piADCoefs    = sCoefs.iASRCADFIRCoefs;
+                    }
+                    if(bench_selected("asrc"))
+                    {
+                        sCtx.u64Ratio   = asrc_init(uiFsIn, uiFsOut, sCtx.sCtrl, uiNChannels, uiBlock, OFF);
+                        sCase.pzName    = "asrc";
+                        bench_run(&sCase, run_asrc, &sCtx, uiNCalls, (double)uiBlock * uiNChannels);
+                    }
+                    if(bench_selected("asrc_mirrored"))
+                    {
+                        sCtx.u64Ratio   = asrc_init(uiFsIn, uiFsOut, sCtx.sCtrl, uiNChannels, uiBlock, OFF);
+                        if(asrc_init_mirrored_delays(sCtx.sCtrl))
+                        {
+                            sCase.pzName    = "asrc_mirrored";
+                            bench_run(&sCase, run_asrc, &sCtx, uiNCalls, (double)uiBlock * uiNChannels);
+                            asrc_exit_mirrored_delays(sCtx.sCtrl);
+                        }
+                    }
+                    if(bench_selected("ssrc_mirrored"))
+                    {
+                        for(unsigned ch = 0; ch < uiNChannels; ch++)
+                        {
+                            sCtx.sSsrcCtrl[ch].psState  = &sSsrcState[ch];
+                            sCtx.sSsrcCtrl[ch].piStack  = iSsrcStack[ch];
+                        }
+                        ssrc_init(uiFsIn, uiFsOut, sCtx.sSsrcCtrl, uiNChannels, uiBlock, OFF);
+                        if(ssrc_init_mirrored_delays(sCtx.sSsrcCtrl))
+                        {
+                            sCase.pzName    = "ssrc_mirrored";
+                            bench_run(&sCase, run_ssrc, &sCtx, uiNCalls, (double)uiBlock * uiNChannels);
+                            ssrc_exit_mirrored_delays(sCtx.sSsrcCtrl);
+                        }
+                    }
+                    if(bench_selected("asrc_interleaved") && uiNChannels > 1)
+                    {
+                        sCtx.u64Ratio   = asrc_init(uiFsIn, uiFsOut, sCtx.sCtrl, uiNChannels, uiBlock, OFF);
+                        asrc_init_f3_interleaved(sCtx.sCtrl, iF3Delay);
+                        sCase.pzName    = "asrc_interleaved";
+                        bench_run(&sCase, run_asrc, &sCtx, uiNCalls, (double)uiBlock * uiNChannels);
+                    }
+                    if(bench_selected("asrc_planar"))
+                    {
+                        sCtx.u64Ratio   = asrc_init(uiFsIn, uiFsOut, sCtx.sCtrl, uiNChannels, uiBlock, OFF);
+                        sCase.pzName    = "asrc_planar";
+                        bench_run(&sCase, run_asrc_planar, &sCtx, uiNCalls, (double)uiBlock * uiNChannels);
+                    }
+                    if(bench_selected("ssrc"))
+                    {
+                        for(unsigned ch = 0; ch < uiNChannels; ch++)
+                        {
+                            sCtx.sSsrcCtrl[ch].psState  = &sSsrcState[ch];
+                            sCtx.sSsrcCtrl[ch].piStack  = iSsrcStack[ch];
+                        }
+                        ssrc_init(uiFsIn, uiFsOut, sCtx.sSsrcCtrl, uiNChannels, uiBlock, OFF);
+                        sCase.pzName    = "ssrc";
+                        bench_run(&sCase, run_ssrc, &sCtx, uiNCalls, (double)uiBlock * uiNChannels);
+                    }
+                    if(bench_selected("ssrc_planar"))
+                    {
+                        for(unsigned ch = 0; ch < uiNChannels; ch++)
+                        {
+                            sCtx.sSsrcCtrl[ch].psState  = &sSsrcState[ch];
+                            sCtx.sSsrcCtrl[ch].piStack  = iSsrcStack[ch];
+                        }
+                        ssrc_init(uiFsIn, uiFsOut, sCtx.sSsrcCtrl, uiNChannels, uiBlock, OFF);
+                        sCase.pzName    = "ssrc_planar";
+                        bench_run(&sCase, run_ssrc_planar, &sCtx, uiNCalls, (double)uiBlock * uiNChannels);
+                    }
+                    if(bench_selected("asrc_f32"))
+                    {
+                        bench_case_t    sCaseF32    = sCase;
+
+                        for(unsigned ch = 0; ch < uiNChannels; ch++)
+                        {
+                            sCtx.sCtrlF32[ch].psState   = &sAsrcStateF32[ch];
+                            sCtx.sCtrlF32[ch].pfStack   = fStack[ch];
+                        }
+                        sCtx.u64Ratio       = asrc_f32_init(uiFsIn, uiFsOut, sCtx.sCtrlF32, uiNChannels, uiBlock);
+                        sCaseF32.pzName     = "asrc_f32";
+                        sCaseF32.pzIsa      = pzIsaF32;
+                        bench_run(&sCaseF32, run_asrc_f32, &sCtx, uiNCalls, (double)uiBlock * uiNChannels);
+                    }
+                    if(bench_selected("ssrc_f32"))
+                    {
+                        bench_case_t    sCaseF32    = sCase;
+
+                        for(unsigned ch = 0; ch < uiNChannels; ch++)
+                        {
+                            sCtx.sSsrcCtrlF32[ch].psState   = &sSsrcStateF32[ch];
+                            sCtx.sSsrcCtrlF32[ch].pfStack   = fSsrcStack[ch];
+                        }
+                        ssrc_f32_init(uiFsIn, uiFsOut, sCtx.sSsrcCtrlF32, uiNChannels, uiBlock);
+                        sCaseF32.pzName     = "ssrc_f32";
+                        sCaseF32.pzIsa      = pzIsaF32;
+                        bench_run(&sCaseF32, run_ssrc_f32, &sCtx, uiNCalls, (double)uiBlock * uiNChannels);
+                    }
+                }
+}
+
+typedef struct
+{
+    asrc_ctrl_t     sCtrl[BENCH_MT_MAX_CHANNELS];
+    asrc_mt_t       sMt;
+    uint64_t        u64Ratio;
+} mt_ctx_t;
+
+static void run_asrc_mt(void *pvCtx, unsigned uiNCalls)
+{
+    mt_ctx_t       *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        iSink = asrc_mt_process(iIn, iOut, psCtx->u64Ratio, &psCtx->sMt);
+}
+
+// Wall clock time of a many channel instance on a pool of threads, so the samples per second
+// are those of the pool rather than of one core
+static void bench_mt(void)
+{
+    static const char          *pzNames[]       = { "asrc_mt1", "asrc_mt2", "asrc_mt4", "asrc_mt8" };
+    static const unsigned       uiNThreads[]    = { 1, 2, 4, 8 };
+    static const unsigned       uiPairs[][2]    = { { FS_CODE_48, FS_CODE_44 }, { FS_CODE_44, FS_CODE_48 } };
+    static mt_ctx_t             sCtx;
+    static asrc_state_t         sState[BENCH_MT_MAX_CHANNELS];
+    static int                  iStack[BENCH_MT_MAX_CHANNELS][ASRC_STACK_LENGTH_MULT * BENCH_MT_BLOCK];
+    static asrc_adfir_coefs_t   sCoefs;
+    static int                  iSched[BENCH_MT_BLOCK * BENCH_OUT_IN_RATIO_MAX * (FILTER_DEFS_ADFIR_PHASE_N_TAPS + 1)];
+    unsigned                    uiNChannels     = uiQuick ? 8 : BENCH_MT_MAX_CHANNELS;
+    unsigned                    uiBlock         = uiQuick ? 16 : BENCH_MT_BLOCK;
+    unsigned                    uiNCalls        = (uiQuick ? 256 : 4096) / uiBlock;
+    bench_case_t                sCase           = { NULL, "api", pzIsaNames[src_isa_detect()], 0, 0, uiNChannels, uiBlock, 0 };
+
+    for(unsigned up = 0; up < (uiQuick ? 1 : sizeof(uiPairs) / sizeof(uiPairs[0])); up++)
+        for(unsigned ut = uiQuick ? 1 : 0; ut < (uiQuick ? 2 : sizeof(uiNThreads) / sizeof(unsigned)); ut++)
+        {
+            if(!bench_selected(pzNames[ut]))
+                continue;
+            for(unsigned ch = 0; ch < uiNChannels; ch++)
+            {
+                sCtx.sCtrl[ch].psState      = &sState[ch];
+                sCtx.sCtrl[ch].piStack      = iStack[ch];
+                sCtx.sCtrl[ch].piADCoefs    = sCoefs.iASRCADFIRCoefs;
+            }
+            sCtx.u64Ratio   = asrc_init(uiPairs[up][0], uiPairs[up][1], sCtx.sCtrl, uiNChannels, uiBlock, OFF);
+            if(asrc_mt_buffer_length(sCtx.sCtrl) > sizeof(iSched) / sizeof(int))
+                bench_error("schedule too long for", pzNames[ut]);
+            asrc_mt_init(&sCtx.sMt, sCtx.sCtrl, uiNThreads[ut], iSched);
+
+            sCase.pzName    = pzNames[ut];
+            sCase.uiFsIn    = uiFsHz[uiPairs[up][0]];
+            sCase.uiFsOut   = uiFsHz[uiPairs[up][1]];
+            bench_run(&sCase, run_asrc_mt, &sCtx, uiNCalls, (double)uiBlock * uiNChannels);
+            asrc_mt_exit(&sCtx.sMt);
+        }
+}
+
+typedef struct
+{
+    src_ds3_ctrl_t  sDs3;
+    src_os3_ctrl_t  sOs3;
+    int             iDs3Delay[SRC_FF3_DS3_N_COEFS << 1];
+    int             iOs3Delay[(SRC_FF3_OS3_N_COEFS / SRC_FF3_OS3_N_PHASES) << 1];
+    int32_t         iVoiceDs3[SRC_FF3V_FIR_NUM_PHASES][SRC_FF3V_FIR_TAPS_PER_PHASE];
+    int32_t         iVoiceUs3[SRC_FF3V_FIR_TAPS_PER_PHASE];
+    int32_t         iPolyDs[SRC_FF3_FIR_NUM_PHASES][SRC_FF3_FIR_TAPS_PER_PHASE];
+    int32_t         iPolyUs[SRC_FF3_FIR_TAPS_PER_PHASE];
+    int32_t         iRatDs[SRC_RAT_FIR_TAPS_PER_PHASE_DS];
+    int32_t         iRatUs[SRC_RAT_FIR_TAPS_PER_PHASE_US];
+    int             iDs3Out;
+} ff3_ctx_t;
+
+// Three input samples to one output sample per call
+static void run_ds3(void *pvCtx, unsigned uiNCalls)
+{
+    ff3_ctx_t      *psCtx   = pvCtx;
+
+    psCtx->sDs3.out_data    = &psCtx->iDs3Out;
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+    {
+        psCtx->sDs3.in_data = &iIn[3 * (ui & 63)];
+        src_ds3_proc(&psCtx->sDs3);
+    }
+    iSink = psCtx->iDs3Out;
+}
+
+// One input sample to three output samples per call
+static void run_os3(void *pvCtx, unsigned uiNCalls)
+{
+    ff3_ctx_t      *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+    {
+        psCtx->sOs3.in_data = iIn[ui & 255];
+        src_os3_input(&psCtx->sOs3);
+        for(unsigned uj = 0; uj < SRC_FF3_OS3_N_PHASES; uj++)
+            src_os3_proc(&psCtx->sOs3);
+    }
+    iSink = psCtx->sOs3.out_data;
+}
+
+static void run_ds3_voice(void *pvCtx, unsigned uiNCalls)
+{
+    ff3_ctx_t      *psCtx   = pvCtx;
+    int64_t         sum     = 0;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+    {
+        int *piIn = &iIn[3 * (ui & 63)];
+        sum = src_ds3_voice_add_sample(sum, psCtx->iVoiceDs3[0], src_ff3v_fir_coefs[0], piIn[0]);
+        sum = src_ds3_voice_add_sample(sum, psCtx->iVoiceDs3[1], src_ff3v_fir_coefs[1], piIn[1]);
+        sum = src_ds3_voice_add_final_sample(sum, psCtx->iVoiceDs3[2], src_ff3v_fir_coefs[2], piIn[2]);
+    }
+    iSink = (int)sum;
+}
+
+static void run_us3_voice(void *pvCtx, unsigned uiNCalls)
+{
+    ff3_ctx_t      *psCtx   = pvCtx;
+    int32_t         iAcc    = 0;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+    {
+        iAcc += src_us3_voice_input_sample(psCtx->iVoiceUs3, src_ff3v_fir_coefs[2], iIn[ui & 255]);
+        iAcc += src_us3_voice_get_next_sample(psCtx->iVoiceUs3, src_ff3v_fir_coefs[1]);
+        iAcc += src_us3_voice_get_next_sample(psCtx->iVoiceUs3, src_ff3v_fir_coefs[0]);
+    }
+    iSink = iAcc;
+}
+
+static void run_ff3_96t_ds(void *pvCtx, unsigned uiNCalls)
+{
+    ff3_ctx_t      *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        src_ff3_96t_ds(&iIn[3 * (ui & 63)], iOut, src_ff3_fir_coefs, psCtx->iPolyDs);
+    iSink = iOut[0];
+}
+
+static void run_ff3_96t_us(void *pvCtx, unsigned uiNCalls)
+{
+    ff3_ctx_t      *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        src_ff3_96t_us(&iIn[ui & 255], iOut, src_ff3_fir_coefs, psCtx->iPolyUs);
+    iSink = iOut[0];
+}
+
+static void run_rat_2_3_96t_ds(void *pvCtx, unsigned uiNCalls)
+{
+    ff3_ctx_t      *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        src_rat_2_3_96t_ds(&iIn[3 * (ui & 63)], iOut, src_rat_fir_ds_coefs, psCtx->iRatDs);
+    iSink = iOut[0];
+}
+
+static void run_rat_3_2_96t_us(void *pvCtx, unsigned uiNCalls)
+{
+    ff3_ctx_t      *psCtx   = pvCtx;
+
+    for(unsigned ui = 0; ui < uiNCalls; ui++)
+        src_rat_3_2_96t_us(&iIn[2 * (ui & 127)], iOut, src_rat_fir_us_coefs, psCtx->iRatUs);
+    iSink = iOut[0];
+}
+
+static void bench_ff3(void)
+{
+    static ff3_ctx_t    sCtx;
+    unsigned            uiNCalls    = uiQuick ? 1000 : 20000;
+    bench_case_t        sCase       = { NULL, "api", pzIsaNames[src_isa_detect()], 0, 0, 1, 0, 0 };
+    static const struct
+    {
+        const char     *pzName;
+        bench_fn_t      pfRun;
+        unsigned        uiBlock;        // Input samples per call
+        unsigned        uiFsIn, uiFsOut;
+        unsigned        uiNTaps;
+    } sCases[] =
+    {
+        { "ds3",            run_ds3,            3, 48000, 16000, SRC_FF3_DS3_N_COEFS },
+        { "os3",            run_os3,            1, 16000, 48000, SRC_FF3_OS3_N_COEFS },
+        { "ds3_voice",      run_ds3_voice,      3, 48000, 16000, SRC_FF3V_FIR_NUM_PHASES * SRC_FF3V_FIR_TAPS_PER_PHASE },
+        { "us3_voice",      run_us3_voice,      1, 16000, 48000, SRC_FF3V_FIR_NUM_PHASES * SRC_FF3V_FIR_TAPS_PER_PHASE },
+        { "ff3_96t_ds",     run_ff3_96t_ds,     3, 48000, 16000, SRC_FF3_FIR_NUM_PHASES * SRC_FF3_FIR_TAPS_PER_PHASE },
+        { "ff3_96t_us",     run_ff3_96t_us,     1, 16000, 48000, SRC_FF3_FIR_NUM_PHASES * SRC_FF3_FIR_TAPS_PER_PHASE },
+        { "rat_2_3_96t_ds", run_rat_2_3_96t_ds, 3, 48000, 32000, SRC_RAT_FIR_NUM_TAPS },
+        { "rat_3_2_96t_us", run_rat_3_2_96t_us, 2, 32000, 48000, SRC_RAT_FIR_NUM_TAPS },
+    };
+
+    sCtx.sDs3.delay_base    = sCtx.iDs3Delay;
+    sCtx.sOs3.delay_base    = sCtx.iOs3Delay;
+    if(src_ds3_init(&sCtx.sDs3) != SRC_FF3_NO_ERROR || src_ds3_sync(&sCtx.sDs3) != SRC_FF3_NO_ERROR ||
+       src_os3_init(&sCtx.sOs3) != SRC_FF3_NO_ERROR || src_os3_sync(&sCtx.sOs3) != SRC_FF3_NO_ERROR)
+        bench_error("ff3 init", NULL);
+
+    for(unsigned ui = 0; ui < sizeof(sCases) / sizeof(sCases[0]); ui++)
+    {
+        if(!bench_selected(sCases[ui].pzName))
+            continue;
+        sCase.pzName    = sCases[ui].pzName;
+        sCase.uiFsIn    = sCases[ui].uiFsIn;
+        sCase.uiFsOut   = sCases[ui].uiFsOut;
+        sCase.uiBlock   = sCases[ui].uiBlock;
+        sCase.uiNTaps   = sCases[ui].uiNTaps;
+        bench_run(&sCase, sCases[ui].pfRun, &sCtx, uiNCalls, sCases[ui].uiBlock);
+    }
+}
+
+static void parse_args(int argc, char *argv[], const char **ppzOutFileName)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        char *a = argv[i];
+        char *v;
+        if(a[0] != '-' || a[1] == 0)
+            bench_error("unexpected argument", a);
+        if(a[1] == 'q')
+        {
+            uiQuick = 1;
+            continue;
+        }
+        // Options take their value either attached, as for host_dut, or as the next argument
+        v = a[2] ? a + 2 : (i + 1 < argc ? argv[++i] : NULL);
+        if(v == NULL)
+            bench_error("missing value for", a);
+        switch(a[1])
+        {
+            case 'o': *ppzOutFileName   = v;                                    break;
+            case 'f': pzFilter          = v;                                    break;
+            case 'r': uiNReps           = (unsigned)atoi(v);                    break;
+            case 'i': src_isa_force((SRCISA_t)atoi(v));                         break;
+            default:  bench_error("unknown option", a);
+        }
+    }
+    if(uiNReps < 1 || uiNReps > BENCH_MAX_REPS)
+        bench_error("repetitions out of range", NULL);
+}
+
+int main(int argc, char *argv[])
+{
+    const char         *pzOutFileName   = NULL;
+    SRCISA_t            eIsaLimit;
+
+    parse_args(argc, argv, &pzOutFileName);
+    if(uiQuick && uiNReps > 5)
+        uiNReps = 5;
+
+    // -i limits every case. The kernel sweeps force each ISA in turn, so put the limit back after them
+    eIsaDetected    = src_isa_detect();
+    eIsaLimit       = eIsaDetected;
+
+    pfJson = pzOutFileName ? fopen(pzOutFileName, "wt") : stdout;
+    if(pfJson == NULL)
+        bench_error("cannot create output file", pzOutFileName);
+
+    fprintf(pfJson, "{\n  \"lib_src_version\": \"%s\",\n  \"isa\": \"%s\",\n  \"quick\": %s,\n  \"repetitions\": %u,\n  \"results\": [",
+            LIB_SRC_VERSION, pzIsaNames[eIsaDetected], uiQuick ? "true" : "false", uiNReps);
+
+    bench_kernels();
+    src_isa_force(eIsaLimit);
+    bench_mrhf();
+    bench_mt();
+    bench_ff3();
+
+    fprintf(pfJson, "\n  ]\n}\n");
+    if(pfJson != stdout)
+        fclose(pfJson);
+
+    if(uiNCases == 0)
+        bench_error("no case matches", pzFilter);
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks ssrc_init_arena() and asrc_init_arena(). For every pair of rate
+// codes an SSRC and an ASRC instance with all their memory in an arena of
+// the size given by *_get_memory_requirements() must give exactly the
+// output of one with state structures and stacks, with dither on. The
+// arena is filled with a pattern past its end, which must be left alone,
+// and must be smaller than the state structures and stacks it replaces.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define     ASRC_N_CHANNELS             2
+#define     SSRC_N_CHANNELS             2
+#define     SSRC_N_IN_SAMPLES           4
+#include "src.h"
+#include "test_util.h"
+
+#define     N_CHANNELS                  2
+#define     N_IN_SAMPLES                16
+#define     N_BLOCKS                    200
+#define     N_OUT_IN_RATIO_MAX          5
+#define     N_GUARD                     16
+#define     GUARD                       0x5A5A5A5A
+
+static int      iIn[N_CHANNELS * N_IN_SAMPLES];
+static int      iOut[2][N_CHANNELS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+
+// Large enough for either arena, with the guard words after it
+static uint64_t u64Arena[(sizeof(asrc_state_t) + sizeof(asrc_adfir_coefs_t) +
+                          ASRC_STACK_LENGTH_MULT * N_IN_SAMPLES * sizeof(int)) * N_CHANNELS / sizeof(uint64_t) + N_GUARD];
+
+// Sets the guard words after an arena of uiBytes, returns 0 if they do not fit
+static int set_guard(unsigned uiBytes)
+{
+    unsigned    uiWords = (uiBytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    if(uiWords + N_GUARD > sizeof(u64Arena) / sizeof(uint64_t))
+        return 0;
+    memset(u64Arena, 0, sizeof(u64Arena));
+    memset(&u64Arena[uiWords], 0x5A, N_GUARD * sizeof(uint64_t));
+    return 1;
+}
+
+static int guard_intact(unsigned uiBytes)
+{
+    unsigned    uiWords = (uiBytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    int*        piGuard = (int*)&u64Arena[uiWords];
+
+    for(unsigned ui = 0; ui < 2 * N_GUARD; ui++)
+        if(piGuard[ui] != (int)GUARD)
+            return 0;
+    return 1;
+}
+
+static void test_ssrc(fs_code_t eIn, fs_code_t eOut)
+{
+    static test_ssrc_t      sInst;
+    static ssrc_ctrl_t      sCtrl[N_CHANNELS];
+    unsigned                uiBytes;
+    uint32_t                uiSeed  = 1;
+
+    test_case("SSRC %u->%u", uiFsHz[eIn], uiFsHz[eOut]);
+    uiBytes = ssrc_get_memory_requirements(eIn, eOut, N_CHANNELS, N_IN_SAMPLES);
+    if(uiBytes >= N_CHANNELS * (sizeof(ssrc_state_t) + SSRC_STACK_LENGTH_MULT * N_IN_SAMPLES * sizeof(int)))
+        fail("arena not smaller");
+    if(!set_guard(uiBytes))
+    {
+        fail("arena too large for the test");
+        return;
+    }
+
+    test_ssrc_init(&sInst, eIn, eOut, N_CHANNELS, N_IN_SAMPLES, ON);
+    ssrc_init_arena(eIn, eOut, sCtrl, N_CHANNELS, N_IN_SAMPLES, ON, u64Arena);
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        unsigned n0, n1;
+
+        next_block(iIn, N_CHANNELS * N_IN_SAMPLES, &uiSeed);
+        n0 = ssrc_process(iIn, iOut[0], sInst.sCtrl);
+        n1 = ssrc_process(iIn, iOut[1], sCtrl);
+        if(n0 != n1 || memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) != 0)
+        {
+            fail("output differs");
+            return;
+        }
+    }
+    if(!guard_intact(uiBytes))
+        fail("written past the arena");
+}
+
+static void test_asrc(fs_code_t eIn, fs_code_t eOut)
+{
+    static test_asrc_t          sInst;
+    static asrc_ctrl_t          sCtrl[N_CHANNELS];
+    unsigned                    uiBytes;
+    uint32_t                    uiSeed  = 2;
+    uint64_t                    u64Ratio;
+
+    test_case("ASRC %u->%u", uiFsHz[eIn], uiFsHz[eOut]);
+    uiBytes = asrc_get_memory_requirements(eIn, eOut, N_CHANNELS, N_IN_SAMPLES);
+    if(uiBytes >= N_CHANNELS * (sizeof(asrc_state_t) + ASRC_STACK_LENGTH_MULT * N_IN_SAMPLES * sizeof(int)) + sizeof(asrc_adfir_coefs_t))
+        fail("arena not smaller");
+    if(!set_guard(uiBytes))
+    {
+        fail("arena too large for the test");
+        return;
+    }
+
+    u64Ratio = test_asrc_init(&sInst, eIn, eOut, N_CHANNELS, N_IN_SAMPLES, ON);
+    if(asrc_init_arena(eIn, eOut, sCtrl, N_CHANNELS, N_IN_SAMPLES, ON, u64Arena) != u64Ratio)
+        fail("nominal ratio differs");
+    // Slightly off nominal, so the F3 phases move
+    u64Ratio += u64Ratio >> 10;
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        unsigned n0, n1;
+
+        next_block(iIn, N_CHANNELS * N_IN_SAMPLES, &uiSeed);
+        n0 = asrc_process(iIn, iOut[0], u64Ratio, sInst.sCtrl);
+        n1 = asrc_process(iIn, iOut[1], u64Ratio, sCtrl);
+        if(n0 != n1 || memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) != 0)
+        {
+            fail("output differs");
+            return;
+        }
+    }
+    if(!guard_intact(uiBytes))
+        fail("written past the arena");
+}
+
+int main(void)
+{
+    for(fs_code_t eIn = FS_CODE_44; eIn <= FS_CODE_192; eIn++)
+        for(fs_code_t eOut = FS_CODE_44; eOut <= FS_CODE_192; eOut++)
+        {
+            test_ssrc(eIn, eOut);
+            test_asrc(eIn, eOut);
+        }
+
+    return test_result();
+}
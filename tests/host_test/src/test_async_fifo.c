@@ -0,0 +1,161 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks the host asynchronous FIFO. First single threaded, with puts and
+// gets interleaved so that every frame must come out in order across many
+// buffer wraps. Then with the producer and consumer on two threads, where
+// every frame that comes out must be a complete frame that went in.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#include "asynchronous_fifo.h"
+
+#define     FIFO_LENGTH         100
+#define     N_CHANNELS          5
+#define     N_FRAMES_ST         100000
+#define     N_FRAMES_MT         2000000
+#define     BLOCK               4
+
+static int64_t  fifo_storage[ASYNCHRONOUS_FIFO_INT64_ELEMENTS(FIFO_LENGTH, N_CHANNELS)];
+static int      iFailures = 0;
+static atomic_int   producer_done;
+
+static void make_frame(int32_t *frame, int32_t seq)
+{
+    for(int c = 0; c < N_CHANNELS; c++)
+        frame[c] = seq * N_CHANNELS + c;
+}
+
+// Returns the sequence number of the frame, 0 for silence, or -1 if it is torn
+static int32_t frame_seq(const int32_t *frame)
+{
+    int32_t seq = frame[0] / N_CHANNELS;
+    int     silent = 1;
+    for(int c = 0; c < N_CHANNELS; c++)
+        silent &= (frame[c] == 0);
+    if(silent)
+        return 0;
+    for(int c = 0; c < N_CHANNELS; c++)
+        if(frame[c] != seq * N_CHANNELS + c)
+            return -1;
+    return seq;
+}
+
+static uint32_t now_ticks(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)(t.tv_sec * 100000000ull + t.tv_nsec / 10);   // 100 MHz, as the xcore reference clock
+}
+
+static void test_single_thread(asynchronous_fifo_t *fifo)
+{
+    int32_t     block[BLOCK * N_CHANNELS], frame[N_CHANNELS];
+    int32_t     expect = 1;
+    int         zeros = 0;
+
+    asynchronous_fifo_init(fifo, N_CHANNELS, FIFO_LENGTH);
+    asynchronous_fifo_init_PID_raw(fifo, 30000000, 200, 2083);
+
+    // The FIFO starts half full of silence, after that the frames must come out in order
+    for(int32_t seq = 1; seq < N_FRAMES_ST; seq += BLOCK)
+    {
+        for(int k = 0; k < BLOCK; k++)
+            make_frame(&block[k * N_CHANNELS], seq + k);
+        asynchronous_fifo_producer_put(fifo, block, BLOCK, seq * 2083, 0);
+        for(int k = 0; k < BLOCK; k++)
+        {
+            asynchronous_fifo_consumer_get(fifo, frame, (seq + k) * 2083);
+            if(frame_seq(frame) == 0 && expect == 1)
+                zeros++;
+            else if(frame_seq(frame) != expect++)
+            {
+                if(iFailures++ < 10)
+                    printf("FAIL single thread: got frame %d expected %d\n", frame_seq(frame), expect - 1);
+            }
+        }
+    }
+    if(zeros != FIFO_LENGTH / 2)
+    {
+        printf("FAIL single thread: %d frames of silence, expected %d\n", zeros, FIFO_LENGTH / 2);
+        iFailures++;
+    }
+}
+
+static void *producer(void *arg)
+{
+    asynchronous_fifo_t    *fifo = arg;
+    int32_t                 block[BLOCK * N_CHANNELS];
+
+    for(int32_t seq = 1; seq < N_FRAMES_MT; seq += BLOCK)
+    {
+        for(int k = 0; k < BLOCK; k++)
+            make_frame(&block[k * N_CHANNELS], seq + k);
+        asynchronous_fifo_producer_put(fifo, block, BLOCK, now_ticks(), 0);
+    }
+    atomic_store(&producer_done, 1);
+    return NULL;
+}
+
+static void test_two_threads(asynchronous_fifo_t *fifo)
+{
+    pthread_t   thread;
+    int32_t     frame[N_CHANNELS];
+    int32_t     last = 0;
+    long        in_order = 0;
+
+    asynchronous_fifo_init(fifo, N_CHANNELS, FIFO_LENGTH);
+    asynchronous_fifo_init_PID_raw(fifo, 30000000, 200, 2083);
+
+    atomic_store(&producer_done, 0);
+    pthread_create(&thread, NULL, producer, fifo);
+    while(!atomic_load(&producer_done))
+    {
+        int32_t seq;
+        asynchronous_fifo_consumer_get(fifo, frame, now_ticks());
+        seq = frame_seq(frame);
+        if(seq < 0)
+        {
+            if(iFailures++ < 10)
+                printf("FAIL two threads: torn frame %d %d\n", frame[0], frame[N_CHANNELS - 1]);
+        }
+        else if(seq == last + 1)
+            in_order++;
+        last = seq;
+    }
+    pthread_join(thread, NULL);
+
+    // The threads run at unrelated rates and the FIFO resets when it runs dry or overflows,
+    // so only require that frames got through in order at all
+    if(in_order < FIFO_LENGTH)
+    {
+        printf("FAIL two threads: only %ld frames in order\n", in_order);
+        iFailures++;
+    }
+}
+
+int main(void)
+{
+    asynchronous_fifo_t *fifo = (asynchronous_fifo_t *)fifo_storage;
+
+    test_single_thread(fifo);
+    test_two_threads(fifo);
+
+    if(iFailures)
+    {
+        printf("%d failures\n", iFailures);
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,198 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks the float32 SSRC and ASRC against the fixed point ones. Both are
+// fed the same samples (the fixed point input has its low bits clear, so
+// the float input is exact) with dither off, at every pair of rate codes
+// and at a few pairs planned by asrc_f32_init_rates(). The ASRC Fs ratio
+// wanders around the nominal one. The number of output samples must be the
+// same and the outputs within MAX_ERROR_DB of full scale. This is run with
+// the kernels selected for the host, then with the portable C ones.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#define     ASRC_N_CHANNELS             2
+#define     SSRC_N_CHANNELS             2
+#define     SSRC_N_IN_SAMPLES           4
+#include "src.h"
+#include "src_mrhf_isa.h"
+#include "test_util.h"
+
+#define     N_CHANNELS                  2
+#define     N_IN_SAMPLES                16
+#define     N_OUT_IN_RATIO_MAX          10
+#define     N_BLOCKS                    512
+#define     MAX_ERROR_DB                -110.0
+
+// The float32 instances, the fixed point ones are a test_asrc_t and a test_ssrc_t
+typedef struct
+{
+    asrc_f32_state_t    sState[N_CHANNELS];
+    float               fStack[N_CHANNELS][ASRC_STACK_LENGTH_MULT * N_IN_SAMPLES];
+    asrc_f32_ctrl_t     sCtrl[N_CHANNELS];
+} asrc_f32_instance_t;
+
+typedef struct
+{
+    ssrc_f32_state_t    sState[N_CHANNELS];
+    float               fStack[N_CHANNELS][SSRC_STACK_LENGTH_MULT * N_IN_SAMPLES];
+    ssrc_f32_ctrl_t     sCtrl[N_CHANNELS];
+} ssrc_f32_instance_t;
+
+static int      iIn[N_CHANNELS * N_IN_SAMPLES];
+static float    fIn[N_CHANNELS * N_IN_SAMPLES];
+static int      iOut[N_CHANNELS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+static float    fOut[N_CHANNELS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+
+// Two sines per channel at -6dB, with the low 8 bits clear
+static void make_input(unsigned uiBlock, unsigned uiFsIn)
+{
+    for(unsigned ui = 0; ui < N_IN_SAMPLES; ui++)
+        for(unsigned uj = 0; uj < N_CHANNELS; uj++)
+        {
+            double  dT  = (double)(uiBlock * N_IN_SAMPLES + ui) / uiFsIn;
+            double  dX  = 0.25 * sin(2 * M_PI * 1000.0 * (uj + 1) * dT) + 0.25 * sin(2 * M_PI * 15000.0 * dT + uj);
+            int     iX  = (int)lround(dX * 2147483648.0) & ~0xFF;
+
+            iIn[N_CHANNELS * ui + uj]   = iX;
+            fIn[N_CHANNELS * ui + uj]   = (float)iX * (1.0f / 2147483648.0f);
+        }
+}
+
+// Returns the largest difference of the outputs, relative to full scale
+static double max_error(unsigned uiN)
+{
+    double  dMax    = 0;
+
+    for(unsigned ui = 0; ui < uiN * N_CHANNELS; ui++)
+    {
+        double dErr = fabs((double)fOut[ui] - (double)iOut[ui] / 2147483648.0);
+        if(dErr > dMax)
+            dMax = dErr;
+    }
+    return dMax;
+}
+
+static void check(double dMax)
+{
+    if(dMax > pow(10.0, MAX_ERROR_DB / 20))
+        fail("output differs by %.1fdB", 20 * log10(dMax));
+}
+
+static void test_ssrc(fs_code_t eIn, fs_code_t eOut)
+{
+    static test_ssrc_t          sInst;
+    static ssrc_f32_instance_t  sInstF32;
+    double                      dMax    = 0;
+
+    test_case("SSRC %u->%u", uiFsHz[eIn], uiFsHz[eOut]);
+    memset(&sInstF32, 0, sizeof(sInstF32));
+    for(unsigned uj = 0; uj < N_CHANNELS; uj++)
+    {
+        sInstF32.sCtrl[uj].psState  = &sInstF32.sState[uj];
+        sInstF32.sCtrl[uj].pfStack  = sInstF32.fStack[uj];
+    }
+    test_ssrc_init(&sInst, eIn, eOut, N_CHANNELS, N_IN_SAMPLES, OFF);
+    ssrc_f32_init(eIn, eOut, sInstF32.sCtrl, N_CHANNELS, N_IN_SAMPLES);
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        make_input(b, uiFsHz[eIn]);
+        unsigned n0 = ssrc_process(iIn, iOut, sInst.sCtrl);
+        unsigned n1 = ssrc_f32_process(fIn, fOut, sInstF32.sCtrl);
+        if(n0 != n1)
+        {
+            fail("number of output samples differs");
+            return;
+        }
+        double dErr = max_error(n0);
+        if(dErr > dMax)
+            dMax = dErr;
+    }
+    check(dMax);
+}
+
+// Rates as codes if uiFsIn and uiFsOut are 0, else planned
+static void test_asrc(fs_code_t eIn, fs_code_t eOut, unsigned uiFsIn, unsigned uiFsOut)
+{
+    static test_asrc_t          sInst;
+    static asrc_f32_instance_t  sInstF32;
+    uint64_t                    u64Nominal;
+    double                      dMax    = 0;
+
+    memset(&sInstF32, 0, sizeof(sInstF32));
+    for(unsigned uj = 0; uj < N_CHANNELS; uj++)
+    {
+        sInstF32.sCtrl[uj].psState  = &sInstF32.sState[uj];
+        sInstF32.sCtrl[uj].pfStack  = sInstF32.fStack[uj];
+    }
+    if(uiFsIn == 0)
+    {
+        uiFsIn      = uiFsHz[eIn];
+        uiFsOut     = uiFsHz[eOut];
+        test_case("ASRC %u->%u", uiFsIn, uiFsOut);
+        u64Nominal  = test_asrc_init(&sInst, eIn, eOut, N_CHANNELS, N_IN_SAMPLES, OFF);
+        if(asrc_f32_init(eIn, eOut, sInstF32.sCtrl, N_CHANNELS, N_IN_SAMPLES) != u64Nominal)
+            fail("nominal ratio differs");
+    }
+    else
+    {
+        test_case("ASRC %u->%u", uiFsIn, uiFsOut);
+        u64Nominal  = test_asrc_init_rates_arena(&sInst, uiFsIn, uiFsOut, N_CHANNELS, N_IN_SAMPLES, OFF);
+        if(asrc_f32_init_rates(uiFsIn, uiFsOut, sInstF32.sCtrl, N_CHANNELS, N_IN_SAMPLES) != u64Nominal)
+            fail("nominal ratio differs");
+    }
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        // Up to +/-500ppm off the nominal ratio
+        uint64_t u64Ratio   = u64Nominal + (int64_t)((double)u64Nominal * 5e-4 * sin(b * 0.05));
+
+        make_input(b, uiFsIn);
+        unsigned n0 = asrc_process(iIn, iOut, u64Ratio, sInst.sCtrl);
+        unsigned n1 = asrc_f32_process(fIn, fOut, u64Ratio, sInstF32.sCtrl);
+        if(n0 != n1)
+        {
+            fail("number of output samples differs");
+            return;
+        }
+        double dErr = max_error(n0);
+        if(dErr > dMax)
+            dMax = dErr;
+    }
+    check(dMax);
+}
+
+static void test_all(void)
+{
+    static const unsigned   uiPairs[][2] = {
+        {16000, 48000}, {48000, 32000}, {44100, 22050}, {48000, 384000}, {384000, 96000}
+    };
+
+    for(fs_code_t eIn = FS_CODE_44; eIn <= FS_CODE_192; eIn++)
+        for(fs_code_t eOut = FS_CODE_44; eOut <= FS_CODE_192; eOut++)
+        {
+            test_ssrc(eIn, eOut);
+            test_asrc(eIn, eOut, 0, 0);
+        }
+    for(unsigned ui = 0; ui < sizeof(uiPairs) / sizeof(uiPairs[0]); ui++)
+        test_asrc(0, 0, uiPairs[ui][0], uiPairs[ui][1]);
+}
+
+int main(void)
+{
+    test_all();
+    src_isa_force(SRC_ISA_SCALAR);
+    test_all();
+
+    return test_result();
+}
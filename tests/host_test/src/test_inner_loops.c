@@ -0,0 +1,467 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks the host C inner loops against a model of the xcore instruction
+// sequence in the corresponding .S files (LDD, MACCS, LSATS, LEXTRACT),
+// including accumulator wrap around and saturation corner cases. The x86
+// SIMD inner loops are checked as well when the CPU supports them, the XS2
+// voice functions against the same model and the VPU voice primitives
+// against a model of the XS3 VPU in 32 bit mode.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "src_mrhf_fir_inner_loop_asm.h"
+#include "src_mrhf_fir_os_inner_loop_asm.h"
+#include "src_mrhf_adfir_inner_loop_asm.h"
+#include "src_mrhf_spline_coeff_gen_inner_loop_asm.h"
+#include "src_ff3_fir_inner_loop_asm.h"
+#include "src_mrhf_isa.h"
+#include "src_low_level.h"
+#include "src_ff3v_fir_impl.h"
+#include "src.h"
+
+#define     MAX_TAPS        192
+#define     N_ITERATIONS    2000
+
+// xcore register pair model
+// -------------------------
+typedef struct { uint32_t h, l; } acc_t;
+
+static void maccs(acc_t *a, int32_t x, int32_t y)
+{
+    uint64_t v = ((uint64_t)a->h << 32) | a->l;
+    v += (uint64_t)((int64_t)x * (int64_t)y);
+    a->h = (uint32_t)(v >> 32);
+    a->l = (uint32_t)v;
+}
+
+static void lsats(acc_t *a, unsigned bit)
+{
+    int64_t v   = (int64_t)(((uint64_t)a->h << 32) | a->l);
+    int64_t max = (int64_t)((1ULL << (bit + 31)) - 1);
+    int64_t min = -max - 1;
+    if(v > max) v = max;
+    if(v < min) v = min;
+    a->h = (uint32_t)((uint64_t)v >> 32);
+    a->l = (uint32_t)v;
+}
+
+static int32_t lextract(acc_t *a, unsigned bit)
+{
+    uint64_t v = ((uint64_t)a->h << 32) | a->l;
+    return (int32_t)(uint32_t)(v >> bit);
+}
+
+// Reference models, following the instruction sequences in the .S files
+// ---------------------------------------------------------------------
+static int32_t ref_fir(int32_t *d, int32_t *c, int count, unsigned bit)
+{
+    acc_t acc = {0, 0};
+    for(int k = 0; k < (count >> 3); k++)
+        for(int j = 0; j < 8; j++)                  // 8 x (ldd data; ldd coefs; 2 x maccs)
+        {
+            maccs(&acc, d[16*k + 2*j],     c[16*k + 2*j]);
+            maccs(&acc, d[16*k + 2*j + 1], c[16*k + 2*j + 1]);
+        }
+    lsats(&acc, bit);
+    return lextract(&acc, bit);
+}
+
+static void ref_fir_os(int32_t *d, int32_t *c, int32_t out[2], int count)
+{
+    acc_t acc0 = {0, 0}, acc1 = {0, 0};
+    for(int k = 0; k < (count >> 2); k++)
+        for(int j = 0; j < 4; j++)                  // ldd iData1, iData0 / ldd iCoef0, iCoef1 (x2)
+        {
+            int32_t iData0 = d[8*k + 2*j], iData1 = d[8*k + 2*j + 1];
+            int32_t *pc = &c[16*k + 4*j];
+            maccs(&acc0, iData0, pc[1]);
+            maccs(&acc1, iData0, pc[0]);
+            maccs(&acc0, iData1, pc[3]);
+            maccs(&acc1, iData1, pc[2]);
+        }
+    lsats(&acc0, 31);
+    lsats(&acc1, 31);
+    out[1] = lextract(&acc0, 31);                   // std iData0, iData1, iDataRet_p[0]
+    out[0] = lextract(&acc1, 31);
+}
+
+static void ref_spline(int32_t *p0, int32_t h[3], int32_t out[16], int n_taps)
+{
+    for(int k = 0; k < 16; k += 2)
+    {
+        acc_t acc0 = {0, 0}, acc1 = {0, 0};
+        maccs(&acc0, h[2], p0[k + 1]);              // ldd iData0, iData1 loads iData0 from the odd word
+        maccs(&acc1, h[2], p0[k]);
+        maccs(&acc0, h[1], p0[n_taps + k + 1]);
+        maccs(&acc1, h[1], p0[n_taps + k]);
+        maccs(&acc0, h[0], p0[2*n_taps + k + 1]);
+        maccs(&acc1, h[0], p0[2*n_taps + k]);
+        out[k + 1] = (int32_t)acc0.h;               // std Acc0_h, Acc1_h
+        out[k]     = (int32_t)acc1.h;
+    }
+}
+
+static int32_t ref_ff3(int32_t *d, int32_t *c, int count)
+{
+    acc_t acc = {0, 0};
+    for(int k = 0; k < count; k++)
+        for(int j = 0; j < 2 * SRC_FF3_N_LOOPS_PER_ASM; j++)
+            maccs(&acc, d[24*k + j], c[24*k + j]);
+    lsats(&acc, 31);
+    return lextract(&acc, 31);
+}
+
+// src_ff3v_fir_impl: EVEN_STEP/ODD_STEP pairs, shifting the delay line up by one as they go
+static void ref_ff3v_impl(acc_t *a, int32_t *d, const int32_t *c, int32_t s)
+{
+    int32_t d0, d1 = 0;
+    for(int n = 0; n < SRC_FF3V_FIR_TAPS_PER_PHASE / 2; n++)
+    {
+        if((n & 1) == 0)
+        {
+            maccs(a, c[2*n], s);
+            d0 = d[2*n]; d1 = d[2*n + 1];
+            maccs(a, c[2*n + 1], d0);
+            d[2*n + 1] = d0; d[2*n] = s;
+        }
+        else
+        {
+            maccs(a, c[2*n], d1);
+            d0 = d[2*n]; s = d[2*n + 1];
+            maccs(a, c[2*n + 1], d0);
+            d[2*n + 1] = d0; d[2*n] = d1;
+        }
+    }
+}
+
+// Epilogue of the voice functions
+static int32_t ref_ff3v_comp(acc_t *a, int32_t comp, unsigned q)
+{
+    acc_t   acc = {0, 0};
+    maccs(&acc, lextract(a, 31), comp);
+    lsats(&acc, q);
+    return lextract(&acc, q);
+}
+
+// XS3 VPU model, 32 bit mode
+// --------------------------
+// VCLRDR, then per 8 taps VLDC/VLMACCR: the rounded products are added to the 40 bit
+// accumulator in lane 7 and the lanes rotate, VSTR stores the low 32 bits of each lane.
+static int32_t ref_vpu_conv(const int32_t *s, const int32_t *c, unsigned n_taps)
+{
+    int64_t     acc[8]  = {0};
+    uint32_t    out     = 0;
+
+    for(unsigned b = 0; b < n_taps / 8; b++)
+    {
+        int64_t sum = acc[7];
+        for(unsigned k = 0; k < 8; k++)
+            sum += ((int64_t)s[8*b + k] * c[8*b + k] + (1 << 29)) >> 30;
+        if(sum > (((int64_t)1 << 39) - 1))
+            sum = ((int64_t)1 << 39) - 1;
+        if(sum < -(((int64_t)1 << 39) - 1))
+            sum = -(((int64_t)1 << 39) - 1);
+        memmove(&acc[1], &acc[0], 7 * sizeof(int64_t));
+        acc[0] = sum;
+    }
+    // The assembler adds the lanes that hold results with 32 bit adds
+    for(unsigned b = 0; b < n_taps / 8; b++)
+        out += (uint32_t)acc[b];
+    return (int32_t)out;
+}
+
+// Test vectors
+// ------------
+static uint32_t uiSeed = 1;
+
+static int32_t rnd32(void)
+{
+    uiSeed = uiSeed * 1664525u + 1013904223u;
+    return (int32_t)uiSeed;
+}
+
+// Mix of full scale random values and extremes to exercise wrap and saturation
+static void fill(int32_t *p, int n, int iMode)
+{
+    for(int i = 0; i < n; i++)
+    {
+        switch(iMode)
+        {
+            case 0:  p[i] = rnd32();                                        break;
+            case 1:  p[i] = INT32_MIN;                                      break;
+            case 2:  p[i] = (i & 1) ? INT32_MAX : INT32_MIN;                break;
+            default: p[i] = rnd32() >> (rnd32() & 31);                      break;
+        }
+    }
+}
+
+static int iFailures = 0;
+
+static void check(const char *pzName, int iIter, int32_t iGot, int32_t iExp)
+{
+    if(iGot != iExp)
+    {
+        if(iFailures < 20)
+            printf("FAIL %s iteration %d: got %d expected %d\n", pzName, iIter, iGot, iExp);
+        iFailures++;
+    }
+}
+
+int main(void)
+{
+    // Both alignment parities of the data pointer are exercised, as on xcore
+    static int32_t  iDataBuf[MAX_TAPS * 3 + 2] __attribute__((aligned(8)));
+    static int32_t  iCoefs[MAX_TAPS * 3] __attribute__((aligned(8)));
+    static const int    iFirLoops[]     = {16, 48, 72, 80};         // 32, 96, 144 and 160 taps
+    static const int    iOsLoops[]      = {8, 24, 36, 40};
+    static const unsigned iVpuTaps[]    = {24, 32, 48};
+    SRCISA_t            eIsa            = src_isa_detect();
+
+    for(int it = 0; it < N_ITERATIONS; it++)
+    {
+        int         iMode   = it & 3;
+        int32_t*    piData  = iDataBuf + ((it >> 2) & 1);
+        int32_t     iRes[2], iExp[2];
+        int32_t     iH[3];
+
+        fill(iDataBuf, MAX_TAPS * 3 + 2, iMode);
+        fill(iCoefs, MAX_TAPS * 3, (iMode + (it >> 3)) & 3);
+
+        for(unsigned k = 0; k < sizeof(iFirLoops)/sizeof(iFirLoops[0]); k++)
+        {
+            src_mrhf_fir_inner_loop_asm(piData, iCoefs, iRes, iFirLoops[k]);
+            check("fir", it, iRes[0], ref_fir(piData, iCoefs, iFirLoops[k], 31));
+            src_mrhf_fir_inner_loop_asm_odd(piData, iCoefs, iRes, iFirLoops[k]);
+            check("fir_odd", it, iRes[0], ref_fir(piData, iCoefs, iFirLoops[k], 31));
+
+            src_mrhf_fir_os_inner_loop_asm(piData, iCoefs, iRes, iOsLoops[k]);
+            ref_fir_os(piData, iCoefs, iExp, iOsLoops[k]);
+            check("fir_os[0]", it, iRes[0], iExp[0]);
+            check("fir_os[1]", it, iRes[1], iExp[1]);
+            src_mrhf_fir_os_inner_loop_asm_odd(piData, iCoefs, iRes, iOsLoops[k]);
+            check("fir_os_odd[0]", it, iRes[0], iExp[0]);
+            check("fir_os_odd[1]", it, iRes[1], iExp[1]);
+
+#if defined(__x86_64__) || defined(__i386__)
+            if(eIsa >= SRC_ISA_SSE41)
+            {
+                src_mrhf_fir_inner_loop_sse41(piData, iCoefs, iRes, iFirLoops[k]);
+                check("fir_sse41", it, iRes[0], ref_fir(piData, iCoefs, iFirLoops[k], 31));
+                src_mrhf_fir_os_inner_loop_sse41(piData, iCoefs, iRes, iOsLoops[k]);
+                check("fir_os_sse41[0]", it, iRes[0], iExp[0]);
+                check("fir_os_sse41[1]", it, iRes[1], iExp[1]);
+            }
+            if(eIsa >= SRC_ISA_AVX2)
+            {
+                src_mrhf_fir_inner_loop_avx2(piData, iCoefs, iRes, iFirLoops[k]);
+                check("fir_avx2", it, iRes[0], ref_fir(piData, iCoefs, iFirLoops[k], 31));
+                src_mrhf_fir_os_inner_loop_avx2(piData, iCoefs, iRes, iOsLoops[k]);
+                check("fir_os_avx2[0]", it, iRes[0], iExp[0]);
+                check("fir_os_avx2[1]", it, iRes[1], iExp[1]);
+            }
+#endif
+        }
+
+        src_mrhf_adfir_inner_loop_asm(piData, iCoefs, iRes, 8);
+        check("adfir", it, iRes[0], ref_fir(piData, iCoefs, 8, 30));
+        src_mrhf_adfir_inner_loop_asm_odd(piData, iCoefs, iRes, 8);
+        check("adfir_odd", it, iRes[0], ref_fir(piData, iCoefs, 8, 30));
+
+#if defined(__x86_64__) || defined(__i386__)
+        if(eIsa >= SRC_ISA_AVX512)
+        {
+            // Channels with their own delay lines at mixed alignments, sharing the coefficients
+            int*        ppiData[SRC_MRHF_ADFIR_MULTI_MAX_CH];
+            int32_t     iMulti[SRC_MRHF_ADFIR_MULTI_MAX_CH];
+            for(unsigned n = 1; n <= SRC_MRHF_ADFIR_MULTI_MAX_CH; n++)
+            {
+                for(unsigned ch = 0; ch < n; ch++)
+                    ppiData[ch] = piData + ch * 17;
+                src_mrhf_adfir_inner_loop_multi_avx512(ppiData, iCoefs, iMulti, n, 8);
+                for(unsigned ch = 0; ch < n; ch++)
+                    check("adfir_multi_avx512", it, iMulti[ch], ref_fir(ppiData[ch], iCoefs, 8, 30));
+            }
+        }
+#endif
+
+        // Channels interleaved tap by tap, including partial vector groups
+        {
+            int32_t     iInterleaved[16 * 19];
+            int32_t     iMulti[19];
+            for(unsigned n = 1; n <= 19; n++)
+            {
+                for(unsigned t = 0; t < 16; t++)
+                    for(unsigned ch = 0; ch < n; ch++)
+                        iInterleaved[t * n + ch] = piData[ch * 5 + t];
+                src_mrhf_adfir_inner_loop_interleaved(iInterleaved, iCoefs, iMulti, n, 8);
+                for(unsigned ch = 0; ch < n; ch++)
+                    check("adfir_interleaved", it, iMulti[ch], ref_fir(piData + ch * 5, iCoefs, 8, 30));
+#if defined(__x86_64__) || defined(__i386__)
+                if(eIsa >= SRC_ISA_AVX2)
+                {
+                    src_mrhf_adfir_inner_loop_interleaved_avx2(iInterleaved, iCoefs, iMulti, n, 8);
+                    for(unsigned ch = 0; ch < n; ch++)
+                        check("adfir_interleaved_avx2", it, iMulti[ch], ref_fir(piData + ch * 5, iCoefs, 8, 30));
+                }
+                if(eIsa >= SRC_ISA_AVX512)
+                {
+                    src_mrhf_adfir_inner_loop_interleaved_avx512(iInterleaved, iCoefs, iMulti, n, 8);
+                    for(unsigned ch = 0; ch < n; ch++)
+                        check("adfir_interleaved_avx512", it, iMulti[ch], ref_fir(piData + ch * 5, iCoefs, 8, 30));
+                }
+#endif
+            }
+        }
+
+        for(int count = 1; count <= 6; count++)
+        {
+            src_ff3_fir_inner_loop_asm(piData, iCoefs, iRes, count);
+            check("ff3", it, iRes[0], ref_ff3(piData, iCoefs, count));
+            src_ff3_fir_inner_loop_asm_odd(piData, iCoefs, iRes, count);
+            check("ff3_odd", it, iRes[0], ref_ff3(piData, iCoefs, count));
+        }
+
+        {
+            int32_t iSpl[16], iSplExp[16];
+            fill(iH, 3, iMode);
+            src_mrhf_spline_coeff_gen_inner_loop_asm(iCoefs, iH, iSpl, 16);
+            ref_spline(iCoefs, iH, iSplExp, 16);
+            for(int k = 0; k < 16; k++)
+                check("spline", it, iSpl[k], iSplExp[k]);
+#if defined(__x86_64__) || defined(__i386__)
+            if(eIsa >= SRC_ISA_AVX2)
+            {
+                src_mrhf_spline_coeff_gen_inner_loop_avx2(iCoefs, iH, iSpl, 16);
+                for(int k = 0; k < 16; k++)
+                    check("spline_avx2", it, iSpl[k], iSplExp[k]);
+            }
+            if(eIsa >= SRC_ISA_AVX512)
+            {
+                src_mrhf_spline_coeff_gen_inner_loop_avx512(iCoefs, iH, iSpl, 16);
+                for(int k = 0; k < 16; k++)
+                    check("spline_avx512", it, iSpl[k], iSplExp[k]);
+            }
+#endif
+        }
+
+        {
+            // Three phases of ds3, then one input and two further outputs of us3
+            int32_t     iVoice[SRC_FF3V_FIR_TAPS_PER_PHASE], iVoiceExp[SRC_FF3V_FIR_TAPS_PER_PHASE];
+            acc_t       acc     = {(uint32_t)piData[40], (uint32_t)piData[41]};
+            int64_t     sum     = (int64_t)(((uint64_t)acc.h << 32) | acc.l);
+
+            {
+                acc_t   dot = acc;
+                int64_t iDot;
+                for(unsigned j = 0; j < SRC_FF3V_FIR_TAPS_PER_PHASE; j++)
+                    maccs(&dot, iCoefs[j], piData[j]);
+                iDot = src_ff3v_fir_dot_c(sum, piData, iCoefs);
+                check("ff3v_dot_c lo", it, (int32_t)iDot, (int32_t)dot.l);
+                check("ff3v_dot_c hi", it, (int32_t)(iDot >> 32), (int32_t)dot.h);
+#if defined(__x86_64__) || defined(__i386__)
+                if(eIsa >= SRC_ISA_AVX2)
+                {
+                    iDot = src_ff3v_fir_dot_avx2(sum, piData, iCoefs);
+                    check("ff3v_dot_avx2 lo", it, (int32_t)iDot, (int32_t)dot.l);
+                    check("ff3v_dot_avx2 hi", it, (int32_t)(iDot >> 32), (int32_t)dot.h);
+                }
+#endif
+            }
+            memcpy(iVoice, piData, sizeof(iVoice));
+            memcpy(iVoiceExp, piData, sizeof(iVoiceExp));
+            for(unsigned p = 0; p < SRC_FF3V_FIR_NUM_PHASES; p++)
+            {
+                int32_t s = iCoefs[100 + p];
+                ref_ff3v_impl(&acc, iVoiceExp, &iCoefs[24 * p], s);
+                if(p < SRC_FF3V_FIR_NUM_PHASES - 1)
+                {
+                    sum = src_ds3_voice_add_sample(sum, iVoice, &iCoefs[24 * p], s);
+                    check("ds3_voice_add_sample lo", it, (int32_t)sum, (int32_t)acc.l);
+                    check("ds3_voice_add_sample hi", it, (int32_t)(sum >> 32), (int32_t)acc.h);
+                }
+                else
+                {
+                    sum = src_ds3_voice_add_final_sample(sum, iVoice, &iCoefs[24 * p], s);
+                    check("ds3_voice_add_final_sample", it, (int32_t)sum,
+                          ref_ff3v_comp(&acc, src_ff3v_fir_comp_ds, src_ff3v_fir_comp_q_ds));
+                    check("ds3_voice_add_final_sample hi", it, (int32_t)(sum >> 32), 0);
+                }
+                for(unsigned j = 0; j < SRC_FF3V_FIR_TAPS_PER_PHASE; j++)
+                    check("ds3_voice state", it, iVoice[j], iVoiceExp[j]);
+            }
+
+            acc.h = acc.l = 0;
+            ref_ff3v_impl(&acc, iVoiceExp, &iCoefs[48], iCoefs[110]);
+            check("us3_voice_input_sample", it, src_us3_voice_input_sample(iVoice, &iCoefs[48], iCoefs[110]),
+                  ref_ff3v_comp(&acc, src_ff3v_fir_comp_us, src_ff3v_fir_comp_q_us));
+            for(unsigned j = 0; j < SRC_FF3V_FIR_TAPS_PER_PHASE; j++)
+                check("us3_voice state", it, iVoice[j], iVoiceExp[j]);
+            for(unsigned p = 1; p < SRC_FF3V_FIR_NUM_PHASES; p++)
+            {
+                acc.h = acc.l = 0;
+                for(unsigned j = 0; j < SRC_FF3V_FIR_TAPS_PER_PHASE; j++)     // TWO_TAPS_NO_STORE
+                    maccs(&acc, iCoefs[48 - 24 * p + j], iVoiceExp[j]);
+                check("us3_voice_get_next_sample", it, src_us3_voice_get_next_sample(iVoice, &iCoefs[48 - 24 * p]),
+                      ref_ff3v_comp(&acc, src_ff3v_fir_comp_us, src_ff3v_fir_comp_q_us));
+            }
+        }
+
+        for(unsigned k = 0; k < sizeof(iVpuTaps)/sizeof(iVpuTaps[0]); k++)
+        {
+            unsigned    n = iVpuTaps[k];
+            int32_t     iState[48], iExpState[48], iExp;
+            check("conv_s32_c", it, conv_s32_nt_c(piData, iCoefs, n), ref_vpu_conv(piData, iCoefs, n));
+#if defined(__x86_64__) || defined(__i386__)
+            if(eIsa >= SRC_ISA_AVX2)
+                check("conv_s32_avx2", it, conv_s32_nt_avx2(piData, iCoefs, n), ref_vpu_conv(piData, iCoefs, n));
+#endif
+            // The FIR functions shift the new sample in at the bottom of the state
+            memcpy(iState, piData, n * sizeof(int32_t));
+            iExpState[0] = iCoefs[n];
+            memcpy(&iExpState[1], piData, (n - 1) * sizeof(int32_t));
+            iExp = ref_vpu_conv(iExpState, iCoefs, n);
+            if(n == 24)
+                check("fir_s32_24t", it, fir_s32_24t(iState, iCoefs, iCoefs[n]), iExp);
+            else if(n == 32)
+                check("fir_s32_32t", it, fir_s32_32t(iState, iCoefs, iCoefs[n]), iExp);
+            else
+                check("fir_s32_48t", it, fir_s32_48t(iState, iCoefs, iCoefs[n]), iExp);
+            for(unsigned j = 0; j < n; j++)
+                check("fir_s32 state", it, iState[j], iExpState[j]);
+        }
+        {
+            int32_t iState[48];
+            memcpy(iState, piData, sizeof(iState));
+            push_s32_48t(iState, iCoefs[0]);
+            check("push_s32_48t", it, iState[0], iCoefs[0]);
+            for(unsigned k = 1; k < 48; k++)
+                check("push_s32_48t", it, iState[k], piData[k - 1]);
+        }
+    }
+
+    // The voice functions have no init, src_isa_force() must still apply to them
+    src_isa_force(SRC_ISA_SCALAR);
+    if(src_isa_get_kernels_voice()->pfConvS32 != conv_s32_nt_c || src_isa_get_kernels_voice()->pfFF3VDot != src_ff3v_fir_dot_c)
+    {
+        printf("voice kernels not limited by src_isa_force()\n");
+        iFailures++;
+    }
+    src_isa_force(SRC_ISA_N);
+
+    if(iFailures)
+    {
+        printf("%d mismatches\n", iFailures);
+        return 1;
+    }
+    printf("PASS (ISA %d)\n", (int)eIsa);
+    return 0;
+}
@@ -0,0 +1,167 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks ssrc_init_filter_phase() and asrc_init_filter_phase(). For every
+// pair of rate codes a low frequency tone is converted by SSRC and by ASRC
+// with the linear and the minimum phase filters, and the gain, delay and
+// residual of the tone at the output are measured. The minimum phase
+// filters must delay it less, with the same gain and a residual as low.
+// Run with any argument to print the delays, as in the programming guide.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#define     ASRC_N_CHANNELS             1
+#define     SSRC_N_CHANNELS             1
+#define     SSRC_N_IN_SAMPLES           4
+#include "src.h"
+#include "test_util.h"
+
+#define     N_IN_SAMPLES                16
+#define     N_OUT_IN_RATIO_MAX          5
+#define     TONE_HZ                     100.0
+#define     SETTLE_S                    0.05                    // Skipped at the start of the output
+#define     MEASURE_S                   0.1                     // A whole number of periods of the tone
+
+#define     MIN_DELAY_SAVING_US         20.0
+#define     MAX_GAIN_DIFF_DB            0.1
+#define     MAX_RESIDUAL_DB             -120.0
+
+static int      iIn[N_IN_SAMPLES];
+static int      iOut[N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+
+typedef struct
+{
+    double      dGainDb;
+    double      dDelayUs;
+    double      dResidualDb;
+} tone_t;
+
+typedef struct
+{
+    unsigned    uiIn;                   // Input samples so far
+    unsigned    uiOut;                  // Output samples so far
+    unsigned    uiFirst, uiEnd;         // Output samples measured
+    double      dOmega;                 // Of the tone at the output, radians per sample
+    double      dSin, dCos, dEnergy;
+} measure_t;
+
+static void measure_init(measure_t *psMeasure, fs_code_t eOut)
+{
+    memset(psMeasure, 0, sizeof(*psMeasure));
+    psMeasure->uiFirst  = (unsigned)(SETTLE_S * uiFsHz[eOut]);
+    psMeasure->uiEnd    = psMeasure->uiFirst + (unsigned)(MEASURE_S * uiFsHz[eOut]);
+    psMeasure->dOmega   = 2 * M_PI * TONE_HZ / uiFsHz[eOut];
+}
+
+static void next_block_tone(measure_t *psMeasure, fs_code_t eIn)
+{
+    next_tone(iIn, 1, N_IN_SAMPLES, psMeasure->uiIn, uiFsHz[eIn], TONE_HZ);
+    psMeasure->uiIn    += N_IN_SAMPLES;
+}
+
+static void measure_block(measure_t *psMeasure, unsigned uiNOut)
+{
+    for(unsigned ui = 0; ui < uiNOut; ui++, psMeasure->uiOut++)
+        if(psMeasure->uiOut >= psMeasure->uiFirst && psMeasure->uiOut < psMeasure->uiEnd)
+        {
+            double dY = iOut[ui];
+
+            psMeasure->dSin     += dY * sin(psMeasure->dOmega * psMeasure->uiOut);
+            psMeasure->dCos     += dY * cos(psMeasure->dOmega * psMeasure->uiOut);
+            psMeasure->dEnergy  += dY * dY;
+        }
+}
+
+// The output is a.sin(w.m - theta), the delay theta / 2.pi.f within half a period of the tone
+static tone_t measure_tone(const measure_t *psMeasure)
+{
+    tone_t      sTone;
+    double      dN          = psMeasure->uiEnd - psMeasure->uiFirst;
+    double      dAmplitude  = 2 * sqrt(psMeasure->dSin * psMeasure->dSin + psMeasure->dCos * psMeasure->dCos) / dN;
+    double      dTheta      = atan2(-psMeasure->dCos, psMeasure->dSin);
+    double      dToneEnergy = dAmplitude * dAmplitude * dN / 2;
+
+    sTone.dGainDb       = 20 * log10(dAmplitude / TEST_TONE_AMPLITUDE);
+    sTone.dDelayUs      = 1e6 * dTheta / (2 * M_PI * TONE_HZ);
+    sTone.dResidualDb   = 10 * log10(fabs(psMeasure->dEnergy - dToneEnergy) / dToneEnergy + 1e-30);
+    return sTone;
+}
+
+static tone_t tone_ssrc(fs_code_t eIn, fs_code_t eOut, src_filter_phase_t ePhase)
+{
+    static test_ssrc_t      sInst;
+    measure_t               sMeasure;
+
+    test_ssrc_init(&sInst, eIn, eOut, 1, N_IN_SAMPLES, OFF);
+    ssrc_init_filter_phase(sInst.sCtrl, ePhase);
+
+    measure_init(&sMeasure, eOut);
+    while(sMeasure.uiOut < sMeasure.uiEnd)
+    {
+        next_block_tone(&sMeasure, eIn);
+        measure_block(&sMeasure, ssrc_process(iIn, iOut, sInst.sCtrl));
+    }
+    return measure_tone(&sMeasure);
+}
+
+static tone_t tone_asrc(fs_code_t eIn, fs_code_t eOut, src_filter_phase_t ePhase)
+{
+    static test_asrc_t      sInst;
+    measure_t               sMeasure;
+    uint64_t                u64Ratio;
+
+    u64Ratio = test_asrc_init(&sInst, eIn, eOut, 1, N_IN_SAMPLES, OFF);
+    asrc_init_filter_phase(sInst.sCtrl, ePhase);
+
+    measure_init(&sMeasure, eOut);
+    while(sMeasure.uiOut < sMeasure.uiEnd)
+    {
+        next_block_tone(&sMeasure, eIn);
+        measure_block(&sMeasure, asrc_process(iIn, iOut, u64Ratio, sInst.sCtrl));
+    }
+    return measure_tone(&sMeasure);
+}
+
+static void check(const char *pzSrc, fs_code_t eIn, fs_code_t eOut, tone_t sLinear, tone_t sMinimum, int iPrint)
+{
+    test_case("%s %u->%u", pzSrc, uiFsHz[eIn], uiFsHz[eOut]);
+    if(iPrint)
+        printf("%s %6u->%6u: delay %7.1f us linear, %7.1f us minimum phase, residual %6.1f dB, %6.1f dB\n",
+               pzSrc, uiFsHz[eIn], uiFsHz[eOut], sLinear.dDelayUs, sMinimum.dDelayUs,
+               sLinear.dResidualDb, sMinimum.dResidualDb);
+    // SSRC passes equal rates straight through
+    if(!strcmp(pzSrc, "SSRC") && eIn == eOut)
+    {
+        if(sMinimum.dDelayUs != sLinear.dDelayUs)
+            fail("bypass delay differs");
+    }
+    else if(sMinimum.dDelayUs > sLinear.dDelayUs - MIN_DELAY_SAVING_US)
+        fail("minimum phase delay not lower");
+    if(fabs(sMinimum.dGainDb - sLinear.dGainDb) > MAX_GAIN_DIFF_DB)
+        fail("gain differs");
+    if(sMinimum.dResidualDb > MAX_RESIDUAL_DB || sLinear.dResidualDb > MAX_RESIDUAL_DB)
+        fail("residual too high");
+}
+
+int main(int argc, char *argv[])
+{
+    (void)argv;
+
+    for(fs_code_t eIn = FS_CODE_44; eIn <= FS_CODE_192; eIn++)
+        for(fs_code_t eOut = FS_CODE_44; eOut <= FS_CODE_192; eOut++)
+        {
+            check("SSRC", eIn, eOut, tone_ssrc(eIn, eOut, SRC_LINEAR_PHASE), tone_ssrc(eIn, eOut, SRC_MINIMUM_PHASE), argc > 1);
+            check("ASRC", eIn, eOut, tone_asrc(eIn, eOut, SRC_LINEAR_PHASE), tone_asrc(eIn, eOut, SRC_MINIMUM_PHASE), argc > 1);
+        }
+
+    return test_result();
+}
@@ -0,0 +1,279 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks the mirrored ring buffer delay lines. For every rate pair an SSRC
+// and an ASRC instance with mirrored delay lines must give exactly the output
+// of one with double write delay lines, as must DS3 and OS3. The mirrored
+// instances are switched over while running, back and forth, and run long
+// enough for every ring to wrap several times. Initializing mirrored
+// instances again must unmap their rings, and start them over as fresh ones.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define     ASRC_N_CHANNELS             2
+#define     SSRC_N_CHANNELS             2
+#define     SSRC_N_IN_SAMPLES           4
+#include "src.h"
+#include "test_util.h"
+
+#define     N_CHANNELS                  2
+#define     N_IN_SAMPLES                4
+#define     N_BLOCKS                    1500
+#define     N_OUT_IN_RATIO_MAX          5
+#define     N_REINITS                   64
+
+static int      iSkipped = 0;
+
+// Mirrored for the second quarter and the last quarter of the run
+static int mirror_at(unsigned uiBlock)
+{
+    return (uiBlock == N_BLOCKS / 4) || (uiBlock == 3 * N_BLOCKS / 4);
+}
+
+static int unmirror_at(unsigned uiBlock)
+{
+    return uiBlock == N_BLOCKS / 2;
+}
+
+static void test_ssrc(fs_code_t eIn, fs_code_t eOut)
+{
+    static test_ssrc_t      sInst[2];
+    ssrc_ctrl_t*            psCtrl = sInst[1].sCtrl;
+    int                     iIn[N_CHANNELS * N_IN_SAMPLES];
+    int                     iOut[2][N_CHANNELS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+    uint32_t                uiSeed = 1;
+
+    test_case("ssrc %u->%u", uiFsHz[eIn], uiFsHz[eOut]);
+    for(int k = 0; k < 2; k++)
+        test_ssrc_init(&sInst[k], eIn, eOut, N_CHANNELS, N_IN_SAMPLES, OFF);
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        if(mirror_at(b) && !ssrc_init_mirrored_delays(psCtrl))
+        {
+            iSkipped++;
+            return;
+        }
+        if(unmirror_at(b))
+            ssrc_exit_mirrored_delays(psCtrl);
+
+        next_block(iIn, N_CHANNELS * N_IN_SAMPLES, &uiSeed);
+        unsigned n0 = ssrc_process(iIn, iOut[0], sInst[0].sCtrl);
+        unsigned n1 = ssrc_process(iIn, iOut[1], psCtrl);
+        if(n0 != n1 || memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) != 0)
+        {
+            fail("output differs in block %u", b);
+            break;
+        }
+    }
+    ssrc_exit_mirrored_delays(psCtrl);
+}
+
+static void test_asrc(fs_code_t eIn, fs_code_t eOut)
+{
+    static test_asrc_t          sInst[2];
+    asrc_ctrl_t*                psCtrl = sInst[1].sCtrl;
+    int                         iIn[N_CHANNELS * N_IN_SAMPLES];
+    int                         iOut[2][N_CHANNELS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+    uint32_t                    uiSeed = 2;
+    uint64_t                    u64Ratio = 0;
+
+    test_case("asrc %u->%u", uiFsHz[eIn], uiFsHz[eOut]);
+    for(int k = 0; k < 2; k++)
+        u64Ratio = test_asrc_init(&sInst[k], eIn, eOut, N_CHANNELS, N_IN_SAMPLES, OFF);
+    // Slightly off nominal, so the F3 phases move
+    u64Ratio += u64Ratio >> 10;
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        if(mirror_at(b) && !asrc_init_mirrored_delays(psCtrl))
+        {
+            iSkipped++;
+            return;
+        }
+        if(unmirror_at(b))
+            asrc_exit_mirrored_delays(psCtrl);
+
+        next_block(iIn, N_CHANNELS * N_IN_SAMPLES, &uiSeed);
+        unsigned n0 = asrc_process(iIn, iOut[0], u64Ratio, sInst[0].sCtrl);
+        unsigned n1 = asrc_process(iIn, iOut[1], u64Ratio, psCtrl);
+        if(n0 != n1 || memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) != 0)
+        {
+            fail("output differs in block %u", b);
+            break;
+        }
+    }
+    asrc_exit_mirrored_delays(psCtrl);
+}
+
+static void test_ds3_os3(void)
+{
+    static int          iDs3Delay[2][SRC_FF3_DS3_N_COEFS << 1];
+    static int          iOs3Delay[2][(SRC_FF3_OS3_N_COEFS / SRC_FF3_OS3_N_PHASES) << 1];
+    src_ds3_ctrl_t      sDs3[2];
+    src_os3_ctrl_t      sOs3[2];
+    int                 iTriple[3], iDs3Out[2];
+    uint32_t            uiSeed = 3;
+
+    test_case("ds3 and os3");
+
+    for(int k = 0; k < 2; k++)
+    {
+        sDs3[k].delay_base  = iDs3Delay[k];
+        sOs3[k].delay_base  = iOs3Delay[k];
+        src_ds3_init(&sDs3[k]);
+        src_os3_init(&sOs3[k]);
+    }
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        if(mirror_at(b) && (src_ds3_init_mirrored_delay(&sDs3[1]) != SRC_FF3_NO_ERROR ||
+                            src_os3_init_mirrored_delay(&sOs3[1]) != SRC_FF3_NO_ERROR))
+        {
+            iSkipped++;
+            return;
+        }
+        if(unmirror_at(b))
+        {
+            src_ds3_exit_mirrored_delay(&sDs3[1]);
+            src_os3_exit_mirrored_delay(&sOs3[1]);
+        }
+
+        next_block(iTriple, 3, &uiSeed);
+        for(int k = 0; k < 2; k++)
+        {
+            sDs3[k].in_data     = iTriple;
+            sDs3[k].out_data    = &iDs3Out[k];
+            src_ds3_proc(&sDs3[k]);
+
+            sOs3[k].in_data     = iTriple[0];
+            src_os3_input(&sOs3[k]);
+        }
+        if(iDs3Out[0] != iDs3Out[1])
+        {
+            fail("ds3 output differs in block %u", b);
+            break;
+        }
+        for(int p = 0; p < 3; p++)
+        {
+            src_os3_proc(&sOs3[0]);
+            src_os3_proc(&sOs3[1]);
+            if(sOs3[0].out_data != sOs3[1].out_data)
+            {
+                fail("os3 output differs in block %u", b);
+                b = N_BLOCKS;
+                break;
+            }
+        }
+    }
+    src_ds3_exit_mirrored_delay(&sDs3[1]);
+    src_os3_exit_mirrored_delay(&sOs3[1]);
+}
+
+// Lines of /proc/self/maps, 0 where it is not available
+static unsigned count_mappings(void)
+{
+    FILE*       pfMaps      = fopen("/proc/self/maps", "r");
+    unsigned    uiLines     = 0;
+    int         iChar;
+
+    if(pfMaps == NULL)
+        return 0;
+    while((iChar = fgetc(pfMaps)) != EOF)
+        uiLines += (iChar == '\n');
+    fclose(pfMaps);
+    return uiLines;
+}
+
+// Instances initialized again while mirrored, without the exit calls
+static void test_reinit(void)
+{
+    static test_ssrc_t  sSsrc[2];
+    static test_asrc_t  sAsrc[2];
+    static int          iDs3Delay[SRC_FF3_DS3_N_COEFS << 1];
+    static int          iOs3Delay[(SRC_FF3_OS3_N_COEFS / SRC_FF3_OS3_N_PHASES) << 1];
+    src_ds3_ctrl_t      sDs3;
+    src_os3_ctrl_t      sOs3;
+    int                 iIn[N_CHANNELS * N_IN_SAMPLES];
+    int                 iOut[2][N_CHANNELS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+    uint32_t            uiSeed = 4;
+    uint64_t            u64Ratio;
+    unsigned            uiMappings;
+
+    test_case("init again while mirrored");
+    test_ssrc_init(&sSsrc[1], FS_CODE_48, FS_CODE_44, N_CHANNELS, N_IN_SAMPLES, OFF);
+    u64Ratio = test_asrc_init(&sAsrc[1], FS_CODE_48, FS_CODE_44, N_CHANNELS, N_IN_SAMPLES, OFF);
+    sDs3.delay_base     = iDs3Delay;
+    sOs3.delay_base     = iOs3Delay;
+    src_ds3_init(&sDs3);
+    src_os3_init(&sOs3);
+    uiMappings          = count_mappings();
+
+    for(unsigned r = 0; r < N_REINITS; r++)
+    {
+        if(!ssrc_init_mirrored_delays(sSsrc[1].sCtrl) || !asrc_init_mirrored_delays(sAsrc[1].sCtrl) ||
+           src_ds3_init_mirrored_delay(&sDs3) != SRC_FF3_NO_ERROR || src_os3_init_mirrored_delay(&sOs3) != SRC_FF3_NO_ERROR)
+        {
+            iSkipped++;
+            return;
+        }
+        next_block(iIn, N_CHANNELS * N_IN_SAMPLES, &uiSeed);
+        ssrc_process(iIn, iOut[1], sSsrc[1].sCtrl);
+        asrc_process(iIn, iOut[1], u64Ratio, sAsrc[1].sCtrl);
+
+        test_ssrc_init(&sSsrc[1], FS_CODE_48, FS_CODE_44, N_CHANNELS, N_IN_SAMPLES, OFF);
+        test_asrc_init(&sAsrc[1], FS_CODE_48, FS_CODE_44, N_CHANNELS, N_IN_SAMPLES, OFF);
+        src_ds3_init(&sDs3);
+        src_os3_init(&sOs3);
+    }
+    if(count_mappings() != uiMappings)
+        fail("%u mappings, %u before", count_mappings(), uiMappings);
+    if(sDs3.delay_base != iDs3Delay || sOs3.delay_base != iOs3Delay)
+        fail("ds3 or os3 left on its ring");
+
+    // As fresh instances
+    test_ssrc_init(&sSsrc[0], FS_CODE_48, FS_CODE_44, N_CHANNELS, N_IN_SAMPLES, OFF);
+    test_asrc_init(&sAsrc[0], FS_CODE_48, FS_CODE_44, N_CHANNELS, N_IN_SAMPLES, OFF);
+    for(unsigned b = 0; b < N_BLOCKS / 10; b++)
+    {
+        next_block(iIn, N_CHANNELS * N_IN_SAMPLES, &uiSeed);
+        unsigned n0 = ssrc_process(iIn, iOut[0], sSsrc[0].sCtrl);
+        unsigned n1 = ssrc_process(iIn, iOut[1], sSsrc[1].sCtrl);
+        if(n0 != n1 || memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) != 0)
+        {
+            fail("ssrc output differs in block %u", b);
+            break;
+        }
+        n0 = asrc_process(iIn, iOut[0], u64Ratio, sAsrc[0].sCtrl);
+        n1 = asrc_process(iIn, iOut[1], u64Ratio, sAsrc[1].sCtrl);
+        if(n0 != n1 || memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) != 0)
+        {
+            fail("asrc output differs in block %u", b);
+            break;
+        }
+    }
+}
+
+int main(void)
+{
+    for(int i = FS_CODE_44; i <= FS_CODE_192; i++)
+        for(int o = FS_CODE_44; o <= FS_CODE_192; o++)
+        {
+            test_ssrc((fs_code_t)i, (fs_code_t)o);
+            test_asrc((fs_code_t)i, (fs_code_t)o);
+        }
+    test_ds3_os3();
+    test_reinit();
+
+    if(iSkipped)
+        printf("Mirrored mappings not available, %d tests skipped\n", iSkipped);
+    return test_result();
+}
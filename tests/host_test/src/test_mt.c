@@ -0,0 +1,81 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks asrc_mt_process(). For every pair of rate codes an instance of
+// N_CHANNELS run on a pool of threads must give exactly the output of one
+// run by asrc_process(), with dither on and the Fs ratio changing from block
+// to block. This is run with pools of a few sizes, the number of channels
+// not a multiple of some.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define     ASRC_N_CHANNELS             24
+#include "src.h"
+#include "test_util.h"
+
+#define     N_CHANNELS                  24
+#define     N_IN_SAMPLES                16
+#define     N_BLOCKS                    40
+#define     N_OUT_IN_RATIO_MAX          5
+#define     N_SCHED_MAX                 4096
+
+static int      iIn[N_CHANNELS * N_IN_SAMPLES];
+static int      iOut[2][N_CHANNELS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+static int      iSched[N_SCHED_MAX];
+
+static void test_mt(fs_code_t eIn, fs_code_t eOut, unsigned uiNThreads)
+{
+    static test_asrc_t      sInst[2];
+    asrc_mt_t               sMt;
+    uint64_t                u64Nominal;
+    uint32_t                uiSeed = 4;
+
+    test_case("%u->%u on %u threads", uiFsHz[eIn], uiFsHz[eOut], uiNThreads);
+    u64Nominal = test_asrc_init(&sInst[0], eIn, eOut, N_CHANNELS, N_IN_SAMPLES, ON);
+    test_asrc_init(&sInst[1], eIn, eOut, N_CHANNELS, N_IN_SAMPLES, ON);
+    if(asrc_mt_buffer_length(sInst[1].sCtrl) > N_SCHED_MAX)
+    {
+        fail("schedule too long for the test");
+        return;
+    }
+    asrc_mt_init(&sMt, sInst[1].sCtrl, uiNThreads, iSched);
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        uint64_t    u64Ratio;
+        unsigned    n0, n1;
+
+        next_block(iIn, N_CHANNELS * N_IN_SAMPLES, &uiSeed);
+        // Within about 1/1000 of nominal
+        u64Ratio    = u64Nominal + (int64_t)(u64Nominal >> 10) / 256 * (int64_t)((int)(uiSeed >> 24) - 128);
+
+        n0 = asrc_process(iIn, iOut[0], u64Ratio, sInst[0].sCtrl);
+        n1 = asrc_mt_process(iIn, iOut[1], u64Ratio, &sMt);
+        if(n0 != n1 || memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) != 0)
+        {
+            fail("output differs");
+            break;
+        }
+    }
+    asrc_mt_exit(&sMt);
+}
+
+int main(void)
+{
+    static const unsigned   uiNThreads[] = {1, 3, 4, 5, 8};
+
+    for(unsigned ui = 0; ui < sizeof(uiNThreads) / sizeof(uiNThreads[0]); ui++)
+        for(fs_code_t eIn = FS_CODE_44; eIn <= FS_CODE_192; eIn++)
+            for(fs_code_t eOut = FS_CODE_44; eOut <= FS_CODE_192; eOut++)
+                test_mt(eIn, eOut, uiNThreads[ui]);
+
+    return test_result();
+}
@@ -0,0 +1,207 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks asrc_init_passthrough(). For every pair of equal rate codes, in each
+// quality tier, an instance with the passthrough fast path and one without are
+// fed the same tone, with dither, at the nominal Fs ratio, then slightly off
+// it, at the nominal ratio again and through a ramp. The fast path must copy
+// once the ratio has been nominal for the window, stop as soon as it is not,
+// stay close to the filters throughout and give exactly their output once the
+// crossfade back is over. An instance with planar buffers must give the same
+// output as one with interleaved buffers. Run with any argument to print the
+// time taken at the nominal ratio with and without the fast path.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#define     ASRC_N_CHANNELS             2
+#include "src.h"
+#include "test_util.h"
+
+#define     N_CHANNELS                  2
+#define     N_IN_SAMPLES                16
+#define     N_OUT_MAX                   (2 * N_IN_SAMPLES)
+#define     WINDOW                      8
+#define     TONE_HZ                     100.0
+#define     MAX_ERROR                   (TEST_TONE_AMPLITUDE / 100) // Copy against filters, for a delay up to half a sample off
+#define     RATIO_OFFSET                1.00001
+#define     N_TIMED_BLOCKS              20000
+
+// Blocks of the schedule: nominal, off nominal, nominal, then a ramp off nominal
+#define     BLOCK_OFF                   250
+#define     BLOCK_NOMINAL               350
+#define     BLOCK_RAMP                  600
+#define     N_BLOCKS                    700
+// Blocks after leaving the nominal ratio by when the crossfade back is over
+#define     N_FADE_BLOCKS               (ASRC_PASS_FADE_LENGTH / N_IN_SAMPLES + 2)
+
+static int      iIn[N_CHANNELS * N_IN_SAMPLES];
+static int      iInPlanar[N_CHANNELS][N_IN_SAMPLES];
+static int*     piInPlanar[N_CHANNELS];
+static int      iRef[N_CHANNELS * N_OUT_MAX];
+static int      iOut[N_CHANNELS * N_OUT_MAX];
+static int      iOutPlanar[N_CHANNELS][N_OUT_MAX];
+
+// A test_asrc_t with the buffer of its passthrough fast path
+typedef struct
+{
+    test_asrc_t         sAsrc;
+    int*                piPassBuffer;
+} pass_instance_t;
+
+static pass_instance_t  sRef, sPass, sPlanar;
+
+// With the passthrough fast path if iPass
+static uint64_t init(pass_instance_t *psInst, fs_code_t eFs, asrc_quality_t eQuality, int iPass)
+{
+    asrc_ctrl_t*    psCtrl      = psInst->sAsrc.sCtrl;
+    uint64_t        u64Nominal  = test_asrc_init(&psInst->sAsrc, eFs, eFs, N_CHANNELS, N_IN_SAMPLES, ON);
+
+    asrc_init_quality(psCtrl, eQuality);
+    free(psInst->piPassBuffer);
+    psInst->piPassBuffer = 0;
+    if(iPass)
+    {
+        psInst->piPassBuffer = malloc(asrc_passthrough_buffer_length(psCtrl) * sizeof(int));
+        asrc_init_passthrough(psCtrl, WINDOW, psInst->piPassBuffer);
+    }
+    return u64Nominal;
+}
+
+// The tone into iIn and iInPlanar
+static void next_input(unsigned uiBlock, fs_code_t eFs)
+{
+    next_tone(iIn, N_CHANNELS, N_IN_SAMPLES, uiBlock * N_IN_SAMPLES, uiFsHz[eFs], TONE_HZ);
+    to_planar(piInPlanar, iIn, N_CHANNELS, N_IN_SAMPLES);
+}
+
+static unsigned process(pass_instance_t *psInst, unsigned uiBlock, uint64_t u64Nominal, uint64_t u64Off, int *piOut)
+{
+    if(uiBlock == BLOCK_RAMP)
+        return asrc_process_ramp(iIn, piOut, u64Nominal, u64Off, psInst->sAsrc.sCtrl);
+    return asrc_process(iIn, piOut, (uiBlock >= BLOCK_OFF && uiBlock < BLOCK_NOMINAL) || uiBlock > BLOCK_RAMP ? u64Off : u64Nominal,
+                        psInst->sAsrc.sCtrl);
+}
+
+static void run(fs_code_t eFs, asrc_quality_t eQuality)
+{
+    uint64_t    u64Nominal  = init(&sRef, eFs, eQuality, 0);
+    uint64_t    u64Off      = (uint64_t)((double)u64Nominal * RATIO_OFFSET);
+    int*        piOutPlanar[N_CHANNELS];
+    int         iCopied     = 0;
+
+    test_case("%u->%u %s quality", uiFsHz[eFs], uiFsHz[eFs], pzQuality[eQuality]);
+    init(&sPass, eFs, eQuality, 1);
+    init(&sPlanar, eFs, eQuality, 1);
+    for(unsigned uj = 0; uj < N_CHANNELS; uj++)
+        piOutPlanar[uj] = iOutPlanar[uj];
+
+    for(unsigned uiBlock = 0; uiBlock < N_BLOCKS; uiBlock++)
+    {
+        int         iNominal    = uiBlock < BLOCK_OFF || (uiBlock >= BLOCK_NOMINAL && uiBlock < BLOCK_RAMP);
+        // The fast path runs the filters from the block off nominal, and its output is theirs once
+        // the crossfade is over until the window at the nominal ratio has passed
+        int         iExact      = (uiBlock >= BLOCK_OFF + N_FADE_BLOCKS && uiBlock < BLOCK_NOMINAL + WINDOW - 1) ||
+                                  uiBlock >= BLOCK_RAMP + N_FADE_BLOCKS;
+        unsigned    uiNRef, uiN, uiNPlanar;
+        int         iMaxError   = 0;
+
+        next_input(uiBlock, eFs);
+        uiNRef      = process(&sRef, uiBlock, u64Nominal, u64Off, iRef);
+        uiN         = process(&sPass, uiBlock, u64Nominal, u64Off, iOut);
+        uiNPlanar   = asrc_process_planar(piInPlanar, piOutPlanar, uiBlock == BLOCK_RAMP || !iNominal ? u64Off : u64Nominal,
+                                          sPlanar.sAsrc.sCtrl);
+
+        if(uiN != uiNRef)
+        {
+            fail("block %u: number of output samples differs", uiBlock);
+            return;
+        }
+        for(unsigned ui = 0; ui < uiN * N_CHANNELS; ui++)
+        {
+            int     iError  = abs(iOut[ui] - iRef[ui]);
+
+            iMaxError = iError > iMaxError ? iError : iMaxError;
+        }
+        if(iMaxError > MAX_ERROR)
+            fail("block %u: output too far from the filters", uiBlock);
+        if(iExact && iMaxError)
+            fail("block %u: output differs from the filters after the crossfade", uiBlock);
+
+        if(asrc_passthrough_active(sPass.sAsrc.sCtrl))
+        {
+            iCopied = 1;
+            if(!iNominal)
+                fail("block %u: copy off the nominal ratio", uiBlock);
+        }
+        if((uiBlock == BLOCK_OFF - 1 || uiBlock == BLOCK_RAMP - 1) && !asrc_passthrough_active(sPass.sAsrc.sCtrl))
+            fail("block %u: no copy at the nominal ratio", uiBlock);
+
+        // The planar instance goes off nominal at the ramp block, so only compare before it
+        if(uiBlock < BLOCK_RAMP)
+        {
+            if(uiNPlanar != uiN)
+                fail("block %u: planar number of output samples differs", uiBlock);
+            else
+                for(unsigned ui = 0; ui < uiN; ui++)
+                    for(unsigned uj = 0; uj < N_CHANNELS; uj++)
+                        if(iOutPlanar[uj][ui] != iOut[ui * N_CHANNELS + uj])
+                        {
+                            fail("block %u: planar output differs", uiBlock);
+                            ui = uiN;
+                            break;
+                        }
+        }
+    }
+    if(!iCopied)
+        fail("never copied");
+}
+
+// Seconds for N_TIMED_BLOCKS at the nominal ratio
+static double time_nominal(fs_code_t eFs, asrc_quality_t eQuality, int iPass)
+{
+    uint64_t        u64Nominal  = init(&sPass, eFs, eQuality, iPass);
+    struct timespec sStart, sEnd;
+
+    next_input(0, eFs);
+    clock_gettime(CLOCK_MONOTONIC, &sStart);
+    for(unsigned uiBlock = 0; uiBlock < N_TIMED_BLOCKS; uiBlock++)
+        asrc_process(iIn, iOut, u64Nominal, sPass.sAsrc.sCtrl);
+    clock_gettime(CLOCK_MONOTONIC, &sEnd);
+    return (double)(sEnd.tv_sec - sStart.tv_sec) + 1e-9 * (double)(sEnd.tv_nsec - sStart.tv_nsec);
+}
+
+int main(int argc, char *argv[])
+{
+    (void)argv;
+
+    for(unsigned uj = 0; uj < N_CHANNELS; uj++)
+        piInPlanar[uj]  = iInPlanar[uj];
+
+    for(fs_code_t eFs = FS_CODE_44; eFs <= FS_CODE_192; eFs++)
+        for(asrc_quality_t eQuality = ASRC_LOW_QUALITY; eQuality <= ASRC_STANDARD_QUALITY; eQuality++)
+        {
+            run(eFs, eQuality);
+            if(argc > 1)
+            {
+                double  dFilters    = time_nominal(eFs, eQuality, 0);
+                double  dPass       = time_nominal(eFs, eQuality, 1);
+
+                printf("%6u->%6u %-8s: %8.1f ns/sample with the filters, %8.1f ns/sample with passthrough (%4.1f%%)\n",
+                       uiFsHz[eFs], uiFsHz[eFs], pzQuality[eQuality],
+                       1e9 * dFilters / (N_TIMED_BLOCKS * N_IN_SAMPLES), 1e9 * dPass / (N_TIMED_BLOCKS * N_IN_SAMPLES),
+                       100.0 * dPass / dFilters);
+            }
+        }
+
+    return test_result();
+}
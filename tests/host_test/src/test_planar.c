@@ -0,0 +1,151 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks ssrc_process_planar() and asrc_process_planar(). For every rate
+// pair an SSRC and an ASRC instance fed planar buffers must give exactly the
+// output of one fed the same samples interleaved, with dither on (the ASRC
+// builds without it). The ASRC is also run with its F3 delay lines
+// interleaved. The planar instances are switched to interleaved buffers for
+// the middle of the run and back.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define     ASRC_N_CHANNELS             3
+#define     SSRC_N_CHANNELS             3
+#define     SSRC_N_IN_SAMPLES           4
+#include "src.h"
+#include "test_util.h"
+
+#define     N_CHANNELS                  3
+#define     N_IN_SAMPLES                16
+#define     N_BLOCKS                    300
+#define     N_OUT_IN_RATIO_MAX          5
+
+static int      iIn[N_CHANNELS * N_IN_SAMPLES];
+static int      iInPlanar[N_CHANNELS][N_IN_SAMPLES];
+static int      iOut[2][N_CHANNELS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+static int      iOutPlanar[N_CHANNELS][N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+static int*     piInPlanar[N_CHANNELS];
+static int*     piOutPlanar[N_CHANNELS];
+
+// Interleaved for the middle third of the run
+static int interleaved_at(unsigned uiBlock)
+{
+    return (uiBlock >= N_BLOCKS / 3) && (uiBlock < 2 * N_BLOCKS / 3);
+}
+
+// The same samples into iIn and iInPlanar
+static void next_input(uint32_t *puiSeed)
+{
+    next_block(iIn, N_CHANNELS * N_IN_SAMPLES, puiSeed);
+    to_planar(piInPlanar, iIn, N_CHANNELS, N_IN_SAMPLES);
+}
+
+// Compares the planar output, interleaved into iOut[1] first
+static int same_output(unsigned n0, unsigned n1)
+{
+    if(n0 != n1)
+        return 0;
+    for(unsigned i = 0; i < n1; i++)
+        for(int ch = 0; ch < N_CHANNELS; ch++)
+            iOut[1][N_CHANNELS * i + ch] = iOutPlanar[ch][i];
+    return memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) == 0;
+}
+
+static void test_ssrc(fs_code_t eIn, fs_code_t eOut)
+{
+    static test_ssrc_t      sInst[2];
+    uint32_t                uiSeed = 1;
+
+    test_case("ssrc %u->%u", uiFsHz[eIn], uiFsHz[eOut]);
+    for(int k = 0; k < 2; k++)
+        test_ssrc_init(&sInst[k], eIn, eOut, N_CHANNELS, N_IN_SAMPLES, ON);
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        unsigned n0, n1;
+
+        next_input(&uiSeed);
+        n0 = ssrc_process(iIn, iOut[0], sInst[0].sCtrl);
+        if(interleaved_at(b))
+        {
+            n1 = ssrc_process(iIn, iOut[1], sInst[1].sCtrl);
+            if(n0 != n1 || memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) != 0)
+            {
+                fail("interleaved output differs in block %u", b);
+                break;
+            }
+        }
+        else if(!same_output(n0, ssrc_process_planar(piInPlanar, piOutPlanar, sInst[1].sCtrl)))
+        {
+            fail("output differs in block %u", b);
+            break;
+        }
+    }
+}
+
+static void test_asrc(fs_code_t eIn, fs_code_t eOut, int iF3Interleaved)
+{
+    static test_asrc_t          sInst[2];
+    uint32_t                    uiSeed = 2;
+    uint64_t                    u64Ratio = 0;
+
+    test_case("%s %u->%u", iF3Interleaved ? "asrc f3 interleaved" : "asrc", uiFsHz[eIn], uiFsHz[eOut]);
+    for(int k = 0; k < 2; k++)
+    {
+        u64Ratio = test_asrc_init(&sInst[k], eIn, eOut, N_CHANNELS, N_IN_SAMPLES, ON);
+        if(iF3Interleaved)
+            asrc_init_f3_interleaved(sInst[k].sCtrl, sInst[k].iF3Delay);
+    }
+    // Slightly off nominal, so the F3 phases move
+    u64Ratio += u64Ratio >> 10;
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        unsigned n0, n1;
+
+        next_input(&uiSeed);
+        n0 = asrc_process(iIn, iOut[0], u64Ratio, sInst[0].sCtrl);
+        if(interleaved_at(b))
+        {
+            n1 = asrc_process(iIn, iOut[1], u64Ratio, sInst[1].sCtrl);
+            if(n0 != n1 || memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) != 0)
+            {
+                fail("interleaved output differs in block %u", b);
+                break;
+            }
+        }
+        else if(!same_output(n0, asrc_process_planar(piInPlanar, piOutPlanar, u64Ratio, sInst[1].sCtrl)))
+        {
+            fail("output differs in block %u", b);
+            break;
+        }
+    }
+}
+
+int main(void)
+{
+    for(int ch = 0; ch < N_CHANNELS; ch++)
+    {
+        piInPlanar[ch]  = iInPlanar[ch];
+        piOutPlanar[ch] = iOutPlanar[ch];
+    }
+
+    for(fs_code_t eIn = FS_CODE_44; eIn <= FS_CODE_192; eIn++)
+        for(fs_code_t eOut = FS_CODE_44; eOut <= FS_CODE_192; eOut++)
+        {
+            test_ssrc(eIn, eOut);
+            test_asrc(eIn, eOut, 0);
+            test_asrc(eIn, eOut, 1);
+        }
+
+    return test_result();
+}
@@ -0,0 +1,135 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks asrc_process_pull(). For every pair of rate codes and a few pairs
+// planned by asrc_init_rates_arena(), an instance pulled a varying number of
+// output samples at a time must give exactly the output of one fed the same
+// blocks by asrc_process(), and report the input it took. This is run at
+// the lowest Fs ratio allowed, which gives the most output per block, and
+// slightly above the nominal one.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define     ASRC_N_CHANNELS             2
+#include "src.h"
+#include "test_util.h"
+
+#define     N_CHANNELS                  2
+#define     N_IN_SAMPLES                16
+#define     N_BLOCKS                    200
+#define     N_OUT_IN_RATIO_MAX          10
+#define     N_OUT_MAX                   (3 * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX)
+
+static int      iIn[N_BLOCKS][N_CHANNELS * N_IN_SAMPLES];
+static int      iRef[N_BLOCKS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX * N_CHANNELS];
+static int      iOut[N_OUT_MAX * N_CHANNELS];
+static int      iPullBuffer[N_IN_SAMPLES * N_OUT_IN_RATIO_MAX * N_CHANNELS];
+
+// Input callback, the blocks in turn
+static int *next_input(void *pvContext)
+{
+    unsigned *puiBlock = (unsigned *)pvContext;
+
+    return iIn[(*puiBlock)++ % N_BLOCKS];
+}
+
+// Rates planned if uiFsIn and uiFsOut are given, else from the codes
+static uint64_t init(test_asrc_t *psInst, fs_code_t eIn, fs_code_t eOut, unsigned uiFsIn, unsigned uiFsOut)
+{
+    if(uiFsIn)
+        return test_asrc_init_rates_arena(psInst, uiFsIn, uiFsOut, N_CHANNELS, N_IN_SAMPLES, OFF);
+    return test_asrc_init(psInst, eIn, eOut, N_CHANNELS, N_IN_SAMPLES, OFF);
+}
+
+static void test_pull(fs_code_t eIn, fs_code_t eOut, unsigned uiFsIn, unsigned uiFsOut, int iLowest)
+{
+    static test_asrc_t      sInst[2];
+    uint64_t                u64Ratio;
+    unsigned                uiMaxOut, uiNRef = 0, uiNPulled = 0, uiBlock = 0, uiNIn = 0;
+    uint32_t                uiSeed = 3;
+
+    u64Ratio = init(&sInst[0], eIn, eOut, uiFsIn, uiFsOut);
+    init(&sInst[1], eIn, eOut, uiFsIn, uiFsOut);
+    if(iLowest)
+        u64Ratio = (uint64_t)sInst[0].sCtrl[0].sFsRatioConfig.uiMinFsRatio << 32;
+    else
+        u64Ratio += u64Ratio >> 12;
+    if(!uiFsIn)
+    {
+        uiFsIn  = uiFsHz[eIn];
+        uiFsOut = uiFsHz[eOut];
+    }
+    test_case("%u->%u", uiFsIn, uiFsOut);
+
+    if(asrc_pull_buffer_length(sInst[1].sCtrl) > sizeof(iPullBuffer) / sizeof(int))
+    {
+        fail("pull buffer too long");
+        return;
+    }
+    uiMaxOut = asrc_pull_buffer_length(sInst[1].sCtrl) / N_CHANNELS;
+    asrc_init_pull(sInst[1].sCtrl, iPullBuffer);
+
+    // Reference output of all the blocks
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        unsigned n = asrc_process(iIn[b], iRef + uiNRef * N_CHANNELS, u64Ratio, sInst[0].sCtrl);
+        if(n > uiMaxOut)
+        {
+            fail("more output in a block than the pull buffer holds");
+            return;
+        }
+        uiNRef += n;
+    }
+
+    // Pulled from 1 to N_OUT_MAX samples at a time, while the reference has them
+    for(;;)
+    {
+        unsigned n;
+
+        uiSeed  = uiSeed * 1664525 + 1013904223;
+        n       = 1 + (uiSeed >> 8) % N_OUT_MAX;
+        if(uiNPulled + n > uiNRef)
+            break;
+        uiNIn += asrc_process_pull(iOut, n, u64Ratio, sInst[1].sCtrl, next_input, &uiBlock);
+        if(memcmp(iOut, iRef + uiNPulled * N_CHANNELS, n * N_CHANNELS * sizeof(int)) != 0)
+        {
+            fail("output differs");
+            return;
+        }
+        uiNPulled += n;
+    }
+    if(uiNIn != uiBlock * N_IN_SAMPLES)
+        fail("wrong number of input samples taken");
+    if(uiNPulled < uiNRef - N_OUT_MAX)
+        fail("not all output pulled");
+}
+
+int main(void)
+{
+    static const unsigned   uiPairs[][2] = {
+        {16000, 48000}, {48000, 384000}, {32000, 8000}, {44100, 22050}
+    };
+    uint32_t                uiSeed = 1;
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+        next_block(iIn[b], N_CHANNELS * N_IN_SAMPLES, &uiSeed);
+
+    for(int iLowest = 0; iLowest < 2; iLowest++)
+    {
+        for(fs_code_t eIn = FS_CODE_44; eIn <= FS_CODE_192; eIn++)
+            for(fs_code_t eOut = FS_CODE_44; eOut <= FS_CODE_192; eOut++)
+                test_pull(eIn, eOut, 0, 0, iLowest);
+        for(unsigned ui = 0; ui < sizeof(uiPairs) / sizeof(uiPairs[0]); ui++)
+            test_pull(0, 0, uiPairs[ui][0], uiPairs[ui][1], iLowest);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,174 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks asrc_init_quality(). For every pair of rate codes a 1kHz and a 10kHz
+// tone are converted by ASRC in each quality tier, at a ratio slightly off
+// nominal, and the THD+N at the output is measured. Each tier must reach its
+// limits, and with the minimum phase filters each tier must do as well as
+// with its linear phase ones, or reach the limits of the standard tier where
+// the fixed point arithmetic sets the floor. At the nominal ratio the output
+// of each tier and filter phase must be the same with interleaved F3 delay
+// lines. Run with any argument to print the THD+N, as in the programming
+// guide.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#define     ASRC_N_CHANNELS             2
+#include "src.h"
+#include "test_util.h"
+
+#define     N_CHANNELS                  2
+#define     N_IN_SAMPLES                16
+#define     N_OUT_IN_RATIO_MAX          5
+#define     N_BLOCKS                    200
+#define     RATIO_OFFSET                1.0001                  // Fs ratio of the THD+N run relative to nominal
+#define     SETTLE_S                    0.02                    // Skipped at the start of the output
+#define     MEASURE_S                   0.1
+#define     N_MEASURE_MAX               19200                   // MEASURE_S at 192kHz
+
+#define     N_TONES                     2
+#define     N_QUALITIES                 2
+#define     MAX_MP_OVER_LP_DB           1.0
+
+static const double dToneHz[N_TONES]                    = {1000.0, 10000.0};
+static const double dMaxThdNDb[N_QUALITIES][N_TONES]    = {{-130.0, -110.0}, {-150.0, -150.0}};
+
+static int      iIn[N_CHANNELS * N_IN_SAMPLES];
+static int      iOut[N_CHANNELS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+static int      iRef[N_BLOCKS][N_CHANNELS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+static unsigned uiRefN[N_BLOCKS];
+static double   dY[N_MEASURE_MAX];
+
+static test_asrc_t  sInst;
+
+// Also sets the case under test
+static uint64_t init(fs_code_t eIn, fs_code_t eOut, asrc_quality_t eQuality, src_filter_phase_t ePhase)
+{
+    uint64_t    u64Nominal;
+
+    test_case("%u->%u %s quality", uiFsHz[eIn], uiFsHz[eOut], pzQuality[eQuality]);
+    u64Nominal = test_asrc_init(&sInst, eIn, eOut, N_CHANNELS, N_IN_SAMPLES, OFF);
+    asrc_init_filter_phase(sInst.sCtrl, ePhase);
+    asrc_init_quality(sInst.sCtrl, eQuality);
+    return u64Nominal;
+}
+
+// THD+N of channel 0 in dB: the residual after a least squares fit of the tone at its frequency
+static double thd_n(fs_code_t eIn, fs_code_t eOut, asrc_quality_t eQuality, src_filter_phase_t ePhase, double dHz)
+{
+    uint64_t    u64Ratio    = (uint64_t)((double)init(eIn, eOut, eQuality, ePhase) * RATIO_OFFSET);
+    unsigned    uiFirst     = (unsigned)(SETTLE_S * uiFsHz[eOut]);
+    unsigned    uiLength    = (unsigned)(MEASURE_S * uiFsHz[eOut]);
+    double      dOmega      = 2 * M_PI * dHz * RATIO_OFFSET / uiFsHz[eOut];
+    double      dSS = 0, dCC = 0, dSC = 0, dYS = 0, dYC = 0;
+    double      dA, dB, dDet, dTone = 0, dResidual = 0;
+    unsigned    uiOut       = 0;
+
+    for(unsigned uiBlock = 0; uiOut < uiFirst + uiLength; uiBlock++)
+    {
+        unsigned    uiN;
+
+        next_tone(iIn, N_CHANNELS, N_IN_SAMPLES, uiBlock * N_IN_SAMPLES, uiFsHz[eIn], dHz);
+        uiN = asrc_process(iIn, iOut, u64Ratio, sInst.sCtrl);
+        for(unsigned ui = 0; ui < uiN; ui++, uiOut++)
+            if(uiOut >= uiFirst && uiOut < uiFirst + uiLength)
+                dY[uiOut - uiFirst] = iOut[N_CHANNELS * ui];
+    }
+    for(unsigned ui = 0; ui < uiLength; ui++)
+    {
+        double  dS  = sin(dOmega * ui);
+        double  dC  = cos(dOmega * ui);
+
+        dSS += dS * dS;     dCC += dC * dC;     dSC += dS * dC;
+        dYS += dY[ui] * dS; dYC += dY[ui] * dC;
+    }
+    dDet    = dSS * dCC - dSC * dSC;
+    dA      = (dYS * dCC - dYC * dSC) / dDet;
+    dB      = (dYC * dSS - dYS * dSC) / dDet;
+    for(unsigned ui = 0; ui < uiLength; ui++)
+    {
+        double  dFit    = dA * sin(dOmega * ui) + dB * cos(dOmega * ui);
+
+        dTone       += dFit * dFit;
+        dResidual   += (dY[ui] - dFit) * (dY[ui] - dFit);
+    }
+    return 10 * log10(dResidual / dTone);
+}
+
+// Runs N_BLOCKS at the nominal ratio, the first run is kept as the reference for the others
+static void run_nominal(fs_code_t eIn, fs_code_t eOut, asrc_quality_t eQuality, src_filter_phase_t ePhase,
+                        int iInterleaved, int iRef0)
+{
+    uint64_t    u64Nominal  = init(eIn, eOut, eQuality, ePhase);
+
+    if(iInterleaved)
+        asrc_init_f3_interleaved(sInst.sCtrl, sInst.iF3Delay);
+    for(unsigned uiBlock = 0; uiBlock < N_BLOCKS; uiBlock++)
+    {
+        unsigned    uiN;
+
+        next_tone(iIn, N_CHANNELS, N_IN_SAMPLES, uiBlock * N_IN_SAMPLES, uiFsHz[eIn], dToneHz[0]);
+        uiN = asrc_process(iIn, iOut, u64Nominal, sInst.sCtrl);
+        if(iRef0)
+        {
+            uiRefN[uiBlock] = uiN;
+            memcpy(iRef[uiBlock], iOut, uiN * N_CHANNELS * sizeof(int));
+        }
+        else if(uiN != uiRefN[uiBlock] || memcmp(iRef[uiBlock], iOut, uiN * N_CHANNELS * sizeof(int)))
+        {
+            fail("output differs with interleaved F3 delay lines");
+            return;
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    (void)argv;
+
+    for(fs_code_t eIn = FS_CODE_44; eIn <= FS_CODE_192; eIn++)
+        for(fs_code_t eOut = FS_CODE_44; eOut <= FS_CODE_192; eOut++)
+        {
+            double  dThdN[N_QUALITIES][N_TONES];
+            double  dMP[N_QUALITIES][N_TONES];
+
+            for(asrc_quality_t eQuality = ASRC_LOW_QUALITY; eQuality <= ASRC_STANDARD_QUALITY; eQuality++)
+            {
+                for(unsigned uiTone = 0; uiTone < N_TONES; uiTone++)
+                {
+                    dThdN[eQuality][uiTone] = thd_n(eIn, eOut, eQuality, SRC_LINEAR_PHASE, dToneHz[uiTone]);
+                    if(dThdN[eQuality][uiTone] > dMaxThdNDb[eQuality][uiTone])
+                        fail("THD+N too high");
+                }
+
+                for(src_filter_phase_t ePhase = SRC_LINEAR_PHASE; ePhase <= SRC_MINIMUM_PHASE; ePhase++)
+                {
+                    run_nominal(eIn, eOut, eQuality, ePhase, 0, 1);
+                    run_nominal(eIn, eOut, eQuality, ePhase, 1, 0);
+                }
+            }
+            for(asrc_quality_t eQuality = ASRC_LOW_QUALITY; eQuality <= ASRC_STANDARD_QUALITY; eQuality++)
+                for(unsigned uiTone = 0; uiTone < N_TONES; uiTone++)
+                {
+                    dMP[eQuality][uiTone] = thd_n(eIn, eOut, eQuality, SRC_MINIMUM_PHASE, dToneHz[uiTone]);
+                    if(dMP[eQuality][uiTone] > dThdN[eQuality][uiTone] + MAX_MP_OVER_LP_DB &&
+                       dMP[eQuality][uiTone] > dMaxThdNDb[ASRC_STANDARD_QUALITY][uiTone])
+                        fail("minimum phase THD+N higher");
+                }
+            if(argc > 1)
+                printf("%6u->%6u: THD+N at 1kHz/10kHz %6.1f/%6.1f dB low (%6.1f/%6.1f dB minimum phase), %6.1f/%6.1f dB standard (%6.1f/%6.1f dB minimum phase)\n",
+                       uiFsHz[eIn], uiFsHz[eOut], dThdN[0][0], dThdN[0][1], dMP[0][0], dMP[0][1],
+                       dThdN[1][0], dThdN[1][1], dMP[1][0], dMP[1][1]);
+        }
+
+    return test_result();
+}
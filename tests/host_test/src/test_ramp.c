@@ -0,0 +1,128 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks asrc_process_ramp(). The Fs ratio is ramped up and down over the
+// run, piecewise linear with a knee every N_SPLIT blocks of N_IN_SAMPLES.
+// An instance fed blocks of N_SPLIT * N_IN_SAMPLES must give exactly the
+// output of ones fed the same samples in blocks of N_IN_SAMPLES, with the
+// ratio at the ends of each of these on the ramp, as they step the F3 time
+// the same way. The ramp slope is chosen so that the time step increment per
+// F3 input sample is exact for both block sizes. This is run for every pair
+// of rate codes and a few pairs planned by asrc_init_rates_arena(), with
+// one F3 delay line per channel and with them interleaved.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define     ASRC_N_CHANNELS             2
+#include "src.h"
+#include "test_util.h"
+
+#define     N_CHANNELS                  2
+#define     N_IN_SAMPLES                16
+#define     N_SPLIT                     4
+#define     N_BLOCKS                    100
+#define     N_OUT_IN_RATIO_MAX          10
+
+static int      iIn[N_CHANNELS * N_IN_SAMPLES * N_SPLIT];
+static int      iOut[3][N_CHANNELS * N_IN_SAMPLES * N_SPLIT * N_OUT_IN_RATIO_MAX];
+
+// Rates planned if uiFsIn is given, else from the codes
+static uint64_t init(test_asrc_t *psInst, fs_code_t eIn, fs_code_t eOut, unsigned uiFsIn, unsigned uiFsOut,
+                     unsigned uiNInSamples, int iF3Interleaved)
+{
+    uint64_t    u64Nominal;
+
+    if(uiFsIn)
+        u64Nominal = test_asrc_init_rates_arena(psInst, uiFsIn, uiFsOut, N_CHANNELS, uiNInSamples, OFF);
+    else
+        u64Nominal = test_asrc_init(psInst, eIn, eOut, N_CHANNELS, uiNInSamples, OFF);
+    if(iF3Interleaved)
+        asrc_init_f3_interleaved(psInst->sCtrl, psInst->iF3Delay);
+    return u64Nominal;
+}
+
+// Knee k of the ramp: up for four knees, then down for four
+static uint64_t knee(uint64_t u64Base, uint64_t u64Delta, unsigned k)
+{
+    return u64Base + ((k % 8 < 4) ? k % 8 : 8 - k % 8) * u64Delta;
+}
+
+static void test_ramp(fs_code_t eIn, fs_code_t eOut, unsigned uiFsIn, unsigned uiFsOut)
+{
+    static test_asrc_t      sInst[3];
+    uint64_t                u64Nominal, u64Base, u64Delta, u64StepNominal;
+    unsigned                uiNSync, uiShift;
+    uint32_t                uiSeed = 5;
+
+    u64Nominal  = init(&sInst[0], eIn, eOut, uiFsIn, uiFsOut, N_IN_SAMPLES * N_SPLIT, 0);
+    init(&sInst[1], eIn, eOut, uiFsIn, uiFsOut, N_IN_SAMPLES, 0);
+    init(&sInst[2], eIn, eOut, uiFsIn, uiFsOut, N_IN_SAMPLES, 1);
+    if(!uiFsIn)
+    {
+        uiFsIn  = uiFsHz[eIn];
+        uiFsOut = uiFsHz[eOut];
+    }
+    test_case("%u->%u", uiFsIn, uiFsOut);
+
+    // Knees 1/4000 of the nominal time step apart, a multiple of the F3 input samples of a large block
+    uiNSync         = sInst[0].sCtrl[0].uiNSyncSamples;
+    uiShift         = sInst[0].sCtrl[0].sFsRatioConfig.iFsRatioShift;
+    u64StepNominal  = u64Nominal >> uiShift;
+    u64Delta        = ((u64StepNominal / 4000 / uiNSync + 1) * uiNSync) << uiShift;
+    u64Base         = u64Nominal - 2 * u64Delta;
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        uint64_t    u64Start    = knee(u64Base, u64Delta, b);
+        uint64_t    u64End      = knee(u64Base, u64Delta, b + 1);
+        unsigned    n0, n1 = 0, n2 = 0;
+
+        next_block(iIn, N_CHANNELS * N_IN_SAMPLES * N_SPLIT, &uiSeed);
+
+        n0 = asrc_process_ramp(iIn, iOut[0], u64Start, u64End, sInst[0].sCtrl);
+        for(unsigned k = 0; k < N_SPLIT; k++)
+        {
+            // Both ends of the small block on the ramp, u64End - u64Start is a multiple of N_SPLIT
+            uint64_t    u64S    = u64Start + (int64_t)(u64End - u64Start) / N_SPLIT * (int64_t)k;
+            uint64_t    u64E    = u64Start + (int64_t)(u64End - u64Start) / N_SPLIT * (int64_t)(k + 1);
+            int*        piIn    = &iIn[N_CHANNELS * N_IN_SAMPLES * k];
+
+            n1 += asrc_process_ramp(piIn, &iOut[1][N_CHANNELS * n1], u64S, u64E, sInst[1].sCtrl);
+            n2 += asrc_process_ramp(piIn, &iOut[2][N_CHANNELS * n2], u64S, u64E, sInst[2].sCtrl);
+        }
+
+        if(n0 != n1 || memcmp(iOut[0], iOut[1], n0 * N_CHANNELS * sizeof(int)) != 0)
+        {
+            fail("output of small blocks differs in block %u", b);
+            return;
+        }
+        if(n0 != n2 || memcmp(iOut[0], iOut[2], n0 * N_CHANNELS * sizeof(int)) != 0)
+        {
+            fail("output of small blocks with F3 delay lines interleaved differs in block %u", b);
+            return;
+        }
+    }
+}
+
+int main(void)
+{
+    static const unsigned   uiPairs[][2] = {
+        {16000, 48000}, {48000, 384000}, {32000, 8000}, {44100, 22050}
+    };
+
+    for(fs_code_t eIn = FS_CODE_44; eIn <= FS_CODE_192; eIn++)
+        for(fs_code_t eOut = FS_CODE_44; eOut <= FS_CODE_192; eOut++)
+            test_ramp(eIn, eOut, 0, 0);
+    for(unsigned ui = 0; ui < sizeof(uiPairs) / sizeof(uiPairs[0]); ui++)
+        test_ramp(0, 0, uiPairs[ui][0], uiPairs[ui][1]);
+
+    return test_result();
+}
@@ -0,0 +1,211 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Checks asrc_init_rates() and asrc_init_rates_arena() for rates other than
+// those of the codes. A pair with the rates of a planner template scaled must
+// give exactly the output of the template with both, fed the same samples at
+// the same Fs ratio. Other pairs, whose filters are designed in the arena,
+// must convert a sine cleanly, with the output rate and the Q4.60 nominal
+// ratio exactly as asked for, keep a tone at 0.4 times the lower rate
+// within the passband ripple, and reject a tone above the output Nyquist
+// frequency. Pairs with an Fs ratio above 15.68 must be rejected.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#define     ASRC_N_CHANNELS             1
+#include "src.h"
+#include "test_util.h"
+
+#define     N_IN_SAMPLES                16
+#define     N_OUT_IN_RATIO_MAX          48
+#define     N_BLOCKS                    1024
+#define     MIN_SNR_DB                  110.0
+#define     MAX_GAIN_ERROR_DB           0.086                   // 1%
+#define     MIN_PASSBAND_SNR_DB         100.0
+#define     PASSBAND                    0.4
+#define     MAX_PASSBAND_ERROR_DB       0.1
+#define     MIN_ALIAS_REJECTION_DB      100.0
+
+static int is_code_rate(unsigned uiFs)
+{
+    for(unsigned ui = 0; ui < sizeof(uiFsHz) / sizeof(uiFsHz[0]); ui++)
+        if(uiFsHz[ui] == uiFs)
+            return 1;
+    return 0;
+}
+
+// The planner templates, as in src_mrhf_asrc.c, scaled by uiMul / uiDiv
+static void test_template(fs_code_t eIn, fs_code_t eOut, unsigned uiMul, unsigned uiDiv)
+{
+    static test_asrc_t  sInst[3];
+    unsigned            uiFsIn      = uiFsHz[eIn] * uiMul / uiDiv;
+    unsigned            uiFsOut     = uiFsHz[eOut] * uiMul / uiDiv;
+    int                 iIn[N_IN_SAMPLES];
+    int                 iOut[3][N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+    uint32_t            uiSeed      = uiFsIn ^ uiFsOut;
+
+    if(is_code_rate(uiFsIn) && is_code_rate(uiFsOut))
+        return;
+
+    test_case("%u->%u", uiFsIn, uiFsOut);
+    uint64_t u64Ratio   = test_asrc_init(&sInst[0], eIn, eOut, 1, N_IN_SAMPLES, OFF);
+    test_asrc_init_rates(&sInst[1], uiFsIn, uiFsOut, 1, N_IN_SAMPLES, OFF);
+    test_asrc_init_rates_arena(&sInst[2], uiFsIn, uiFsOut, 1, N_IN_SAMPLES, OFF);
+
+    for(unsigned b = 0; b < N_BLOCKS / 4; b++)
+    {
+        next_block(iIn, N_IN_SAMPLES, &uiSeed);
+        unsigned n0 = asrc_process(iIn, iOut[0], u64Ratio, sInst[0].sCtrl);
+        unsigned n1 = asrc_process(iIn, iOut[1], u64Ratio, sInst[1].sCtrl);
+        unsigned n2 = asrc_process(iIn, iOut[2], u64Ratio, sInst[2].sCtrl);
+        if(n0 != n1 || n0 != n2 || memcmp(iOut[0], iOut[1], n0 * sizeof(int)) != 0 ||
+           memcmp(iOut[0], iOut[2], n0 * sizeof(int)) != 0)
+        {
+            fail("output differs from its template");
+            return;
+        }
+    }
+}
+
+static int          iOut[N_BLOCKS * N_IN_SAMPLES * N_OUT_IN_RATIO_MAX];
+
+// Converts a sine of dFreq into iOut, returns the number of output samples
+static unsigned convert_sine(unsigned uiFsIn, unsigned uiFsOut, double dFreq)
+{
+    static test_asrc_t  sInst;
+    unsigned            uiNOut      = 0;
+    int                 iIn[N_IN_SAMPLES];
+
+    uint64_t u64Ratio   = test_asrc_init_rates_arena(&sInst, uiFsIn, uiFsOut, 1, N_IN_SAMPLES, OFF);
+    if(u64Ratio != (uint64_t)(((unsigned __int128)uiFsIn << 60) / uiFsOut))
+        fail("nominal ratio is not exact");
+
+    for(unsigned b = 0; b < N_BLOCKS; b++)
+    {
+        next_tone(iIn, 1, N_IN_SAMPLES, b * N_IN_SAMPLES, uiFsIn, dFreq);
+        uiNOut         += asrc_process(iIn, &iOut[uiNOut], u64Ratio, sInst.sCtrl);
+    }
+    return uiNOut;
+}
+
+// A sine of dFreq. The sine fitted to the output after the filters have settled must leave a
+// residual at least dMinSnr down, with a gain within dMaxErrorDB of unity
+static void test_sine(unsigned uiFsIn, unsigned uiFsOut, double dFreq, double dMinSnr, double dMaxErrorDB)
+{
+    unsigned            uiNOut;
+
+    test_case("%u->%u", uiFsIn, uiFsOut);
+    if(!asrc_rates_supported(uiFsIn, uiFsOut))
+    {
+        fail("rates not supported");
+        return;
+    }
+
+    uiNOut      = convert_sine(uiFsIn, uiFsOut, dFreq);
+
+    // Output rate
+    double dExpected    = (double)N_BLOCKS * N_IN_SAMPLES * uiFsOut / uiFsIn;
+    if(fabs(uiNOut - dExpected) > 2)
+    {
+        fail("%u output samples, expected %.1f", uiNOut, dExpected);
+        return;
+    }
+
+    // Least squares fit of the sine over the second half of the output
+    double      dW      = 2 * M_PI * dFreq / uiFsOut;
+    double      dCC = 0, dSS = 0, dCS = 0, dYC = 0, dYS = 0;
+    unsigned    uiStart = uiNOut / 2;
+    for(unsigned m = uiStart; m < uiNOut; m++)
+    {
+        double dC = cos(dW * m), dS = sin(dW * m);
+        dCC += dC * dC; dSS += dS * dS; dCS += dC * dS;
+        dYC += iOut[m] * dC; dYS += iOut[m] * dS;
+    }
+    double      dDet    = dCC * dSS - dCS * dCS;
+    double      dA      = (dYC * dSS - dYS * dCS) / dDet;
+    double      dB      = (dYS * dCC - dYC * dCS) / dDet;
+    double      dErr    = 0, dSig = 0;
+    for(unsigned m = uiStart; m < uiNOut; m++)
+    {
+        double dFit = dA * cos(dW * m) + dB * sin(dW * m);
+        dErr += (iOut[m] - dFit) * (iOut[m] - dFit);
+        dSig += dFit * dFit;
+    }
+    double      dSnr    = 10 * log10(dSig / dErr);
+    double      dGainDB = 20 * log10(sqrt(dA * dA + dB * dB) / TEST_TONE_AMPLITUDE);
+    if(dSnr < dMinSnr || fabs(dGainDB) > dMaxErrorDB)
+        fail("%.0fHz: SNR %.1fdB, gain %.3fdB", dFreq, dSnr, dGainDB);
+}
+
+// When decimating, a sine at 0.48 Fsin is above the output Nyquist frequency and in the stopband
+// of every template from an Fs ratio of 1.2 on. What is left of it after the filters have settled
+// must be at least MIN_ALIAS_REJECTION_DB down
+static void test_alias(unsigned uiFsIn, unsigned uiFsOut)
+{
+    unsigned            uiNOut;
+    double              dPower      = 0;
+
+    if(uiFsIn * 5ULL < uiFsOut * 6ULL)
+        return;
+    test_case("%u->%u", uiFsIn, uiFsOut);
+
+    uiNOut      = convert_sine(uiFsIn, uiFsOut, 0.48 * uiFsIn);
+    for(unsigned m = uiNOut / 2; m < uiNOut; m++)
+        dPower += (double)iOut[m] * iOut[m];
+    double dRejection   = 10 * log10(TEST_TONE_AMPLITUDE * TEST_TONE_AMPLITUDE / 2 / (dPower / (uiNOut - uiNOut / 2)));
+    if(dRejection < MIN_ALIAS_REJECTION_DB)
+        fail("alias rejection %.1fdB", dRejection);
+}
+
+int main(void)
+{
+    static const fs_code_t  eTemplates[][2] = {
+        {FS_CODE_44, FS_CODE_44}, {FS_CODE_48, FS_CODE_44}, {FS_CODE_88, FS_CODE_48}, {FS_CODE_88, FS_CODE_44},
+        {FS_CODE_96, FS_CODE_44}, {FS_CODE_176, FS_CODE_48}, {FS_CODE_176, FS_CODE_44}, {FS_CODE_192, FS_CODE_44}
+    };
+    static const unsigned   uiPairs[][2] = {
+        {8000, 48000}, {16000, 48000}, {16000, 44100}, {24000, 48000}, {32000, 48000}, {8000, 16000},
+        {48000, 32000}, {44100, 32000}, {48000, 24000}, {48000, 16000}, {32000, 8000}, {24000, 8000},
+        {16000, 8000}, {44100, 22050}, {44100, 16000}, {11025, 8000}, {48000, 384000}, {44100, 352800},
+        {384000, 192000}, {352800, 96000}, {384000, 96000}, {384000, 88200}, {352800, 384000}, {384000, 352800},
+        {48000, 8000}, {384000, 48000}, {192000, 16000}, {352800, 32000}
+    };
+
+    for(unsigned ui = 0; ui < sizeof(eTemplates) / sizeof(eTemplates[0]); ui++)
+    {
+        test_template(eTemplates[ui][0], eTemplates[ui][1], 1, 4);
+        test_template(eTemplates[ui][0], eTemplates[ui][1], 1, 2);
+        test_template(eTemplates[ui][0], eTemplates[ui][1], 2, 1);
+        test_template(eTemplates[ui][0], eTemplates[ui][1], 4, 1);
+    }
+
+    for(unsigned ui = 0; ui < sizeof(uiPairs) / sizeof(uiPairs[0]); ui++)
+    {
+        unsigned    uiFsMin = uiPairs[ui][0] < uiPairs[ui][1] ? uiPairs[ui][0] : uiPairs[ui][1];
+
+        // 1kHz is below the passband edge of every pair, 0.4 times the lower rate is close to it
+        test_sine(uiPairs[ui][0], uiPairs[ui][1], 1000.0, MIN_SNR_DB, MAX_GAIN_ERROR_DB);
+        test_sine(uiPairs[ui][0], uiPairs[ui][1], PASSBAND * uiFsMin, MIN_PASSBAND_SNR_DB, MAX_PASSBAND_ERROR_DB);
+        test_alias(uiPairs[ui][0], uiPairs[ui][1]);
+    }
+
+    // Above the highest Fs ratio the filters are designed for, and no rate at all
+    test_case("asrc_rates_supported");
+    if(asrc_rates_supported(768000, 44100) || asrc_rates_supported(384000, 22050) ||
+       asrc_rates_supported(0, 48000) || asrc_rates_supported(48000, 0))
+        fail("unsupported rates accepted");
+    if(!asrc_rates_supported(192000, 44100) || !asrc_rates_supported(44100, 44100) ||
+       !asrc_rates_supported(48000, 8000) || !asrc_rates_supported(384000, 44100))
+        fail("supported rates rejected");
+
+    return test_result();
+}
@@ -0,0 +1,139 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Helpers shared by the host tests, see test_util.h.
+//
+// ===========================================================================
+// ===========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "test_util.h"
+
+#define     MAX_PRINTED                 20                      // Failures printed, the others are only counted
+// Stack of each channel: ASRC_STACK_LENGTH_MULT, and SSRC_STACK_LENGTH_MULT with SSRC_N_IN_SAMPLES
+// of 4, times the input samples, for uiNChannels
+#define     STACK_LENGTH(n, m)          (4 * (n) * (m))
+
+const unsigned  uiFsHz[FS_CODE_192 + 1]     = {44100, 48000, 88200, 96000, 176400, 192000};
+const char*     pzQuality[]                 = {"low", "standard"};
+
+static int      iFailures                   = 0;
+static char     zCase[128]                  = "";
+
+void test_case(const char *pzFormat, ...)
+{
+    va_list     sArgs;
+
+    va_start(sArgs, pzFormat);
+    vsnprintf(zCase, sizeof(zCase), pzFormat, sArgs);
+    va_end(sArgs);
+}
+
+void fail(const char *pzFormat, ...)
+{
+    va_list     sArgs;
+
+    if(iFailures++ >= MAX_PRINTED)
+        return;
+    printf("FAIL %s: ", zCase);
+    va_start(sArgs, pzFormat);
+    vprintf(pzFormat, sArgs);
+    va_end(sArgs);
+    printf("\n");
+}
+
+int test_result(void)
+{
+    if(iFailures)
+    {
+        printf("%d failures\n", iFailures);
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
+
+int next_sample(uint32_t *puiSeed)
+{
+    *puiSeed = *puiSeed * 1664525 + 1013904223;
+    return (int)(*puiSeed & 0xFFFFFF00) >> 2;
+}
+
+void next_block(int *piIn, unsigned uiN, uint32_t *puiSeed)
+{
+    for(unsigned ui = 0; ui < uiN; ui++)
+        piIn[ui] = next_sample(puiSeed);
+}
+
+void next_tone(int *piIn, unsigned uiNChannels, unsigned uiNSamples, unsigned uiFirst, unsigned uiFs, double dHz)
+{
+    for(unsigned ui = 0; ui < uiNSamples; ui++)
+    {
+        double  dPhase  = 2 * M_PI * dHz * (double)(uiFirst + ui) / uiFs;
+
+        for(unsigned uj = 0; uj < uiNChannels; uj++)
+            piIn[uiNChannels * ui + uj] = (int)lrint(TEST_TONE_AMPLITUDE * ((uj & 1) ? cos(dPhase) : sin(dPhase)));
+    }
+}
+
+void to_planar(int *piPlanar[], const int *piIn, unsigned uiNChannels, unsigned uiNSamples)
+{
+    for(unsigned ui = 0; ui < uiNSamples; ui++)
+        for(unsigned uj = 0; uj < uiNChannels; uj++)
+            piPlanar[uj][ui] = piIn[uiNChannels * ui + uj];
+}
+
+// Points the control structures at the state, stack and coefficients of the instance
+static void asrc_setup(test_asrc_t *psInst, unsigned uiNChannels, unsigned uiNInSamples)
+{
+    free(psInst->piStack);
+    psInst->piStack = malloc(uiNChannels * STACK_LENGTH(uiNChannels, uiNInSamples) * sizeof(int));
+    for(unsigned uj = 0; uj < uiNChannels; uj++)
+    {
+        psInst->sCtrl[uj].psState   = &psInst->sState[uj];
+        psInst->sCtrl[uj].piStack   = &psInst->piStack[uj * STACK_LENGTH(uiNChannels, uiNInSamples)];
+        psInst->sCtrl[uj].piADCoefs = psInst->sCoefs.iASRCADFIRCoefs;
+    }
+}
+
+uint64_t test_asrc_init(test_asrc_t *psInst, fs_code_t eIn, fs_code_t eOut, unsigned uiNChannels, unsigned uiNInSamples,
+                        dither_flag_t eDither)
+{
+    asrc_setup(psInst, uiNChannels, uiNInSamples);
+    return asrc_init(eIn, eOut, psInst->sCtrl, uiNChannels, uiNInSamples, eDither);
+}
+
+uint64_t test_asrc_init_rates(test_asrc_t *psInst, unsigned uiFsIn, unsigned uiFsOut, unsigned uiNChannels,
+                              unsigned uiNInSamples, dither_flag_t eDither)
+{
+    asrc_setup(psInst, uiNChannels, uiNInSamples);
+    return asrc_init_rates(uiFsIn, uiFsOut, psInst->sCtrl, uiNChannels, uiNInSamples, eDither);
+}
+
+uint64_t test_asrc_init_rates_arena(test_asrc_t *psInst, unsigned uiFsIn, unsigned uiFsOut, unsigned uiNChannels,
+                                    unsigned uiNInSamples, dither_flag_t eDither)
+{
+    free(psInst->pu64Arena);
+    psInst->pu64Arena = malloc(asrc_get_memory_requirements_rates(uiFsIn, uiFsOut, uiNChannels, uiNInSamples));
+    return asrc_init_rates_arena(uiFsIn, uiFsOut, psInst->sCtrl, uiNChannels, uiNInSamples, eDither, psInst->pu64Arena);
+}
+
+void test_ssrc_init(test_ssrc_t *psInst, fs_code_t eIn, fs_code_t eOut, unsigned uiNChannels, unsigned uiNInSamples,
+                    dither_flag_t eDither)
+{
+    free(psInst->piStack);
+    psInst->piStack = malloc(uiNChannels * STACK_LENGTH(uiNChannels, uiNInSamples) * sizeof(int));
+    for(unsigned uj = 0; uj < uiNChannels; uj++)
+    {
+        psInst->sCtrl[uj].psState   = &psInst->sState[uj];
+        psInst->sCtrl[uj].piStack   = &psInst->piStack[uj * STACK_LENGTH(uiNChannels, uiNInSamples)];
+    }
+    ssrc_init(eIn, eOut, psInst->sCtrl, uiNChannels, uiNInSamples, eDither);
+}
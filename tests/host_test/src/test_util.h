@@ -0,0 +1,75 @@
+// Copyright 2024 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+// ===========================================================================
+// ===========================================================================
+//
+// Helpers shared by the host tests: failure reporting, input blocks, and
+// SSRC and ASRC instances with their state, stacks and coefficients. Each
+// test keeps only its own checks.
+//
+// ===========================================================================
+// ===========================================================================
+
+#ifndef _TEST_UTIL_H_
+#define _TEST_UTIL_H_
+
+#include <stdint.h>
+#include "src.h"
+
+#define     TEST_MAX_CHANNELS           24                      // Channels of a test_asrc_t or test_ssrc_t
+#define     TEST_TONE_AMPLITUDE         1073741824.0            // Of the tones of next_tone(), -6dB
+
+extern const unsigned   uiFsHz[FS_CODE_192 + 1];                // Rate of each fs_code_t in Hz
+extern const char*      pzQuality[];                            // Name of each asrc_quality_t
+
+// An ASRC instance. Zeroed before the first init (static storage), and may be initialized again
+typedef struct
+{
+    asrc_state_t        sState[TEST_MAX_CHANNELS];
+    asrc_ctrl_t         sCtrl[TEST_MAX_CHANNELS];
+    asrc_adfir_coefs_t  sCoefs;
+    int*                piStack;                                // Stacks of all channels, allocated by the init
+    uint64_t*           pu64Arena;                              // Arena of all channels, allocated by test_asrc_init_rates_arena()
+    int                 iF3Delay[ASRC_F3_INTERLEAVED_DELAY_LENGTH(TEST_MAX_CHANNELS)] __attribute__((aligned(64)));    // For asrc_init_f3_interleaved()
+} test_asrc_t;
+
+// An SSRC instance, as test_asrc_t
+typedef struct
+{
+    ssrc_state_t        sState[TEST_MAX_CHANNELS];
+    ssrc_ctrl_t         sCtrl[TEST_MAX_CHANNELS];
+    int*                piStack;                                // Stacks of all channels, allocated by the init
+} test_ssrc_t;
+
+// Sets the case under test, printed with each failure until the next call
+void        test_case(const char *pzFormat, ...);
+
+// Counts a failure of the case under test, the first ones are printed
+void        fail(const char *pzFormat, ...);
+
+// Prints PASS or the number of failures, returns the exit code of the test
+int         test_result(void);
+
+// Random samples with the low 8 bits clear, -12dB at most, from the generator *puiSeed
+int         next_sample(uint32_t *puiSeed);
+void        next_block(int *piIn, unsigned uiN, uint32_t *puiSeed);
+
+// uiNSamples frames of uiNChannels of a tone of dHz at uiFs, from sample uiFirst of the tone on.
+// Even channels get a sine, odd channels a cosine
+void        next_tone(int *piIn, unsigned uiNChannels, unsigned uiNSamples, unsigned uiFirst, unsigned uiFs, double dHz);
+
+// Copies uiNSamples interleaved frames of uiNChannels into one buffer per channel
+void        to_planar(int *piPlanar[], const int *piIn, unsigned uiNChannels, unsigned uiNSamples);
+
+// Initialize an instance of uiNChannels for blocks of uiNInSamples, see asrc_init(),
+// asrc_init_rates(), asrc_init_rates_arena() and ssrc_init()
+uint64_t    test_asrc_init(test_asrc_t *psInst, fs_code_t eIn, fs_code_t eOut, unsigned uiNChannels, unsigned uiNInSamples,
+                           dither_flag_t eDither);
+uint64_t    test_asrc_init_rates(test_asrc_t *psInst, unsigned uiFsIn, unsigned uiFsOut, unsigned uiNChannels,
+                                 unsigned uiNInSamples, dither_flag_t eDither);
+uint64_t    test_asrc_init_rates_arena(test_asrc_t *psInst, unsigned uiFsIn, unsigned uiFsOut, unsigned uiNChannels,
+                                       unsigned uiNInSamples, dither_flag_t eDither);
+void        test_ssrc_init(test_ssrc_t *psInst, fs_code_t eIn, fs_code_t eOut, unsigned uiNChannels, unsigned uiNInSamples,
+                           dither_flag_t eDither);
+
+#endif // _TEST_UTIL_H_
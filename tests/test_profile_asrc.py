@@ -174,7 +174,6 @@ def test_profile_asrc(firmware_build, in_sr, out_sr, fs_deviation):
 
 
                                 "ADFIR_init_from_desc",
-                                "ASRC_prepare_coefs",
                                 ]
 
         """ From https://ftp.gnu.org/old-gnu/Manuals/gprof-2.9.1/html_chapter/gprof_5.html